@@ -0,0 +1,21 @@
+// Copyright 2020 Russ 'trdwll' Treadwell <trdwll.com>. All Rights Reserved.
+
+#include "Async/SteamAppsAsyncActions.h"
+
+USteamGetFileDetailsAsyncAction* USteamGetFileDetailsAsyncAction::GetFileDetailsAsync(UObject* WorldContextObject, const FString& FileName)
+{
+	USteamGetFileDetailsAsyncAction* const Action = NewObject<USteamGetFileDetailsAsyncAction>();
+	Action->m_FileName = FileName;
+	Action->RegisterWithGameInstance(WorldContextObject);
+	return Action;
+}
+
+void USteamGetFileDetailsAsyncAction::Activate()
+{
+	Await(USteamApps::GetSteamApps()->GetFileDetailsAsync(m_FileName), &USteamGetFileDetailsAsyncAction::OnCompleted);
+}
+
+void USteamGetFileDetailsAsyncAction::OnCompleted(const TSteamCallResult<FileDetailsResult_t>& Result)
+{
+	(Result.bIOFailure || Result.Result.m_eResult != k_EResultOK ? OnFailure : OnSuccess).Broadcast((ESteamResult)Result.Result.m_eResult, (int64)Result.Result.m_ulFileSize, UTF8_TO_TCHAR(Result.Result.m_FileSHA), (int32)Result.Result.m_unFlags);
+}
@@ -0,0 +1,111 @@
+// Copyright 2020 Russ 'trdwll' Treadwell <trdwll.com>. All Rights Reserved.
+
+#include "Async/SteamFriendsAsyncActions.h"
+
+USteamDownloadClanActivityCountsAsyncAction* USteamDownloadClanActivityCountsAsyncAction::DownloadClanActivityCountsAsync(UObject* WorldContextObject, const TArray<FSteamID>& SteamClanIDs)
+{
+	USteamDownloadClanActivityCountsAsyncAction* const Action = NewObject<USteamDownloadClanActivityCountsAsyncAction>();
+	Action->m_SteamClanIDs = SteamClanIDs;
+	Action->RegisterWithGameInstance(WorldContextObject);
+	return Action;
+}
+
+void USteamDownloadClanActivityCountsAsyncAction::Activate()
+{
+	Await(USteamFriends::GetSteamFriends()->DownloadClanActivityCountsAsync(m_SteamClanIDs), &USteamDownloadClanActivityCountsAsyncAction::OnCompleted);
+}
+
+void USteamDownloadClanActivityCountsAsyncAction::OnCompleted(const TSteamCallResult<DownloadClanActivityCountsResult_t>& Result)
+{
+	(Result.bIOFailure || !Result.Result.m_bSuccess ? OnFailure : OnSuccess).Broadcast(Result.Result.m_bSuccess);
+}
+
+USteamGetFollowerCountAsyncAction* USteamGetFollowerCountAsyncAction::GetFollowerCountAsync(UObject* WorldContextObject, FSteamID SteamID)
+{
+	USteamGetFollowerCountAsyncAction* const Action = NewObject<USteamGetFollowerCountAsyncAction>();
+	Action->m_SteamID = SteamID;
+	Action->RegisterWithGameInstance(WorldContextObject);
+	return Action;
+}
+
+void USteamGetFollowerCountAsyncAction::Activate()
+{
+	Await(USteamFriends::GetSteamFriends()->GetFollowerCountAsync(m_SteamID), &USteamGetFollowerCountAsyncAction::OnCompleted);
+}
+
+void USteamGetFollowerCountAsyncAction::OnCompleted(const TSteamCallResult<FriendsGetFollowerCount_t>& Result)
+{
+	(Result.bIOFailure || Result.Result.m_eResult != k_EResultOK ? OnFailure : OnSuccess).Broadcast((ESteamResult)Result.Result.m_eResult, Result.Result.m_steamID.ConvertToUint64(), Result.Result.m_nCount);
+}
+
+USteamIsFollowingAsyncAction* USteamIsFollowingAsyncAction::IsFollowingAsync(UObject* WorldContextObject, FSteamID SteamID)
+{
+	USteamIsFollowingAsyncAction* const Action = NewObject<USteamIsFollowingAsyncAction>();
+	Action->m_SteamID = SteamID;
+	Action->RegisterWithGameInstance(WorldContextObject);
+	return Action;
+}
+
+void USteamIsFollowingAsyncAction::Activate()
+{
+	Await(USteamFriends::GetSteamFriends()->IsFollowingAsync(m_SteamID), &USteamIsFollowingAsyncAction::OnCompleted);
+}
+
+void USteamIsFollowingAsyncAction::OnCompleted(const TSteamCallResult<FriendsIsFollowing_t>& Result)
+{
+	(Result.bIOFailure || Result.Result.m_eResult != k_EResultOK ? OnFailure : OnSuccess).Broadcast((ESteamResult)Result.Result.m_eResult, Result.Result.m_steamID.ConvertToUint64(), Result.Result.m_bIsFollowing);
+}
+
+USteamJoinClanChatRoomAsyncAction* USteamJoinClanChatRoomAsyncAction::JoinClanChatRoomAsync(UObject* WorldContextObject, FSteamID SteamIDClan)
+{
+	USteamJoinClanChatRoomAsyncAction* const Action = NewObject<USteamJoinClanChatRoomAsyncAction>();
+	Action->m_SteamIDClan = SteamIDClan;
+	Action->RegisterWithGameInstance(WorldContextObject);
+	return Action;
+}
+
+void USteamJoinClanChatRoomAsyncAction::Activate()
+{
+	Await(USteamFriends::GetSteamFriends()->JoinClanChatRoomAsync(m_SteamIDClan), &USteamJoinClanChatRoomAsyncAction::OnCompleted);
+}
+
+void USteamJoinClanChatRoomAsyncAction::OnCompleted(const TSteamCallResult<JoinClanChatRoomCompletionResult_t>& Result)
+{
+	(Result.bIOFailure || Result.Result.m_eChatRoomEnterResponse != k_EChatRoomEnterResponseSuccess ? OnFailure : OnSuccess).Broadcast(Result.Result.m_steamIDClanChat.ConvertToUint64(), (ESteamChatRoomEnterResponse)Result.Result.m_eChatRoomEnterResponse);
+}
+
+USteamRequestClanOfficerListAsyncAction* USteamRequestClanOfficerListAsyncAction::RequestClanOfficerListAsync(UObject* WorldContextObject, FSteamID SteamIDClan)
+{
+	USteamRequestClanOfficerListAsyncAction* const Action = NewObject<USteamRequestClanOfficerListAsyncAction>();
+	Action->m_SteamIDClan = SteamIDClan;
+	Action->RegisterWithGameInstance(WorldContextObject);
+	return Action;
+}
+
+void USteamRequestClanOfficerListAsyncAction::Activate()
+{
+	Await(USteamFriends::GetSteamFriends()->RequestClanOfficerListAsync(m_SteamIDClan), &USteamRequestClanOfficerListAsyncAction::OnCompleted);
+}
+
+void USteamRequestClanOfficerListAsyncAction::OnCompleted(const TSteamCallResult<ClanOfficerListResponse_t>& Result)
+{
+	(Result.bIOFailure || Result.Result.m_bSuccess != 1 ? OnFailure : OnSuccess).Broadcast(Result.Result.m_steamIDClan.ConvertToUint64(), Result.Result.m_cOfficers, Result.Result.m_bSuccess == 1);
+}
+
+USteamSetPersonaNameAsyncAction* USteamSetPersonaNameAsyncAction::SetPersonaNameAsync(UObject* WorldContextObject, const FString& PersonaName)
+{
+	USteamSetPersonaNameAsyncAction* const Action = NewObject<USteamSetPersonaNameAsyncAction>();
+	Action->m_PersonaName = PersonaName;
+	Action->RegisterWithGameInstance(WorldContextObject);
+	return Action;
+}
+
+void USteamSetPersonaNameAsyncAction::Activate()
+{
+	Await(USteamFriends::GetSteamFriends()->SetPersonaNameAsync(m_PersonaName), &USteamSetPersonaNameAsyncAction::OnCompleted);
+}
+
+void USteamSetPersonaNameAsyncAction::OnCompleted(const TSteamCallResult<SetPersonaNameResponse_t>& Result)
+{
+	(Result.bIOFailure || Result.Result.m_result != k_EResultOK ? OnFailure : OnSuccess).Broadcast(Result.Result.m_bSuccess, Result.Result.m_bLocalSuccess, (ESteamResult)Result.Result.m_result);
+}
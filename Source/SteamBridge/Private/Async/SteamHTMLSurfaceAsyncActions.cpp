@@ -0,0 +1,22 @@
+// Copyright 2020 Russ 'trdwll' Treadwell <trdwll.com>. All Rights Reserved.
+
+#include "Async/SteamHTMLSurfaceAsyncActions.h"
+
+USteamCreateBrowserAsyncAction* USteamCreateBrowserAsyncAction::CreateBrowserAsync(UObject* WorldContextObject, const FString& UserAgent, const FString& UserCSS)
+{
+	USteamCreateBrowserAsyncAction* const Action = NewObject<USteamCreateBrowserAsyncAction>();
+	Action->m_UserAgent = UserAgent;
+	Action->m_UserCSS = UserCSS;
+	Action->RegisterWithGameInstance(WorldContextObject);
+	return Action;
+}
+
+void USteamCreateBrowserAsyncAction::Activate()
+{
+	Await(USteamHTMLSurface::GetSteamHTMLSurface()->CreateBrowserAsync(m_UserAgent, m_UserCSS), &USteamCreateBrowserAsyncAction::OnCompleted);
+}
+
+void USteamCreateBrowserAsyncAction::OnCompleted(const TSteamCallResult<HTML_BrowserReady_t>& Result)
+{
+	(Result.bIOFailure ? OnFailure : OnSuccess).Broadcast(Result.Result.unBrowserHandle);
+}
@@ -0,0 +1,42 @@
+// Copyright 2020 Russ 'trdwll' Treadwell <trdwll.com>. All Rights Reserved.
+
+#include "SteamBackend.h"
+
+#include "SteamworksBackend.h"
+
+// Defined in this order so the cached interfaces are initialized after the backend they point into
+static FSteamworksBackend GSteamworksBackend;
+
+TUniquePtr<ISteamBridgeBackend> FSteamBackend::m_OwnedBackend;
+ISteamBridgeBackend* FSteamBackend::m_Backend = &GSteamworksBackend;
+ISteamBridgeFriends* FSteamBackend::m_Friends = GSteamworksBackend.Friends();
+ISteamBridgeUser* FSteamBackend::m_User = GSteamworksBackend.User();
+ISteamBridgeGameServer* FSteamBackend::m_GameServer = GSteamworksBackend.GameServer();
+ISteamBridgeHTTP* FSteamBackend::m_HTTP = GSteamworksBackend.HTTP();
+ISteamBridgeInventory* FSteamBackend::m_Inventory = GSteamworksBackend.Inventory();
+ISteamBridgeUtils* FSteamBackend::m_Utils = GSteamworksBackend.Utils();
+
+void FSteamBackend::Set(TUniquePtr<ISteamBridgeBackend>&& Backend)
+{
+	check(Backend.IsValid());
+
+	Use(*Backend);
+	m_OwnedBackend = MoveTemp(Backend);
+}
+
+void FSteamBackend::Reset()
+{
+	Use(GSteamworksBackend);
+	m_OwnedBackend.Reset();
+}
+
+void FSteamBackend::Use(ISteamBridgeBackend& Backend)
+{
+	m_Backend = &Backend;
+	m_Friends = Backend.Friends();
+	m_User = Backend.User();
+	m_GameServer = Backend.GameServer();
+	m_HTTP = Backend.HTTP();
+	m_Inventory = Backend.Inventory();
+	m_Utils = Backend.Utils();
+}
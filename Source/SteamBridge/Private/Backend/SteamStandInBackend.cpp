@@ -0,0 +1,1896 @@
+// Copyright 2020 Russ 'trdwll' Treadwell <trdwll.com>. All Rights Reserved.
+
+#include "SteamStandInBackend.h"
+
+#include "Misc/Parse.h"
+
+static const TCHAR* const NameSyllables[] = {TEXT("ka"), TEXT("ro"), TEXT("mi"), TEXT("zen"), TEXT("ta"), TEXT("vel"), TEXT("lu"), TEXT("dor"), TEXT("shi"), TEXT("an"), TEXT("bri"), TEXT("ox")};
+static const TCHAR* const GroupNames[] = {TEXT("Favorites"), TEXT("Squad"), TEXT("Work")};
+static const uint32 AvatarSizes[] = {32, 64, 184};
+
+static FString MakeName(FRandomStream& Random)
+{
+	FString Name;
+	const int32 Syllables = Random.RandRange(2, 3);
+	for (int32 i = 0; i < Syllables; i++)
+	{
+		Name += NameSyllables[Random.RandHelper((int32)UE_ARRAY_COUNT(NameSyllables))];
+	}
+	Name[0] = FChar::ToUpper(Name[0]);
+	return Name;
+}
+
+static EPersonaState MakePersonaState(FRandomStream& Random)
+{
+	const float Roll = Random.GetFraction();
+	if (Roll < 0.4f)
+	{
+		return k_EPersonaStateOffline;
+	}
+	if (Roll < 0.75f)
+	{
+		return k_EPersonaStateOnline;
+	}
+	if (Roll < 0.85f)
+	{
+		return k_EPersonaStateAway;
+	}
+	if (Roll < 0.9f)
+	{
+		return k_EPersonaStateSnooze;
+	}
+	if (Roll < 0.95f)
+	{
+		return k_EPersonaStateBusy;
+	}
+	return k_EPersonaStateLookingToPlay;
+}
+
+// Key values are kept as UTF-8, like Steam returns them, and only reallocated when they change
+static const char* FindValue(const TArray<TPair<TArray<ANSICHAR>, TArray<ANSICHAR>>>& KeyValues, const char* Key)
+{
+	for (const TPair<TArray<ANSICHAR>, TArray<ANSICHAR>>& KeyValue : KeyValues)
+	{
+		if (FCStringAnsi::Stricmp(KeyValue.Key.GetData(), Key) == 0)
+		{
+			return KeyValue.Value.GetData();
+		}
+	}
+	return "";
+}
+
+static void SetValue(TArray<TPair<TArray<ANSICHAR>, TArray<ANSICHAR>>>& KeyValues, const char* Key, const char* Value)
+{
+	const bool bRemove = Value == nullptr || *Value == '\0';
+	for (int32 i = 0; i < KeyValues.Num(); i++)
+	{
+		if (FCStringAnsi::Stricmp(KeyValues[i].Key.GetData(), Key) == 0)
+		{
+			if (bRemove)
+			{
+				KeyValues.RemoveAt(i);
+			}
+			else if (FCStringAnsi::Strcmp(KeyValues[i].Value.GetData(), Value) != 0)
+			{
+				KeyValues[i].Value = TArray<ANSICHAR>(Value, FCStringAnsi::Strlen(Value) + 1);
+			}
+			return;
+		}
+	}
+
+	if (!bRemove)
+	{
+		KeyValues.Emplace(TArray<ANSICHAR>(Key, FCStringAnsi::Strlen(Key) + 1), TArray<ANSICHAR>(Value, FCStringAnsi::Strlen(Value) + 1));
+	}
+}
+
+FSteamStandInConfig FSteamStandInConfig::FromCommandLine(const TCHAR* CommandLine)
+{
+	FSteamStandInConfig Config;
+	FParse::Value(CommandLine, TEXT("SteamBridgeStandInSeed="), Config.Seed);
+	FParse::Value(CommandLine, TEXT("SteamBridgeStandInFriends="), Config.FriendCount);
+	FParse::Value(CommandLine, TEXT("SteamBridgeStandInClans="), Config.ClanCount);
+	FParse::Value(CommandLine, TEXT("SteamBridgeStandInAppID="), Config.AppID);
+	FParse::Value(CommandLine, TEXT("SteamBridgeStandInLatencyMs="), Config.LatencyMs);
+	FParse::Value(CommandLine, TEXT("SteamBridgeStandInChurnHz="), Config.PersonaChurnHz);
+	return Config;
+}
+
+FSteamStandInBackend::FSteamStandInBackend(const FSteamStandInConfig& Config) :
+	m_Random(Config.Seed),
+	m_LatencySeconds(FMath::Max(Config.LatencyMs, 0.0f) / 1000.0),
+	m_ChurnIntervalSeconds(Config.PersonaChurnHz > 0.0f ? 1.0 / Config.PersonaChurnHz : 0.0),
+	m_NextChurnTime(0.0),
+	m_NextAPICall(1),
+	m_Friends(*this, m_Random, Config),
+	m_Auth(*this),
+	m_User(*this, m_Auth, m_Friends.GetLocalSteamID(), Config),
+	m_GameServer(*this, m_Auth, Config),
+	m_HTTP(*this),
+	m_Inventory(*this, m_Random, m_Friends.GetLocalSteamID()),
+	m_Utils(m_Friends)
+{
+}
+
+void FSteamStandInBackend::Tick(double Now)
+{
+	if (m_ChurnIntervalSeconds > 0.0)
+	{
+		// Like the pipe schedule, don't try to catch up on churn missed while stalled
+		if (m_NextChurnTime < Now - 1.0)
+		{
+			m_NextChurnTime = Now;
+		}
+
+		for (; m_NextChurnTime <= Now; m_NextChurnTime += m_ChurnIntervalSeconds)
+		{
+			m_Friends.Churn();
+		}
+	}
+
+	FSteamCallbackDispatcher& Dispatcher = FSteamCallbackDispatcher::Get();
+
+	int32 Due = 0;
+	for (; Due < m_Scheduled.Num() && m_Scheduled[Due].DueTime <= Now; Due++)
+	{
+		Dispatcher.Post(MoveTemp(m_Scheduled[Due].Queued));
+	}
+	m_Scheduled.RemoveAt(0, Due, false);
+}
+
+void FSteamStandInBackend::Schedule(int32 CallbackID, const void* Data, int32 Size, bool bGameServer, SteamAPICall_t APICall)
+{
+	FScheduledCallback& Scheduled = m_Scheduled.AddDefaulted_GetRef();
+	Scheduled.DueTime = FPlatformTime::Seconds() + m_LatencySeconds;
+	Scheduled.Queued.CallbackID = CallbackID;
+	Scheduled.Queued.bGameServer = bGameServer;
+	Scheduled.Queued.APICall = APICall;
+	Scheduled.Queued.Payload.Append((const uint8*)Data, Size);
+}
+
+TArray<ANSICHAR> FSteamStandInBackend::ToUTF8(const FString& String)
+{
+	const FTCHARToUTF8 Converter(*String);
+	return TArray<ANSICHAR>(Converter.Get(), Converter.Length() + 1);
+}
+
+// Friends
+
+FSteamStandInFriends::FSteamStandInFriends(FSteamStandInBackend& Backend, FRandomStream& Random, const FSteamStandInConfig& Config) :
+	m_Backend(Backend),
+	m_Random(Random),
+	m_AppID(Config.AppID),
+	m_LocalSteamID(1000 + Config.Seed, k_EUniversePublic, k_EAccountTypeIndividual),
+	m_LocalName(FSteamStandInBackend::ToUTF8(TEXT("StandIn Player"))),
+	m_bListenForFriendsMessages(false)
+{
+	for (const TCHAR* const GroupName : GroupNames)
+	{
+		m_GroupNames.Add(FSteamStandInBackend::ToUTF8(GroupName));
+	}
+
+	m_Friends.Reserve(Config.FriendCount);
+	for (int32 i = 0; i < Config.FriendCount; i++)
+	{
+		FStandInFriend& Friend = m_Friends.AddDefaulted_GetRef();
+		Friend.SteamID = CSteamID(100000 + i, k_EUniversePublic, k_EAccountTypeIndividual);
+		Friend.Name = FSteamStandInBackend::ToUTF8(MakeName(m_Random));
+		Friend.Nickname = m_Random.GetFraction() < 0.1f ? FSteamStandInBackend::ToUTF8(MakeName(m_Random)) : TArray<ANSICHAR>();
+		Friend.PersonaState = MakePersonaState(m_Random);
+		Friend.SteamLevel = m_Random.RandRange(0, 150);
+		Friend.GameAppID = Friend.PersonaState != k_EPersonaStateOffline && m_Random.GetFraction() < 0.3f ? m_AppID : 0;
+		Friend.GroupID = m_Random.GetFraction() < 0.5f ? (FriendsGroupID_t)(1 + m_Random.RandHelper((int32)UE_ARRAY_COUNT(GroupNames))) : k_FriendsGroupID_Invalid;
+
+		if (Friend.PersonaState != k_EPersonaStateOffline)
+		{
+			SetFriendRichPresence(Friend, "status", Friend.GameAppID != 0 ? FString::Printf(TEXT("Playing level %d"), m_Random.RandRange(1, 20)) : TEXT("In Menus"));
+		}
+
+		m_FriendIndices.Add(Friend.SteamID.ConvertToUint64(), i);
+	}
+
+	for (int32 i = 0; i < Config.ClanCount; i++)
+	{
+		FStandInClan& Clan = m_Clans.AddDefaulted_GetRef();
+		Clan.SteamID = CSteamID(2000 + i, k_EUniversePublic, k_EAccountTypeClan);
+
+		const FString Name = MakeName(m_Random);
+		Clan.Name = FSteamStandInBackend::ToUTF8(Name + TEXT(" Guild"));
+		Clan.Tag = FSteamStandInBackend::ToUTF8(Name.Left(4).ToUpper());
+		Clan.bPublic = m_Random.GetFraction() < 0.7f;
+		Clan.bOfficialGameGroup = i == 0;
+
+		for (int32 FriendIndex = 0; FriendIndex < m_Friends.Num(); FriendIndex++)
+		{
+			if (m_Random.GetFraction() < 0.3f)
+			{
+				Clan.Members.Add(FriendIndex);
+			}
+		}
+
+		const int32 OfficerCount = FMath::Min(m_Random.RandRange(1, 3), Clan.Members.Num());
+		for (int32 Officer = 0; Officer < OfficerCount; Officer++)
+		{
+			Clan.Officers.Add(Clan.Members[Officer]);
+		}
+
+		m_ClanIndices.Add(Clan.SteamID.ConvertToUint64(), i);
+	}
+}
+
+const FSteamStandInFriends::FStandInFriend* FSteamStandInFriends::FindFriend(CSteamID SteamID) const
+{
+	const int32* const Index = m_FriendIndices.Find(SteamID.ConvertToUint64());
+	return Index != nullptr ? &m_Friends[*Index] : nullptr;
+}
+
+const FSteamStandInFriends::FStandInClan* FSteamStandInFriends::FindClan(CSteamID SteamID) const
+{
+	const int32* const Index = m_ClanIndices.Find(SteamID.ConvertToUint64());
+	return Index != nullptr ? &m_Clans[*Index] : nullptr;
+}
+
+int32 FSteamStandInFriends::GetOnlineCount(const FStandInClan& Clan) const
+{
+	int32 Online = 0;
+	for (const int32 Member : Clan.Members)
+	{
+		Online += m_Friends[Member].PersonaState != k_EPersonaStateOffline ? 1 : 0;
+	}
+	return Online;
+}
+
+void FSteamStandInFriends::SetFriendRichPresence(FStandInFriend& Friend, const char* Key, const FString& Value)
+{
+	SetValue(Friend.RichPresence, Key, FSteamStandInBackend::ToUTF8(Value).GetData());
+}
+
+int32 FSteamStandInFriends::GetAvatarHandle(CSteamID SteamID, int32 SizeIndex) const
+{
+	const int32* const Index = m_FriendIndices.Find(SteamID.ConvertToUint64());
+	if (Index == nullptr && SteamID != m_LocalSteamID)
+	{
+		return 0;
+	}
+
+	// The local user comes after the friends
+	return ((Index != nullptr ? *Index : m_Friends.Num()) + 1) * 4 + SizeIndex;
+}
+
+bool FSteamStandInFriends::GetAvatar(int32 Image, uint64& SteamID, int32& Size) const
+{
+	const int32 Index = Image / 4 - 1;
+	const int32 SizeIndex = Image % 4;
+	if (Index < 0 || Index > m_Friends.Num() || SizeIndex >= (int32)UE_ARRAY_COUNT(AvatarSizes))
+	{
+		return false;
+	}
+
+	SteamID = (Index < m_Friends.Num() ? m_Friends[Index].SteamID : m_LocalSteamID).ConvertToUint64();
+	Size = AvatarSizes[SizeIndex];
+	return true;
+}
+
+int32 FSteamStandInFriends::CopyMessage(const FStandInChatMessage& Message, void* Dest, int32 DestSize)
+{
+	const int32 Copied = FMath::Min(Message.Text.Num(), DestSize);
+	if (Copied > 0)
+	{
+		FMemory::Memcpy(Dest, Message.Text.GetData(), Copied);
+		((ANSICHAR*)Dest)[Copied - 1] = '\0';
+	}
+	return Copied;
+}
+
+void FSteamStandInFriends::Churn()
+{
+	if (m_Friends.Num() == 0)
+	{
+		return;
+	}
+
+	FStandInFriend& Friend = m_Friends[m_Random.RandHelper(m_Friends.Num())];
+
+	PersonaStateChange_t Change = FSteamStandInBackend::MakePayload<PersonaStateChange_t>();
+	Change.m_ulSteamID = Friend.SteamID.ConvertToUint64();
+
+	const float Roll = m_Random.GetFraction();
+	if (Roll < 0.5f || Friend.PersonaState == k_EPersonaStateOffline)
+	{
+		Friend.PersonaState = MakePersonaState(m_Random);
+		Change.m_nChangeFlags = k_EPersonaChangeStatus;
+
+		if (Friend.PersonaState == k_EPersonaStateOffline)
+		{
+			Change.m_nChangeFlags |= Friend.GameAppID != 0 ? k_EPersonaChangeGamePlayed : 0;
+			Friend.GameAppID = 0;
+			Friend.RichPresence.Reset();
+		}
+		else
+		{
+			SetFriendRichPresence(Friend, "status", TEXT("In Menus"));
+		}
+	}
+	else if (Roll < 0.8f)
+	{
+		Friend.GameAppID = Friend.GameAppID != 0 ? 0 : m_AppID;
+		Change.m_nChangeFlags = k_EPersonaChangeGamePlayed;
+		SetFriendRichPresence(Friend, "status", Friend.GameAppID != 0 ? FString::Printf(TEXT("Playing level %d"), m_Random.RandRange(1, 20)) : TEXT("In Menus"));
+	}
+	else
+	{
+		SetFriendRichPresence(Friend, "status", FString::Printf(TEXT("Playing level %d"), m_Random.RandRange(1, 20)));
+	}
+
+	if (Change.m_nChangeFlags != 0)
+	{
+		m_Backend.Post(Change);
+	}
+
+	FriendRichPresenceUpdate_t Update = FSteamStandInBackend::MakePayload<FriendRichPresenceUpdate_t>();
+	Update.m_steamIDFriend = Friend.SteamID;
+	Update.m_nAppID = m_AppID;
+	m_Backend.Post(Update);
+}
+
+const char* FSteamStandInFriends::GetPersonaName()
+{
+	return m_LocalName.GetData();
+}
+
+SteamAPICall_t FSteamStandInFriends::SetPersonaName(const char* pchPersonaName)
+{
+	m_LocalName = TArray<ANSICHAR>(pchPersonaName, FCStringAnsi::Strlen(pchPersonaName) + 1);
+
+	PersonaStateChange_t Change = FSteamStandInBackend::MakePayload<PersonaStateChange_t>();
+	Change.m_ulSteamID = m_LocalSteamID.ConvertToUint64();
+	Change.m_nChangeFlags = k_EPersonaChangeName;
+	m_Backend.Post(Change);
+
+	SetPersonaNameResponse_t Response = FSteamStandInBackend::MakePayload<SetPersonaNameResponse_t>();
+	Response.m_bSuccess = true;
+	Response.m_bLocalSuccess = true;
+	Response.m_result = k_EResultOK;
+	return m_Backend.PostCallResult(Response);
+}
+
+EPersonaState FSteamStandInFriends::GetPersonaState()
+{
+	return k_EPersonaStateOnline;
+}
+
+int FSteamStandInFriends::GetFriendCount(int iFriendFlags)
+{
+	return (iFriendFlags & k_EFriendFlagImmediate) != 0 ? m_Friends.Num() : 0;
+}
+
+CSteamID FSteamStandInFriends::GetFriendByIndex(int iFriend, int iFriendFlags)
+{
+	return (iFriendFlags & k_EFriendFlagImmediate) != 0 && m_Friends.IsValidIndex(iFriend) ? m_Friends[iFriend].SteamID : k_steamIDNil;
+}
+
+EFriendRelationship FSteamStandInFriends::GetFriendRelationship(CSteamID steamIDFriend)
+{
+	return FindFriend(steamIDFriend) != nullptr ? k_EFriendRelationshipFriend : k_EFriendRelationshipNone;
+}
+
+EPersonaState FSteamStandInFriends::GetFriendPersonaState(CSteamID steamIDFriend)
+{
+	if (steamIDFriend == m_LocalSteamID)
+	{
+		return GetPersonaState();
+	}
+
+	const FStandInFriend* const Friend = FindFriend(steamIDFriend);
+	return Friend != nullptr ? Friend->PersonaState : k_EPersonaStateOffline;
+}
+
+const char* FSteamStandInFriends::GetFriendPersonaName(CSteamID steamIDFriend)
+{
+	if (steamIDFriend == m_LocalSteamID)
+	{
+		return m_LocalName.GetData();
+	}
+
+	const FStandInFriend* const Friend = FindFriend(steamIDFriend);
+	return Friend != nullptr ? Friend->Name.GetData() : "";
+}
+
+bool FSteamStandInFriends::GetFriendGamePlayed(CSteamID steamIDFriend, FriendGameInfo_t* pFriendGameInfo)
+{
+	const FStandInFriend* const Friend = FindFriend(steamIDFriend);
+	if (Friend == nullptr || Friend->GameAppID == 0)
+	{
+		return false;
+	}
+
+	if (pFriendGameInfo != nullptr)
+	{
+		*pFriendGameInfo = FSteamStandInBackend::MakePayload<FriendGameInfo_t>();
+		pFriendGameInfo->m_gameID = CGameID(Friend->GameAppID);
+	}
+	return true;
+}
+
+const char* FSteamStandInFriends::GetFriendPersonaNameHistory(CSteamID steamIDFriend, int iPersonaName)
+{
+	// Nobody has renamed themselves, so the history is just the current name
+	return iPersonaName == 0 ? GetFriendPersonaName(steamIDFriend) : "";
+}
+
+int FSteamStandInFriends::GetFriendSteamLevel(CSteamID steamIDFriend)
+{
+	const FStandInFriend* const Friend = FindFriend(steamIDFriend);
+	return Friend != nullptr ? Friend->SteamLevel : 0;
+}
+
+const char* FSteamStandInFriends::GetPlayerNickname(CSteamID steamIDPlayer)
+{
+	const FStandInFriend* const Friend = FindFriend(steamIDPlayer);
+	return Friend != nullptr && Friend->Nickname.Num() > 0 ? Friend->Nickname.GetData() : nullptr;
+}
+
+int FSteamStandInFriends::GetFriendsGroupCount()
+{
+	return m_GroupNames.Num();
+}
+
+FriendsGroupID_t FSteamStandInFriends::GetFriendsGroupIDByIndex(int iFG)
+{
+	return m_GroupNames.IsValidIndex(iFG) ? (FriendsGroupID_t)(iFG + 1) : k_FriendsGroupID_Invalid;
+}
+
+const char* FSteamStandInFriends::GetFriendsGroupName(FriendsGroupID_t friendsGroupID)
+{
+	return m_GroupNames.IsValidIndex(friendsGroupID - 1) ? m_GroupNames[friendsGroupID - 1].GetData() : nullptr;
+}
+
+int FSteamStandInFriends::GetFriendsGroupMembersCount(FriendsGroupID_t friendsGroupID)
+{
+	int32 Count = 0;
+	for (const FStandInFriend& Friend : m_Friends)
+	{
+		Count += Friend.GroupID == friendsGroupID ? 1 : 0;
+	}
+	return Count;
+}
+
+void FSteamStandInFriends::GetFriendsGroupMembersList(FriendsGroupID_t friendsGroupID, CSteamID* pOutSteamIDMembers, int nMembersCount)
+{
+	int32 Count = 0;
+	for (int32 i = 0; i < m_Friends.Num() && Count < nMembersCount; i++)
+	{
+		if (m_Friends[i].GroupID == friendsGroupID)
+		{
+			pOutSteamIDMembers[Count++] = m_Friends[i].SteamID;
+		}
+	}
+}
+
+bool FSteamStandInFriends::HasFriend(CSteamID steamIDFriend, int iFriendFlags)
+{
+	return (iFriendFlags & k_EFriendFlagImmediate) != 0 && FindFriend(steamIDFriend) != nullptr;
+}
+
+int FSteamStandInFriends::GetClanCount()
+{
+	return m_Clans.Num();
+}
+
+CSteamID FSteamStandInFriends::GetClanByIndex(int iClan)
+{
+	return m_Clans.IsValidIndex(iClan) ? m_Clans[iClan].SteamID : k_steamIDNil;
+}
+
+const char* FSteamStandInFriends::GetClanName(CSteamID steamIDClan)
+{
+	const FStandInClan* const Clan = FindClan(steamIDClan);
+	return Clan != nullptr ? Clan->Name.GetData() : "";
+}
+
+const char* FSteamStandInFriends::GetClanTag(CSteamID steamIDClan)
+{
+	const FStandInClan* const Clan = FindClan(steamIDClan);
+	return Clan != nullptr ? Clan->Tag.GetData() : "";
+}
+
+bool FSteamStandInFriends::GetClanActivityCounts(CSteamID steamIDClan, int* pnOnline, int* pnInGame, int* pnChatting)
+{
+	const FStandInClan* const Clan = FindClan(steamIDClan);
+	if (Clan == nullptr)
+	{
+		return false;
+	}
+
+	int32 InGame = 0;
+	for (const int32 Member : Clan->Members)
+	{
+		InGame += m_Friends[Member].GameAppID != 0 ? 1 : 0;
+	}
+
+	const int32 Online = GetOnlineCount(*Clan);
+	*pnOnline = Online;
+	*pnInGame = InGame;
+	*pnChatting = m_JoinedClanChats.Contains(steamIDClan.ConvertToUint64()) ? Online + 1 : 0;
+	return true;
+}
+
+SteamAPICall_t FSteamStandInFriends::DownloadClanActivityCounts(CSteamID* psteamIDClans, int cClansToRequest)
+{
+	DownloadClanActivityCountsResult_t Result = FSteamStandInBackend::MakePayload<DownloadClanActivityCountsResult_t>();
+	Result.m_bSuccess = true;
+	return m_Backend.PostCallResult(Result);
+}
+
+int FSteamStandInFriends::GetFriendCountFromSource(CSteamID steamIDSource)
+{
+	const FStandInClan* const Clan = FindClan(steamIDSource);
+	return Clan != nullptr ? Clan->Members.Num() : 0;
+}
+
+CSteamID FSteamStandInFriends::GetFriendFromSourceByIndex(CSteamID steamIDSource, int iFriend)
+{
+	const FStandInClan* const Clan = FindClan(steamIDSource);
+	return Clan != nullptr && Clan->Members.IsValidIndex(iFriend) ? m_Friends[Clan->Members[iFriend]].SteamID : k_steamIDNil;
+}
+
+bool FSteamStandInFriends::IsUserInSource(CSteamID steamIDUser, CSteamID steamIDSource)
+{
+	const FStandInClan* const Clan = FindClan(steamIDSource);
+	if (Clan == nullptr)
+	{
+		return false;
+	}
+
+	// The local user is in every clan it can see
+	const int32* const Index = m_FriendIndices.Find(steamIDUser.ConvertToUint64());
+	return steamIDUser == m_LocalSteamID || (Index != nullptr && Clan->Members.Contains(*Index));
+}
+
+void FSteamStandInFriends::SetInGameVoiceSpeaking(CSteamID steamIDUser, bool bSpeaking)
+{
+}
+
+void FSteamStandInFriends::ActivateGameOverlay(const char* pchDialog)
+{
+}
+
+void FSteamStandInFriends::ActivateGameOverlayToUser(const char* pchDialog, CSteamID steamID)
+{
+}
+
+void FSteamStandInFriends::ActivateGameOverlayToWebPage(const char* pchURL, EActivateGameOverlayToWebPageMode eMode)
+{
+}
+
+void FSteamStandInFriends::ActivateGameOverlayToStore(AppId_t nAppID, EOverlayToStoreFlag eFlag)
+{
+}
+
+void FSteamStandInFriends::SetPlayedWith(CSteamID steamIDUserPlayedWith)
+{
+	m_CoplayFriends.AddUnique(steamIDUserPlayedWith);
+}
+
+void FSteamStandInFriends::ActivateGameOverlayInviteDialog(CSteamID steamIDLobby)
+{
+}
+
+int FSteamStandInFriends::GetSmallFriendAvatar(CSteamID steamIDFriend)
+{
+	return GetAvatarHandle(steamIDFriend, 0);
+}
+
+int FSteamStandInFriends::GetMediumFriendAvatar(CSteamID steamIDFriend)
+{
+	return GetAvatarHandle(steamIDFriend, 1);
+}
+
+int FSteamStandInFriends::GetLargeFriendAvatar(CSteamID steamIDFriend)
+{
+	return GetAvatarHandle(steamIDFriend, 2);
+}
+
+bool FSteamStandInFriends::RequestUserInformation(CSteamID steamIDUser, bool bRequireNameOnly)
+{
+	// Friends are always known, like Steam this returns false when there's nothing to wait for
+	if (steamIDUser == m_LocalSteamID || FindFriend(steamIDUser) != nullptr)
+	{
+		return false;
+	}
+
+	PersonaStateChange_t Change = FSteamStandInBackend::MakePayload<PersonaStateChange_t>();
+	Change.m_ulSteamID = steamIDUser.ConvertToUint64();
+	Change.m_nChangeFlags = k_EPersonaChangeName | (bRequireNameOnly ? 0 : k_EPersonaChangeAvatar);
+	m_Backend.Post(Change);
+	return true;
+}
+
+SteamAPICall_t FSteamStandInFriends::RequestClanOfficerList(CSteamID steamIDClan)
+{
+	const FStandInClan* const Clan = FindClan(steamIDClan);
+
+	ClanOfficerListResponse_t Response = FSteamStandInBackend::MakePayload<ClanOfficerListResponse_t>();
+	Response.m_steamIDClan = steamIDClan;
+	Response.m_cOfficers = Clan != nullptr ? Clan->Officers.Num() : 0;
+	Response.m_bSuccess = Clan != nullptr;
+	return m_Backend.PostCallResult(Response);
+}
+
+CSteamID FSteamStandInFriends::GetClanOwner(CSteamID steamIDClan)
+{
+	const FStandInClan* const Clan = FindClan(steamIDClan);
+	return Clan != nullptr && Clan->Officers.Num() > 0 ? m_Friends[Clan->Officers[0]].SteamID : k_steamIDNil;
+}
+
+int FSteamStandInFriends::GetClanOfficerCount(CSteamID steamIDClan)
+{
+	const FStandInClan* const Clan = FindClan(steamIDClan);
+	return Clan != nullptr ? Clan->Officers.Num() : 0;
+}
+
+CSteamID FSteamStandInFriends::GetClanOfficerByIndex(CSteamID steamIDClan, int iOfficer)
+{
+	const FStandInClan* const Clan = FindClan(steamIDClan);
+	return Clan != nullptr && Clan->Officers.IsValidIndex(iOfficer) ? m_Friends[Clan->Officers[iOfficer]].SteamID : k_steamIDNil;
+}
+
+uint32 FSteamStandInFriends::GetUserRestrictions()
+{
+	return k_nUserRestrictionNone;
+}
+
+bool FSteamStandInFriends::SetRichPresence(const char* pchKey, const char* pchValue)
+{
+	if (pchKey == nullptr || FCStringAnsi::Strlen(pchKey) >= k_cchMaxRichPresenceKeyLength)
+	{
+		return false;
+	}
+
+	SetValue(m_LocalRichPresence, pchKey, pchValue);
+	return true;
+}
+
+void FSteamStandInFriends::ClearRichPresence()
+{
+	m_LocalRichPresence.Reset();
+}
+
+const char* FSteamStandInFriends::GetFriendRichPresence(CSteamID steamIDFriend, const char* pchKey)
+{
+	if (steamIDFriend == m_LocalSteamID)
+	{
+		return FindValue(m_LocalRichPresence, pchKey);
+	}
+
+	const FStandInFriend* const Friend = FindFriend(steamIDFriend);
+	return Friend != nullptr ? FindValue(Friend->RichPresence, pchKey) : "";
+}
+
+int FSteamStandInFriends::GetFriendRichPresenceKeyCount(CSteamID steamIDFriend)
+{
+	if (steamIDFriend == m_LocalSteamID)
+	{
+		return m_LocalRichPresence.Num();
+	}
+
+	const FStandInFriend* const Friend = FindFriend(steamIDFriend);
+	return Friend != nullptr ? Friend->RichPresence.Num() : 0;
+}
+
+const char* FSteamStandInFriends::GetFriendRichPresenceKeyByIndex(CSteamID steamIDFriend, int iKey)
+{
+	const FStandInFriend* const Friend = FindFriend(steamIDFriend);
+	const TArray<TPair<TArray<ANSICHAR>, TArray<ANSICHAR>>>* const RichPresence = steamIDFriend == m_LocalSteamID ? &m_LocalRichPresence : (Friend != nullptr ? &Friend->RichPresence : nullptr);
+	return RichPresence != nullptr && RichPresence->IsValidIndex(iKey) ? (*RichPresence)[iKey].Key.GetData() : "";
+}
+
+void FSteamStandInFriends::RequestFriendRichPresence(CSteamID steamIDFriend)
+{
+	FriendRichPresenceUpdate_t Update = FSteamStandInBackend::MakePayload<FriendRichPresenceUpdate_t>();
+	Update.m_steamIDFriend = steamIDFriend;
+	Update.m_nAppID = m_AppID;
+	m_Backend.Post(Update);
+}
+
+bool FSteamStandInFriends::InviteUserToGame(CSteamID steamIDFriend, const char* pchConnectString)
+{
+	return FindFriend(steamIDFriend) != nullptr;
+}
+
+int FSteamStandInFriends::GetCoplayFriendCount()
+{
+	return m_CoplayFriends.Num();
+}
+
+CSteamID FSteamStandInFriends::GetCoplayFriend(int iCoplayFriend)
+{
+	return m_CoplayFriends.IsValidIndex(iCoplayFriend) ? m_CoplayFriends[iCoplayFriend] : k_steamIDNil;
+}
+
+AppId_t FSteamStandInFriends::GetFriendCoplayGame(CSteamID steamIDFriend)
+{
+	return m_CoplayFriends.Contains(steamIDFriend) ? m_AppID : k_uAppIdInvalid;
+}
+
+SteamAPICall_t FSteamStandInFriends::JoinClanChatRoom(CSteamID steamIDClan)
+{
+	const bool bExists = FindClan(steamIDClan) != nullptr;
+	if (bExists)
+	{
+		m_JoinedClanChats.Add(steamIDClan.ConvertToUint64());
+	}
+
+	JoinClanChatRoomCompletionResult_t Result = FSteamStandInBackend::MakePayload<JoinClanChatRoomCompletionResult_t>();
+	Result.m_steamIDClanChat = steamIDClan;
+	Result.m_eChatRoomEnterResponse = bExists ? k_EChatRoomEnterResponseSuccess : k_EChatRoomEnterResponseDoesntExist;
+	return m_Backend.PostCallResult(Result);
+}
+
+bool FSteamStandInFriends::LeaveClanChatRoom(CSteamID steamIDClan)
+{
+	return m_JoinedClanChats.Remove(steamIDClan.ConvertToUint64()) > 0;
+}
+
+int FSteamStandInFriends::GetClanChatMemberCount(CSteamID steamIDClan)
+{
+	const FStandInClan* const Clan = FindClan(steamIDClan);
+	return Clan != nullptr && m_JoinedClanChats.Contains(steamIDClan.ConvertToUint64()) ? GetOnlineCount(*Clan) + 1 : 0;
+}
+
+CSteamID FSteamStandInFriends::GetChatMemberByIndex(CSteamID steamIDClan, int iUser)
+{
+	const FStandInClan* const Clan = FindClan(steamIDClan);
+	if (Clan == nullptr || !m_JoinedClanChats.Contains(steamIDClan.ConvertToUint64()))
+	{
+		return k_steamIDNil;
+	}
+
+	// The local user first, then the members who are online
+	if (iUser == 0)
+	{
+		return m_LocalSteamID;
+	}
+
+	int32 Online = 0;
+	for (const int32 Member : Clan->Members)
+	{
+		if (m_Friends[Member].PersonaState != k_EPersonaStateOffline && ++Online == iUser)
+		{
+			return m_Friends[Member].SteamID;
+		}
+	}
+	return k_steamIDNil;
+}
+
+bool FSteamStandInFriends::SendClanChatMessage(CSteamID steamIDClanChat, const char* pchText)
+{
+	if (!m_JoinedClanChats.Contains(steamIDClanChat.ConvertToUint64()))
+	{
+		return false;
+	}
+
+	TArray<FStandInChatMessage>& Log = m_ChatLogs.FindOrAdd(steamIDClanChat.ConvertToUint64());
+	FStandInChatMessage& Message = Log.AddDefaulted_GetRef();
+	Message.Sender = m_LocalSteamID;
+	Message.Text = TArray<ANSICHAR>(pchText, FCStringAnsi::Strlen(pchText) + 1);
+
+	GameConnectedClanChatMsg_t Received = FSteamStandInBackend::MakePayload<GameConnectedClanChatMsg_t>();
+	Received.m_steamIDClanChat = steamIDClanChat;
+	Received.m_steamIDUser = m_LocalSteamID;
+	Received.m_iMessageID = Log.Num() - 1;
+	m_Backend.Post(Received);
+	return true;
+}
+
+int FSteamStandInFriends::GetClanChatMessage(CSteamID steamIDClanChat, int iMessage, void* prgchText, int cchTextMax, EChatEntryType* peChatEntryType, CSteamID* psteamidChatter)
+{
+	const TArray<FStandInChatMessage>* const Log = m_ChatLogs.Find(steamIDClanChat.ConvertToUint64());
+	if (Log == nullptr || !Log->IsValidIndex(iMessage))
+	{
+		return 0;
+	}
+
+	*peChatEntryType = k_EChatEntryTypeChatMsg;
+	*psteamidChatter = (*Log)[iMessage].Sender;
+	return CopyMessage((*Log)[iMessage], prgchText, cchTextMax);
+}
+
+bool FSteamStandInFriends::IsClanChatAdmin(CSteamID steamIDClanChat, CSteamID steamIDUser)
+{
+	const FStandInClan* const Clan = FindClan(steamIDClanChat);
+	const int32* const Index = m_FriendIndices.Find(steamIDUser.ConvertToUint64());
+	return Clan != nullptr && Index != nullptr && Clan->Officers.Contains(*Index);
+}
+
+bool FSteamStandInFriends::IsClanChatWindowOpenInSteam(CSteamID steamIDClanChat)
+{
+	return false;
+}
+
+bool FSteamStandInFriends::OpenClanChatWindowInSteam(CSteamID steamIDClanChat)
+{
+	return false;
+}
+
+bool FSteamStandInFriends::CloseClanChatWindowInSteam(CSteamID steamIDClanChat)
+{
+	return false;
+}
+
+bool FSteamStandInFriends::SetListenForFriendsMessages(bool bInterceptEnabled)
+{
+	m_bListenForFriendsMessages = bInterceptEnabled;
+	return true;
+}
+
+bool FSteamStandInFriends::ReplyToFriendMessage(CSteamID steamIDFriend, const char* pchMsgToSend)
+{
+	const FStandInFriend* const Friend = FindFriend(steamIDFriend);
+	if (Friend == nullptr || Friend->PersonaState == k_EPersonaStateOffline)
+	{
+		return false;
+	}
+
+	// Friends echo whatever they're sent, so both directions of a conversation can be exercised
+	TArray<FStandInChatMessage>& Log = m_ChatLogs.FindOrAdd(steamIDFriend.ConvertToUint64());
+	const CSteamID Senders[] = {m_LocalSteamID, steamIDFriend};
+	for (const CSteamID& Sender : Senders)
+	{
+		FStandInChatMessage& Message = Log.AddDefaulted_GetRef();
+		Message.Sender = Sender;
+		Message.Text = TArray<ANSICHAR>(pchMsgToSend, FCStringAnsi::Strlen(pchMsgToSend) + 1);
+
+		if (m_bListenForFriendsMessages)
+		{
+			GameConnectedFriendChatMsg_t Received = FSteamStandInBackend::MakePayload<GameConnectedFriendChatMsg_t>();
+			Received.m_steamIDUser = steamIDFriend;
+			Received.m_iMessageID = Log.Num() - 1;
+			m_Backend.Post(Received);
+		}
+	}
+	return true;
+}
+
+int FSteamStandInFriends::GetFriendMessage(CSteamID steamIDFriend, int iMessageID, void* pvData, int cubData, EChatEntryType* peChatEntryType)
+{
+	const TArray<FStandInChatMessage>* const Log = m_ChatLogs.Find(steamIDFriend.ConvertToUint64());
+	if (Log == nullptr || !Log->IsValidIndex(iMessageID))
+	{
+		return 0;
+	}
+
+	*peChatEntryType = k_EChatEntryTypeChatMsg;
+	return CopyMessage((*Log)[iMessageID], pvData, cubData);
+}
+
+SteamAPICall_t FSteamStandInFriends::GetFollowerCount(CSteamID steamID)
+{
+	FriendsGetFollowerCount_t Result = FSteamStandInBackend::MakePayload<FriendsGetFollowerCount_t>();
+	Result.m_eResult = k_EResultOK;
+	Result.m_steamID = steamID;
+	Result.m_nCount = GetTypeHash(steamID.ConvertToUint64()) % 1000;
+	return m_Backend.PostCallResult(Result);
+}
+
+SteamAPICall_t FSteamStandInFriends::IsFollowing(CSteamID steamID)
+{
+	// Every other friend is followed
+	const int32* const Index = m_FriendIndices.Find(steamID.ConvertToUint64());
+
+	FriendsIsFollowing_t Result = FSteamStandInBackend::MakePayload<FriendsIsFollowing_t>();
+	Result.m_eResult = k_EResultOK;
+	Result.m_steamID = steamID;
+	Result.m_bIsFollowing = Index != nullptr && *Index % 2 == 0;
+	return m_Backend.PostCallResult(Result);
+}
+
+SteamAPICall_t FSteamStandInFriends::EnumerateFollowingList(uint32 unStartIndex)
+{
+	FriendsEnumerateFollowingList_t Result = FSteamStandInBackend::MakePayload<FriendsEnumerateFollowingList_t>();
+	Result.m_eResult = k_EResultOK;
+	Result.m_nTotalResultCount = (m_Friends.Num() + 1) / 2;
+
+	for (int32 i = unStartIndex * 2; i < m_Friends.Num() && Result.m_nResultsReturned < k_cEnumerateFollowersMax; i += 2)
+	{
+		Result.m_rgSteamID[Result.m_nResultsReturned++] = m_Friends[i].SteamID;
+	}
+	return m_Backend.PostCallResult(Result);
+}
+
+bool FSteamStandInFriends::IsClanPublic(CSteamID steamIDClan)
+{
+	const FStandInClan* const Clan = FindClan(steamIDClan);
+	return Clan != nullptr && Clan->bPublic;
+}
+
+bool FSteamStandInFriends::IsClanOfficialGameGroup(CSteamID steamIDClan)
+{
+	const FStandInClan* const Clan = FindClan(steamIDClan);
+	return Clan != nullptr && Clan->bOfficialGameGroup;
+}
+
+// Auth
+
+HAuthTicket FSteamStandInAuth::GetAuthSessionTicket(CSteamID Owner, void* pTicket, int cbMaxTicket, uint32* pcbTicket, bool bGameServer)
+{
+	if (pTicket == nullptr || cbMaxTicket < (int)sizeof(FStandInTicket))
+	{
+		*pcbTicket = 0;
+		return k_HAuthTicketInvalid;
+	}
+
+	FStandInTicket Ticket;
+	Ticket.SteamID = Owner.ConvertToUint64();
+	Ticket.Ticket = m_NextTicket++;
+	Ticket.Magic = TicketMagic;
+	FMemory::Memcpy(pTicket, &Ticket, sizeof(Ticket));
+	*pcbTicket = sizeof(Ticket);
+
+	m_ActiveTickets.Add(Ticket.Ticket);
+
+	GetAuthSessionTicketResponse_t Response = FSteamStandInBackend::MakePayload<GetAuthSessionTicketResponse_t>();
+	Response.m_hAuthTicket = Ticket.Ticket;
+	Response.m_eResult = k_EResultOK;
+	m_Backend.Post(Response, bGameServer);
+
+	return Ticket.Ticket;
+}
+
+EBeginAuthSessionResult FSteamStandInAuth::BeginAuthSession(const void* pAuthTicket, int cbAuthTicket, CSteamID steamID, bool bGameServer)
+{
+	if (pAuthTicket == nullptr || cbAuthTicket != (int)sizeof(FStandInTicket))
+	{
+		return k_EBeginAuthSessionResultInvalidTicket;
+	}
+
+	FStandInTicket Ticket;
+	FMemory::Memcpy(&Ticket, pAuthTicket, sizeof(Ticket));
+	if (Ticket.Magic != TicketMagic || Ticket.SteamID != steamID.ConvertToUint64())
+	{
+		return k_EBeginAuthSessionResultInvalidTicket;
+	}
+
+	TMap<uint64, HAuthTicket>& Sessions = m_Sessions[bGameServer ? 1 : 0];
+	if (Sessions.Contains(Ticket.SteamID))
+	{
+		return k_EBeginAuthSessionResultDuplicateRequest;
+	}
+	Sessions.Add(Ticket.SteamID, Ticket.Ticket);
+
+	ValidateAuthTicketResponse_t Response = FSteamStandInBackend::MakePayload<ValidateAuthTicketResponse_t>();
+	Response.m_SteamID = steamID;
+	Response.m_eAuthSessionResponse = m_ActiveTickets.Contains(Ticket.Ticket) ? k_EAuthSessionResponseOK : k_EAuthSessionResponseAuthTicketCanceled;
+	Response.m_OwnerSteamID = steamID;
+	m_Backend.Post(Response, bGameServer);
+
+	return k_EBeginAuthSessionResultOK;
+}
+
+void FSteamStandInAuth::EndAuthSession(CSteamID steamID, bool bGameServer)
+{
+	m_Sessions[bGameServer ? 1 : 0].Remove(steamID.ConvertToUint64());
+}
+
+void FSteamStandInAuth::CancelAuthTicket(HAuthTicket hAuthTicket)
+{
+	if (m_ActiveTickets.Remove(hAuthTicket) == 0)
+	{
+		return;
+	}
+
+	// Whoever validated the ticket is told it has been canceled
+	for (int32 Side = 0; Side < (int32)UE_ARRAY_COUNT(m_Sessions); Side++)
+	{
+		for (const TPair<uint64, HAuthTicket>& Session : m_Sessions[Side])
+		{
+			if (Session.Value == hAuthTicket)
+			{
+				ValidateAuthTicketResponse_t Response = FSteamStandInBackend::MakePayload<ValidateAuthTicketResponse_t>();
+				Response.m_SteamID = Session.Key;
+				Response.m_eAuthSessionResponse = k_EAuthSessionResponseAuthTicketCanceled;
+				Response.m_OwnerSteamID = Session.Key;
+				m_Backend.Post(Response, Side == 1);
+			}
+		}
+	}
+}
+
+EUserHasLicenseForAppResult FSteamStandInAuth::UserHasLicenseForApp(CSteamID steamID, bool bGameServer) const
+{
+	return m_Sessions[bGameServer ? 1 : 0].Contains(steamID.ConvertToUint64()) ? k_EUserHasLicenseResultHasLicense : k_EUserHasLicenseResultNoAuth;
+}
+
+// User
+
+FSteamStandInUser::FSteamStandInUser(FSteamStandInBackend& Backend, FSteamStandInAuth& Auth, CSteamID SteamID, const FSteamStandInConfig& Config) :
+	m_Backend(Backend),
+	m_Auth(Auth),
+	m_SteamID(SteamID),
+	m_AppID(Config.AppID),
+	m_bRecordingVoice(false)
+{
+}
+
+HSteamUser FSteamStandInUser::GetHSteamUser()
+{
+	return 1;
+}
+
+bool FSteamStandInUser::BLoggedOn()
+{
+	return true;
+}
+
+CSteamID FSteamStandInUser::GetSteamID()
+{
+	return m_SteamID;
+}
+
+int FSteamStandInUser::InitiateGameConnection(void* pAuthBlob, int cbMaxAuthBlob, CSteamID steamIDGameServer, uint32 unIPServer, uint16 usPortServer, bool bSecure)
+{
+	const uint64 SteamID = GetSteamID().ConvertToUint64();
+	if (pAuthBlob == nullptr || cbMaxAuthBlob < (int)sizeof(SteamID))
+	{
+		return 0;
+	}
+
+	FMemory::Memcpy(pAuthBlob, &SteamID, sizeof(SteamID));
+	return sizeof(SteamID);
+}
+
+void FSteamStandInUser::TerminateGameConnection(uint32 unIPServer, uint16 usPortServer)
+{
+}
+
+void FSteamStandInUser::StartVoiceRecording()
+{
+	m_bRecordingVoice = true;
+}
+
+void FSteamStandInUser::StopVoiceRecording()
+{
+	m_bRecordingVoice = false;
+}
+
+EVoiceResult FSteamStandInUser::GetAvailableVoice(uint32* pcbCompressed)
+{
+	// Nobody is talking into the stand-in
+	*pcbCompressed = 0;
+	return m_bRecordingVoice ? k_EVoiceResultNoData : k_EVoiceResultNotRecording;
+}
+
+EVoiceResult FSteamStandInUser::GetVoice(bool bWantCompressed, void* pDestBuffer, uint32 cbDestBufferSize, uint32* nBytesWritten)
+{
+	*nBytesWritten = 0;
+	return m_bRecordingVoice ? k_EVoiceResultNoData : k_EVoiceResultNotRecording;
+}
+
+EVoiceResult FSteamStandInUser::DecompressVoice(const void* pCompressed, uint32 cbCompressed, void* pDestBuffer, uint32 cbDestBufferSize, uint32* nBytesWritten, uint32 nDesiredSampleRate)
+{
+	if (pCompressed == nullptr || cbCompressed == 0)
+	{
+		*nBytesWritten = 0;
+		return k_EVoiceResultNoData;
+	}
+
+	// Every packet decompresses to 20ms of 16 bit mono silence
+	const uint32 Needed = nDesiredSampleRate / 50 * sizeof(int16);
+	*nBytesWritten = Needed;
+	if (cbDestBufferSize < Needed)
+	{
+		return k_EVoiceResultBufferTooSmall;
+	}
+
+	FMemory::Memzero(pDestBuffer, Needed);
+	return k_EVoiceResultOK;
+}
+
+uint32 FSteamStandInUser::GetVoiceOptimalSampleRate()
+{
+	return 24000;
+}
+
+HAuthTicket FSteamStandInUser::GetAuthSessionTicket(void* pTicket, int cbMaxTicket, uint32* pcbTicket)
+{
+	return m_Auth.GetAuthSessionTicket(GetSteamID(), pTicket, cbMaxTicket, pcbTicket, false);
+}
+
+EBeginAuthSessionResult FSteamStandInUser::BeginAuthSession(const void* pAuthTicket, int cbAuthTicket, CSteamID steamID)
+{
+	return m_Auth.BeginAuthSession(pAuthTicket, cbAuthTicket, steamID, false);
+}
+
+void FSteamStandInUser::EndAuthSession(CSteamID steamID)
+{
+	m_Auth.EndAuthSession(steamID, false);
+}
+
+void FSteamStandInUser::CancelAuthTicket(HAuthTicket hAuthTicket)
+{
+	m_Auth.CancelAuthTicket(hAuthTicket);
+}
+
+EUserHasLicenseForAppResult FSteamStandInUser::UserHasLicenseForApp(CSteamID steamID, AppId_t appID)
+{
+	return appID == m_AppID ? m_Auth.UserHasLicenseForApp(steamID, false) : k_EUserHasLicenseResultDoesNotHaveLicense;
+}
+
+bool FSteamStandInUser::BIsBehindNAT()
+{
+	return false;
+}
+
+void FSteamStandInUser::AdvertiseGame(CSteamID steamIDGameServer, uint32 unIPServer, uint16 usPortServer)
+{
+}
+
+bool FSteamStandInUser::GetEncryptedAppTicket(void* pTicket, int cbMaxTicket, uint32* pcbTicket)
+{
+	// There's no encrypted app ticket without the app's secret key
+	*pcbTicket = 0;
+	return false;
+}
+
+int FSteamStandInUser::GetGameBadgeLevel(int nSeries, bool bFoil)
+{
+	return 0;
+}
+
+int FSteamStandInUser::GetPlayerSteamLevel()
+{
+	return 10;
+}
+
+bool FSteamStandInUser::BIsPhoneVerified()
+{
+	return false;
+}
+
+bool FSteamStandInUser::BIsTwoFactorEnabled()
+{
+	return false;
+}
+
+bool FSteamStandInUser::BIsPhoneIdentifying()
+{
+	return false;
+}
+
+bool FSteamStandInUser::BIsPhoneRequiringVerification()
+{
+	return false;
+}
+
+SteamAPICall_t FSteamStandInUser::GetDurationControl()
+{
+	DurationControl_t Result = FSteamStandInBackend::MakePayload<DurationControl_t>();
+	Result.m_eResult = k_EResultOK;
+	Result.m_appid = m_AppID;
+	return m_Backend.PostCallResult(Result);
+}
+
+// Game server
+
+FSteamStandInGameServer::FSteamStandInGameServer(FSteamStandInBackend& Backend, FSteamStandInAuth& Auth, const FSteamStandInConfig& Config) :
+	m_Backend(Backend),
+	m_Auth(Auth),
+	m_AppID(Config.AppID),
+	m_bLoggedOn(false)
+{
+}
+
+void FSteamStandInGameServer::SetLoggedOn()
+{
+	m_bLoggedOn = true;
+	m_Backend.Post(FSteamStandInBackend::MakePayload<SteamServersConnected_t>(), true);
+}
+
+void FSteamStandInGameServer::SetProduct(const char* pszProduct)
+{
+}
+
+void FSteamStandInGameServer::SetGameDescription(const char* pszGameDescription)
+{
+}
+
+void FSteamStandInGameServer::SetModDir(const char* pszModDir)
+{
+}
+
+void FSteamStandInGameServer::SetDedicatedServer(bool bDedicated)
+{
+}
+
+void FSteamStandInGameServer::LogOn(const char* pszToken)
+{
+	m_SteamID = CSteamID(3000, k_EUniversePublic, k_EAccountTypeGameServer);
+	SetLoggedOn();
+}
+
+void FSteamStandInGameServer::LogOnAnonymous()
+{
+	m_SteamID = CSteamID(3000, k_EUniversePublic, k_EAccountTypeAnonGameServer);
+	SetLoggedOn();
+}
+
+void FSteamStandInGameServer::LogOff()
+{
+	if (!m_bLoggedOn)
+	{
+		return;
+	}
+
+	m_bLoggedOn = false;
+
+	SteamServersDisconnected_t Disconnected = FSteamStandInBackend::MakePayload<SteamServersDisconnected_t>();
+	Disconnected.m_eResult = k_EResultOK;
+	m_Backend.Post(Disconnected, true);
+}
+
+bool FSteamStandInGameServer::BLoggedOn()
+{
+	return m_bLoggedOn;
+}
+
+bool FSteamStandInGameServer::BSecure()
+{
+	return m_bLoggedOn;
+}
+
+CSteamID FSteamStandInGameServer::GetSteamID()
+{
+	return m_bLoggedOn ? m_SteamID : k_steamIDNil;
+}
+
+bool FSteamStandInGameServer::WasRestartRequested()
+{
+	return false;
+}
+
+void FSteamStandInGameServer::SetMaxPlayerCount(int cPlayersMax)
+{
+}
+
+void FSteamStandInGameServer::SetBotPlayerCount(int cBotplayers)
+{
+}
+
+void FSteamStandInGameServer::SetServerName(const char* pszServerName)
+{
+}
+
+void FSteamStandInGameServer::SetMapName(const char* pszMapName)
+{
+}
+
+void FSteamStandInGameServer::SetPasswordProtected(bool bPasswordProtected)
+{
+}
+
+void FSteamStandInGameServer::SetSpectatorPort(uint16 unSpectatorPort)
+{
+}
+
+void FSteamStandInGameServer::SetSpectatorServerName(const char* pszSpectatorServerName)
+{
+}
+
+void FSteamStandInGameServer::ClearAllKeyValues()
+{
+	m_KeyValues.Reset();
+}
+
+void FSteamStandInGameServer::SetKeyValue(const char* pKey, const char* pValue)
+{
+	SetValue(m_KeyValues, pKey, pValue);
+}
+
+void FSteamStandInGameServer::SetGameTags(const char* pchGameTags)
+{
+}
+
+void FSteamStandInGameServer::SetGameData(const char* pchGameData)
+{
+}
+
+void FSteamStandInGameServer::SetRegion(const char* pszRegion)
+{
+}
+
+HAuthTicket FSteamStandInGameServer::GetAuthSessionTicket(void* pTicket, int cbMaxTicket, uint32* pcbTicket)
+{
+	return m_Auth.GetAuthSessionTicket(GetSteamID(), pTicket, cbMaxTicket, pcbTicket, true);
+}
+
+EBeginAuthSessionResult FSteamStandInGameServer::BeginAuthSession(const void* pAuthTicket, int cbAuthTicket, CSteamID steamID)
+{
+	return m_Auth.BeginAuthSession(pAuthTicket, cbAuthTicket, steamID, true);
+}
+
+void FSteamStandInGameServer::EndAuthSession(CSteamID steamID)
+{
+	m_Auth.EndAuthSession(steamID, true);
+}
+
+void FSteamStandInGameServer::CancelAuthTicket(HAuthTicket hAuthTicket)
+{
+	m_Auth.CancelAuthTicket(hAuthTicket);
+}
+
+EUserHasLicenseForAppResult FSteamStandInGameServer::UserHasLicenseForApp(CSteamID steamID, AppId_t appID)
+{
+	return appID == m_AppID ? m_Auth.UserHasLicenseForApp(steamID, true) : k_EUserHasLicenseResultDoesNotHaveLicense;
+}
+
+bool FSteamStandInGameServer::RequestUserGroupStatus(CSteamID steamIDUser, CSteamID steamIDGroup)
+{
+	ISteamBridgeFriends* const Friends = m_Backend.Friends();
+
+	GSClientGroupStatus_t Status = FSteamStandInBackend::MakePayload<GSClientGroupStatus_t>();
+	Status.m_SteamIDUser = steamIDUser;
+	Status.m_SteamIDGroup = steamIDGroup;
+	Status.m_bMember = Friends->IsUserInSource(steamIDUser, steamIDGroup);
+	Status.m_bOfficer = Friends->IsClanChatAdmin(steamIDGroup, steamIDUser);
+	m_Backend.Post(Status, true);
+	return true;
+}
+
+void FSteamStandInGameServer::EnableHeartbeats(bool bActive)
+{
+}
+
+void FSteamStandInGameServer::SetHeartbeatInterval(int iHeartbeatInterval)
+{
+}
+
+void FSteamStandInGameServer::ForceHeartbeat()
+{
+}
+
+SteamAPICall_t FSteamStandInGameServer::AssociateWithClan(CSteamID steamIDClan)
+{
+	AssociateWithClanResult_t Result = FSteamStandInBackend::MakePayload<AssociateWithClanResult_t>();
+	Result.m_eResult = m_bLoggedOn ? k_EResultOK : k_EResultNotLoggedOn;
+	return m_Backend.PostCallResult(Result, true);
+}
+
+// HTTP
+
+static const TCHAR* GetMethodName(EHTTPMethod Method)
+{
+	switch (Method)
+	{
+	case k_EHTTPMethodGET: return TEXT("GET");
+	case k_EHTTPMethodHEAD: return TEXT("HEAD");
+	case k_EHTTPMethodPOST: return TEXT("POST");
+	case k_EHTTPMethodPUT: return TEXT("PUT");
+	case k_EHTTPMethodDELETE: return TEXT("DELETE");
+	case k_EHTTPMethodOPTIONS: return TEXT("OPTIONS");
+	case k_EHTTPMethodPATCH: return TEXT("PATCH");
+	default: return TEXT("INVALID");
+	}
+}
+
+static FString EscapeJson(const FString& String)
+{
+	return String.Replace(TEXT("\\"), TEXT("\\\\")).Replace(TEXT("\""), TEXT("\\\"")).Replace(TEXT("\n"), TEXT("\\n"));
+}
+
+static FString ToJsonObject(const TArray<TPair<FString, FString>>& KeyValues)
+{
+	TArray<FString> Fields;
+	for (const TPair<FString, FString>& KeyValue : KeyValues)
+	{
+		Fields.Add(FString::Printf(TEXT("\"%s\":\"%s\""), *EscapeJson(KeyValue.Key), *EscapeJson(KeyValue.Value)));
+	}
+	return TEXT("{") + FString::Join(Fields, TEXT(",")) + TEXT("}");
+}
+
+void FSteamStandInHTTP::Respond(FStandInRequest& Request, const TArray<FString>& Cookies)
+{
+	// Strip the scheme and host
+	FString Path = Request.URL;
+	const int32 SchemeEnd = Path.Find(TEXT("://"));
+	if (SchemeEnd != INDEX_NONE)
+	{
+		const int32 PathStart = Path.Find(TEXT("/"), ESearchCase::CaseSensitive, ESearchDir::FromStart, SchemeEnd + 3);
+		Path = PathStart != INDEX_NONE ? Path.Mid(PathStart) : TEXT("/");
+	}
+
+	int32 StatusCode = k_EHTTPStatusCode200OK;
+	if (Path.StartsWith(TEXT("/status/")))
+	{
+		StatusCode = FCString::Atoi(*Path.Mid(8));
+	}
+
+	TArray<FString> QuotedCookies;
+	for (const FString& Cookie : Cookies)
+	{
+		QuotedCookies.Add(TEXT("\"") + EscapeJson(Cookie) + TEXT("\""));
+	}
+
+	const FString Json = FString::Printf(TEXT("{\"method\":\"%s\",\"url\":\"%s\",\"args\":%s,\"headers\":%s,\"cookies\":[%s],\"body\":\"%s\"}"),
+		GetMethodName(Request.Method), *EscapeJson(Request.URL), *ToJsonObject(Request.Parameters), *ToJsonObject(Request.Headers), *FString::Join(QuotedCookies, TEXT(",")),
+		*EscapeJson(FString(Request.Body.Num(), (const ANSICHAR*)Request.Body.GetData())));
+
+	const FTCHARToUTF8 Converter(*Json);
+	Request.StatusCode = (EHTTPStatusCode)StatusCode;
+	Request.ResponseBody.Reset();
+	if (Request.Method != k_EHTTPMethodHEAD)
+	{
+		Request.ResponseBody.Append((const uint8*)Converter.Get(), Converter.Length());
+	}
+
+	Request.ResponseHeaders.Reset();
+	Request.ResponseHeaders.Emplace(TEXT("Content-Type"), TEXT("application/json"));
+	Request.ResponseHeaders.Emplace(TEXT("Content-Length"), FString::FromInt(Request.ResponseBody.Num()));
+}
+
+bool FSteamStandInHTTP::Send(HTTPRequestHandle hRequest, SteamAPICall_t* pCallHandle, bool bStream)
+{
+	FStandInRequest* const Request = m_Requests.Find(hRequest);
+	if (Request == nullptr || Request->bSent)
+	{
+		return false;
+	}
+
+	const TArray<FString>* const Cookies = m_CookieContainers.Find(Request->CookieContainer);
+	Respond(*Request, Cookies != nullptr ? *Cookies : TArray<FString>());
+	Request->bSent = true;
+
+	if (bStream)
+	{
+		HTTPRequestHeadersReceived_t HeadersReceived = FSteamStandInBackend::MakePayload<HTTPRequestHeadersReceived_t>();
+		HeadersReceived.m_hRequest = hRequest;
+		HeadersReceived.m_ulContextValue = Request->ContextValue;
+		m_Backend.Post(HeadersReceived);
+
+		HTTPRequestDataReceived_t DataReceived = FSteamStandInBackend::MakePayload<HTTPRequestDataReceived_t>();
+		DataReceived.m_hRequest = hRequest;
+		DataReceived.m_ulContextValue = Request->ContextValue;
+		DataReceived.m_cOffset = 0;
+		DataReceived.m_cBytesReceived = Request->ResponseBody.Num();
+		m_Backend.Post(DataReceived);
+	}
+
+	HTTPRequestCompleted_t Completed = FSteamStandInBackend::MakePayload<HTTPRequestCompleted_t>();
+	Completed.m_hRequest = hRequest;
+	Completed.m_ulContextValue = Request->ContextValue;
+	Completed.m_bRequestSuccessful = true;
+	Completed.m_eStatusCode = Request->StatusCode;
+	Completed.m_unBodySize = Request->ResponseBody.Num();
+
+	const SteamAPICall_t APICall = m_Backend.PostCallResult(Completed);
+	if (pCallHandle != nullptr)
+	{
+		*pCallHandle = APICall;
+	}
+	return true;
+}
+
+const FString* FSteamStandInHTTP::FindResponseHeader(HTTPRequestHandle hRequest, const char* pchHeaderName) const
+{
+	const FStandInRequest* const Request = m_Requests.Find(hRequest);
+	if (Request == nullptr || !Request->bSent)
+	{
+		return nullptr;
+	}
+
+	const FString HeaderName = UTF8_TO_TCHAR(pchHeaderName);
+	for (const TPair<FString, FString>& Header : Request->ResponseHeaders)
+	{
+		if (Header.Key == HeaderName)
+		{
+			return &Header.Value;
+		}
+	}
+	return nullptr;
+}
+
+HTTPRequestHandle FSteamStandInHTTP::CreateHTTPRequest(EHTTPMethod eHTTPRequestMethod, const char* pchAbsoluteURL)
+{
+	if (pchAbsoluteURL == nullptr || FCStringAnsi::Strnicmp(pchAbsoluteURL, "http", 4) != 0)
+	{
+		return INVALID_HTTPREQUEST_HANDLE;
+	}
+
+	const HTTPRequestHandle Handle = m_NextRequest++;
+	FStandInRequest& Request = m_Requests.Add(Handle);
+	Request.Method = eHTTPRequestMethod;
+	Request.URL = UTF8_TO_TCHAR(pchAbsoluteURL);
+	return Handle;
+}
+
+bool FSteamStandInHTTP::SetHTTPRequestContextValue(HTTPRequestHandle hRequest, uint64 ulContextValue)
+{
+	FStandInRequest* const Request = m_Requests.Find(hRequest);
+	if (Request == nullptr)
+	{
+		return false;
+	}
+
+	Request->ContextValue = ulContextValue;
+	return true;
+}
+
+bool FSteamStandInHTTP::SetHTTPRequestNetworkActivityTimeout(HTTPRequestHandle hRequest, uint32 unTimeoutSeconds)
+{
+	return m_Requests.Contains(hRequest);
+}
+
+bool FSteamStandInHTTP::SetHTTPRequestHeaderValue(HTTPRequestHandle hRequest, const char* pchHeaderName, const char* pchHeaderValue)
+{
+	FStandInRequest* const Request = m_Requests.Find(hRequest);
+	if (Request == nullptr || Request->bSent)
+	{
+		return false;
+	}
+
+	Request->Headers.Emplace(UTF8_TO_TCHAR(pchHeaderName), UTF8_TO_TCHAR(pchHeaderValue));
+	return true;
+}
+
+bool FSteamStandInHTTP::SetHTTPRequestGetOrPostParameter(HTTPRequestHandle hRequest, const char* pchParamName, const char* pchParamValue)
+{
+	FStandInRequest* const Request = m_Requests.Find(hRequest);
+	if (Request == nullptr || Request->bSent)
+	{
+		return false;
+	}
+
+	Request->Parameters.Emplace(UTF8_TO_TCHAR(pchParamName), UTF8_TO_TCHAR(pchParamValue));
+	return true;
+}
+
+bool FSteamStandInHTTP::SendHTTPRequest(HTTPRequestHandle hRequest, SteamAPICall_t* pCallHandle)
+{
+	return Send(hRequest, pCallHandle, false);
+}
+
+bool FSteamStandInHTTP::SendHTTPRequestAndStreamResponse(HTTPRequestHandle hRequest, SteamAPICall_t* pCallHandle)
+{
+	return Send(hRequest, pCallHandle, true);
+}
+
+bool FSteamStandInHTTP::DeferHTTPRequest(HTTPRequestHandle hRequest)
+{
+	return m_Requests.Contains(hRequest);
+}
+
+bool FSteamStandInHTTP::PrioritizeHTTPRequest(HTTPRequestHandle hRequest)
+{
+	return m_Requests.Contains(hRequest);
+}
+
+bool FSteamStandInHTTP::GetHTTPResponseHeaderSize(HTTPRequestHandle hRequest, const char* pchHeaderName, uint32* unResponseHeaderSize)
+{
+	const FString* const Value = FindResponseHeader(hRequest, pchHeaderName);
+	if (Value == nullptr)
+	{
+		return false;
+	}
+
+	*unResponseHeaderSize = FTCHARToUTF8(**Value).Length() + 1;
+	return true;
+}
+
+bool FSteamStandInHTTP::GetHTTPResponseHeaderValue(HTTPRequestHandle hRequest, const char* pchHeaderName, uint8* pHeaderValueBuffer, uint32 unBufferSize)
+{
+	const FString* const Value = FindResponseHeader(hRequest, pchHeaderName);
+	if (Value == nullptr)
+	{
+		return false;
+	}
+
+	const FTCHARToUTF8 Converter(**Value);
+	if (unBufferSize < (uint32)Converter.Length() + 1)
+	{
+		return false;
+	}
+
+	FMemory::Memcpy(pHeaderValueBuffer, Converter.Get(), Converter.Length());
+	pHeaderValueBuffer[Converter.Length()] = '\0';
+	return true;
+}
+
+bool FSteamStandInHTTP::GetHTTPResponseBodySize(HTTPRequestHandle hRequest, uint32* unBodySize)
+{
+	const FStandInRequest* const Request = m_Requests.Find(hRequest);
+	if (Request == nullptr || !Request->bSent)
+	{
+		return false;
+	}
+
+	*unBodySize = Request->ResponseBody.Num();
+	return true;
+}
+
+bool FSteamStandInHTTP::GetHTTPResponseBodyData(HTTPRequestHandle hRequest, uint8* pBodyDataBuffer, uint32 unBufferSize)
+{
+	const FStandInRequest* const Request = m_Requests.Find(hRequest);
+	if (Request == nullptr || !Request->bSent || unBufferSize != (uint32)Request->ResponseBody.Num())
+	{
+		return false;
+	}
+
+	FMemory::Memcpy(pBodyDataBuffer, Request->ResponseBody.GetData(), unBufferSize);
+	return true;
+}
+
+bool FSteamStandInHTTP::GetHTTPStreamingResponseBodyData(HTTPRequestHandle hRequest, uint32 cOffset, uint8* pBodyDataBuffer, uint32 unBufferSize)
+{
+	const FStandInRequest* const Request = m_Requests.Find(hRequest);
+	if (Request == nullptr || !Request->bSent || (uint64)cOffset + unBufferSize > (uint64)Request->ResponseBody.Num())
+	{
+		return false;
+	}
+
+	FMemory::Memcpy(pBodyDataBuffer, Request->ResponseBody.GetData() + cOffset, unBufferSize);
+	return true;
+}
+
+bool FSteamStandInHTTP::ReleaseHTTPRequest(HTTPRequestHandle hRequest)
+{
+	return m_Requests.Remove(hRequest) > 0;
+}
+
+bool FSteamStandInHTTP::GetHTTPDownloadProgressPct(HTTPRequestHandle hRequest, float* pflPercentOut)
+{
+	const FStandInRequest* const Request = m_Requests.Find(hRequest);
+	if (Request == nullptr)
+	{
+		return false;
+	}
+
+	*pflPercentOut = Request->bSent ? 100.0f : 0.0f;
+	return true;
+}
+
+bool FSteamStandInHTTP::SetHTTPRequestRawPostBody(HTTPRequestHandle hRequest, const char* pchContentType, uint8* pubBody, uint32 unBodyLen)
+{
+	FStandInRequest* const Request = m_Requests.Find(hRequest);
+	if (Request == nullptr || Request->bSent)
+	{
+		return false;
+	}
+
+	Request->ContentType = UTF8_TO_TCHAR(pchContentType);
+	Request->Body = TArray<uint8>(pubBody, unBodyLen);
+	return true;
+}
+
+HTTPCookieContainerHandle FSteamStandInHTTP::CreateCookieContainer(bool bAllowResponsesToModify)
+{
+	const HTTPCookieContainerHandle Handle = m_NextCookieContainer++;
+	m_CookieContainers.Add(Handle);
+	return Handle;
+}
+
+bool FSteamStandInHTTP::ReleaseCookieContainer(HTTPCookieContainerHandle hCookieContainer)
+{
+	return m_CookieContainers.Remove(hCookieContainer) > 0;
+}
+
+bool FSteamStandInHTTP::SetCookie(HTTPCookieContainerHandle hCookieContainer, const char* pchHost, const char* pchUrl, const char* pchCookie)
+{
+	TArray<FString>* const Cookies = m_CookieContainers.Find(hCookieContainer);
+	if (Cookies == nullptr)
+	{
+		return false;
+	}
+
+	Cookies->Add(UTF8_TO_TCHAR(pchCookie));
+	return true;
+}
+
+bool FSteamStandInHTTP::SetHTTPRequestCookieContainer(HTTPRequestHandle hRequest, HTTPCookieContainerHandle hCookieContainer)
+{
+	FStandInRequest* const Request = m_Requests.Find(hRequest);
+	if (Request == nullptr || !m_CookieContainers.Contains(hCookieContainer))
+	{
+		return false;
+	}
+
+	Request->CookieContainer = hCookieContainer;
+	return true;
+}
+
+bool FSteamStandInHTTP::SetHTTPRequestUserAgentInfo(HTTPRequestHandle hRequest, const char* pchUserAgentInfo)
+{
+	return m_Requests.Contains(hRequest);
+}
+
+bool FSteamStandInHTTP::SetHTTPRequestRequiresVerifiedCertificate(HTTPRequestHandle hRequest, bool bRequireVerifiedCertificate)
+{
+	return m_Requests.Contains(hRequest);
+}
+
+bool FSteamStandInHTTP::SetHTTPRequestAbsoluteTimeoutMS(HTTPRequestHandle hRequest, uint32 unMilliseconds)
+{
+	return m_Requests.Contains(hRequest);
+}
+
+bool FSteamStandInHTTP::GetHTTPRequestWasTimedOut(HTTPRequestHandle hRequest, bool* pbWasTimedOut)
+{
+	if (!m_Requests.Contains(hRequest))
+	{
+		return false;
+	}
+
+	*pbWasTimedOut = false;
+	return true;
+}
+
+// Inventory
+
+FSteamStandInInventory::FSteamStandInInventory(FSteamStandInBackend& Backend, FRandomStream& Random, CSteamID Owner) :
+	m_Backend(Backend),
+	m_Owner(Owner),
+	m_NextInstance(1),
+	m_NextResult(1)
+{
+	const int32 StartingItems = Random.RandRange(3, 8);
+	for (int32 i = 0; i < StartingItems; i++)
+	{
+		Grant(FirstItemDef + Random.RandHelper(ItemDefCount));
+	}
+}
+
+SteamItemDetails_t& FSteamStandInInventory::Grant(SteamItemDef_t ItemDef)
+{
+	SteamItemDetails_t& Item = m_Items.AddDefaulted_GetRef();
+	Item.m_itemId = m_NextInstance++;
+	Item.m_iDefinition = ItemDef;
+	Item.m_unQuantity = 1;
+	Item.m_unFlags = 0;
+	return Item;
+}
+
+SteamInventoryResult_t FSteamStandInInventory::AddResult(TArray<SteamItemDetails_t>&& Items, bool bFullUpdate)
+{
+	const SteamInventoryResult_t Handle = m_NextResult++;
+	m_Results.Add(Handle, MoveTemp(Items));
+
+	SteamInventoryResultReady_t Ready = FSteamStandInBackend::MakePayload<SteamInventoryResultReady_t>();
+	Ready.m_handle = Handle;
+	Ready.m_result = k_EResultOK;
+	m_Backend.Post(Ready);
+
+	if (bFullUpdate)
+	{
+		SteamInventoryFullUpdate_t FullUpdate = FSteamStandInBackend::MakePayload<SteamInventoryFullUpdate_t>();
+		FullUpdate.m_handle = Handle;
+		m_Backend.Post(FullUpdate);
+	}
+
+	return Handle;
+}
+
+bool FSteamStandInInventory::GetAllItems(SteamInventoryResult_t* pResultHandle)
+{
+	*pResultHandle = AddResult(TArray<SteamItemDetails_t>(m_Items), true);
+	return true;
+}
+
+bool FSteamStandInInventory::AddPromoItem(SteamInventoryResult_t* pResultHandle, SteamItemDef_t itemDef)
+{
+	return AddPromoItems(pResultHandle, &itemDef, 1);
+}
+
+bool FSteamStandInInventory::AddPromoItems(SteamInventoryResult_t* pResultHandle, const SteamItemDef_t* pArrayItemDefs, uint32 unArrayLength)
+{
+	TArray<SteamItemDetails_t> Granted;
+	for (uint32 i = 0; i < unArrayLength; i++)
+	{
+		if (pArrayItemDefs[i] >= FirstItemDef && pArrayItemDefs[i] < FirstItemDef + ItemDefCount)
+		{
+			Granted.Add(Grant(pArrayItemDefs[i]));
+		}
+	}
+
+	*pResultHandle = AddResult(MoveTemp(Granted), false);
+	return true;
+}
+
+bool FSteamStandInInventory::ConsumeItem(SteamInventoryResult_t* pResultHandle, SteamItemInstanceID_t itemConsume, uint32 unQuantity)
+{
+	TArray<SteamItemDetails_t> Changed;
+
+	const int32 Index = m_Items.IndexOfByPredicate([itemConsume](const SteamItemDetails_t& Item) { return Item.m_itemId == itemConsume; });
+	if (Index != INDEX_NONE && unQuantity > 0)
+	{
+		SteamItemDetails_t& Item = m_Items[Index];
+		Item.m_unQuantity -= (uint16)FMath::Min<uint32>(unQuantity, Item.m_unQuantity);
+
+		Changed.Add(Item);
+		if (Item.m_unQuantity == 0)
+		{
+			Changed.Last().m_unFlags |= (uint16)(k_ESteamItemRemoved | k_ESteamItemConsumed);
+			m_Items.RemoveAt(Index);
+		}
+	}
+
+	*pResultHandle = AddResult(MoveTemp(Changed), false);
+	return true;
+}
+
+bool FSteamStandInInventory::CheckResultSteamID(SteamInventoryResult_t resultHandle, CSteamID steamIDExpected)
+{
+	return m_Results.Contains(resultHandle) && steamIDExpected == m_Owner;
+}
+
+bool FSteamStandInInventory::DeserializeResult(SteamInventoryResult_t* pOutResultHandle, const void* pBuffer, uint32 unBufferSize, bool bRESERVED_MUST_BE_FALSE)
+{
+	// Results are never serialized by the stand-in, so there's nothing it could have produced
+	*pOutResultHandle = k_SteamInventoryResultInvalid;
+	return false;
+}
+
+void FSteamStandInInventory::DestroyResult(SteamInventoryResult_t resultHandle)
+{
+	m_Results.Remove(resultHandle);
+}
+
+bool FSteamStandInInventory::GetItemPrice(SteamItemDef_t iDefinition, uint64* pCurrentPrice, uint64* pBasePrice)
+{
+	if (iDefinition < FirstItemDef || iDefinition >= FirstItemDef + ItemDefCount)
+	{
+		return false;
+	}
+
+	// Every other item is on sale
+	const int32 Offset = iDefinition - FirstItemDef;
+	*pBasePrice = 199 + 100 * Offset;
+	*pCurrentPrice = Offset % 2 == 0 ? *pBasePrice / 2 : *pBasePrice;
+	return true;
+}
+
+uint32 FSteamStandInInventory::GetNumItemsWithPrices()
+{
+	return ItemDefCount;
+}
+
+// Utils
+
+bool FSteamStandInUtils::GetImageSize(int iImage, uint32* pnWidth, uint32* pnHeight)
+{
+	uint64 SteamID = 0;
+	int32 Size = 0;
+	if (!m_Friends.GetAvatar(iImage, SteamID, Size))
+	{
+		return false;
+	}
+
+	*pnWidth = Size;
+	*pnHeight = Size;
+	return true;
+}
+
+bool FSteamStandInUtils::GetImageRGBA(int iImage, uint8* pubDest, int nDestBufferSize)
+{
+	uint64 SteamID = 0;
+	int32 Size = 0;
+	if (!m_Friends.GetAvatar(iImage, SteamID, Size) || nDestBufferSize < Size * Size * 4)
+	{
+		return false;
+	}
+
+	// A diagonal gradient in a colour derived from the Steam ID, so every user's avatar is distinct and stable
+	const uint32 Hash = GetTypeHash(SteamID);
+	const uint8 Base[3] = {(uint8)(Hash >> 16), (uint8)(Hash >> 8), (uint8)Hash};
+
+	for (int32 Y = 0; Y < Size; Y++)
+	{
+		for (int32 X = 0; X < Size; X++)
+		{
+			const uint8 Shade = (uint8)((X + Y) * 255 / (2 * Size - 2));
+			uint8* const Pixel = pubDest + (Y * Size + X) * 4;
+			Pixel[0] = Base[0] ^ Shade;
+			Pixel[1] = Base[1];
+			Pixel[2] = Base[2] ^ (255 - Shade);
+			Pixel[3] = 255;
+		}
+	}
+	return true;
+}
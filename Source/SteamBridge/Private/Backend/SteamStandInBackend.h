@@ -0,0 +1,489 @@
+// Copyright 2020 Russ 'trdwll' Treadwell <trdwll.com>. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Math/RandomStream.h"
+#include "Steam.h"
+#include "SteamBackend.h"
+#include "SteamCallbackDispatcher.h"
+
+class FSteamStandInBackend;
+
+/**
+ * Shape of the simulated Steam session, parsed from the command line (e.g. -SteamBridgeStandInFriends=500).
+ */
+struct FSteamStandInConfig
+{
+	int32 Seed = 1;
+	int32 FriendCount = 100;
+	int32 ClanCount = 8;
+	AppId_t AppID = 480;
+
+	/** Delay before call results and the callbacks a call triggers are posted. */
+	float LatencyMs = 50.0f;
+
+	/** Random persona and rich presence changes per second across the friends list, 0 for none. */
+	float PersonaChurnHz = 2.0f;
+
+	static FSteamStandInConfig FromCommandLine(const TCHAR* CommandLine);
+};
+
+class FSteamStandInFriends final : public ISteamBridgeFriends
+{
+public:
+	FSteamStandInFriends(FSteamStandInBackend& Backend, FRandomStream& Random, const FSteamStandInConfig& Config);
+
+	virtual const char* GetPersonaName() override;
+	virtual SteamAPICall_t SetPersonaName(const char* pchPersonaName) override;
+	virtual EPersonaState GetPersonaState() override;
+	virtual int GetFriendCount(int iFriendFlags) override;
+	virtual CSteamID GetFriendByIndex(int iFriend, int iFriendFlags) override;
+	virtual EFriendRelationship GetFriendRelationship(CSteamID steamIDFriend) override;
+	virtual EPersonaState GetFriendPersonaState(CSteamID steamIDFriend) override;
+	virtual const char* GetFriendPersonaName(CSteamID steamIDFriend) override;
+	virtual bool GetFriendGamePlayed(CSteamID steamIDFriend, FriendGameInfo_t* pFriendGameInfo) override;
+	virtual const char* GetFriendPersonaNameHistory(CSteamID steamIDFriend, int iPersonaName) override;
+	virtual int GetFriendSteamLevel(CSteamID steamIDFriend) override;
+	virtual const char* GetPlayerNickname(CSteamID steamIDPlayer) override;
+	virtual int GetFriendsGroupCount() override;
+	virtual FriendsGroupID_t GetFriendsGroupIDByIndex(int iFG) override;
+	virtual const char* GetFriendsGroupName(FriendsGroupID_t friendsGroupID) override;
+	virtual int GetFriendsGroupMembersCount(FriendsGroupID_t friendsGroupID) override;
+	virtual void GetFriendsGroupMembersList(FriendsGroupID_t friendsGroupID, CSteamID* pOutSteamIDMembers, int nMembersCount) override;
+	virtual bool HasFriend(CSteamID steamIDFriend, int iFriendFlags) override;
+	virtual int GetClanCount() override;
+	virtual CSteamID GetClanByIndex(int iClan) override;
+	virtual const char* GetClanName(CSteamID steamIDClan) override;
+	virtual const char* GetClanTag(CSteamID steamIDClan) override;
+	virtual bool GetClanActivityCounts(CSteamID steamIDClan, int* pnOnline, int* pnInGame, int* pnChatting) override;
+	virtual SteamAPICall_t DownloadClanActivityCounts(CSteamID* psteamIDClans, int cClansToRequest) override;
+	virtual int GetFriendCountFromSource(CSteamID steamIDSource) override;
+	virtual CSteamID GetFriendFromSourceByIndex(CSteamID steamIDSource, int iFriend) override;
+	virtual bool IsUserInSource(CSteamID steamIDUser, CSteamID steamIDSource) override;
+	virtual void SetInGameVoiceSpeaking(CSteamID steamIDUser, bool bSpeaking) override;
+	virtual void ActivateGameOverlay(const char* pchDialog) override;
+	virtual void ActivateGameOverlayToUser(const char* pchDialog, CSteamID steamID) override;
+	virtual void ActivateGameOverlayToWebPage(const char* pchURL, EActivateGameOverlayToWebPageMode eMode) override;
+	virtual void ActivateGameOverlayToStore(AppId_t nAppID, EOverlayToStoreFlag eFlag) override;
+	virtual void SetPlayedWith(CSteamID steamIDUserPlayedWith) override;
+	virtual void ActivateGameOverlayInviteDialog(CSteamID steamIDLobby) override;
+	virtual int GetSmallFriendAvatar(CSteamID steamIDFriend) override;
+	virtual int GetMediumFriendAvatar(CSteamID steamIDFriend) override;
+	virtual int GetLargeFriendAvatar(CSteamID steamIDFriend) override;
+	virtual bool RequestUserInformation(CSteamID steamIDUser, bool bRequireNameOnly) override;
+	virtual SteamAPICall_t RequestClanOfficerList(CSteamID steamIDClan) override;
+	virtual CSteamID GetClanOwner(CSteamID steamIDClan) override;
+	virtual int GetClanOfficerCount(CSteamID steamIDClan) override;
+	virtual CSteamID GetClanOfficerByIndex(CSteamID steamIDClan, int iOfficer) override;
+	virtual uint32 GetUserRestrictions() override;
+	virtual bool SetRichPresence(const char* pchKey, const char* pchValue) override;
+	virtual void ClearRichPresence() override;
+	virtual const char* GetFriendRichPresence(CSteamID steamIDFriend, const char* pchKey) override;
+	virtual int GetFriendRichPresenceKeyCount(CSteamID steamIDFriend) override;
+	virtual const char* GetFriendRichPresenceKeyByIndex(CSteamID steamIDFriend, int iKey) override;
+	virtual void RequestFriendRichPresence(CSteamID steamIDFriend) override;
+	virtual bool InviteUserToGame(CSteamID steamIDFriend, const char* pchConnectString) override;
+	virtual int GetCoplayFriendCount() override;
+	virtual CSteamID GetCoplayFriend(int iCoplayFriend) override;
+	virtual AppId_t GetFriendCoplayGame(CSteamID steamIDFriend) override;
+	virtual SteamAPICall_t JoinClanChatRoom(CSteamID steamIDClan) override;
+	virtual bool LeaveClanChatRoom(CSteamID steamIDClan) override;
+	virtual int GetClanChatMemberCount(CSteamID steamIDClan) override;
+	virtual CSteamID GetChatMemberByIndex(CSteamID steamIDClan, int iUser) override;
+	virtual bool SendClanChatMessage(CSteamID steamIDClanChat, const char* pchText) override;
+	virtual int GetClanChatMessage(CSteamID steamIDClanChat, int iMessage, void* prgchText, int cchTextMax, EChatEntryType* peChatEntryType, CSteamID* psteamidChatter) override;
+	virtual bool IsClanChatAdmin(CSteamID steamIDClanChat, CSteamID steamIDUser) override;
+	virtual bool IsClanChatWindowOpenInSteam(CSteamID steamIDClanChat) override;
+	virtual bool OpenClanChatWindowInSteam(CSteamID steamIDClanChat) override;
+	virtual bool CloseClanChatWindowInSteam(CSteamID steamIDClanChat) override;
+	virtual bool SetListenForFriendsMessages(bool bInterceptEnabled) override;
+	virtual bool ReplyToFriendMessage(CSteamID steamIDFriend, const char* pchMsgToSend) override;
+	virtual int GetFriendMessage(CSteamID steamIDFriend, int iMessageID, void* pvData, int cubData, EChatEntryType* peChatEntryType) override;
+	virtual SteamAPICall_t GetFollowerCount(CSteamID steamID) override;
+	virtual SteamAPICall_t IsFollowing(CSteamID steamID) override;
+	virtual SteamAPICall_t EnumerateFollowingList(uint32 unStartIndex) override;
+	virtual bool IsClanPublic(CSteamID steamIDClan) override;
+	virtual bool IsClanOfficialGameGroup(CSteamID steamIDClan) override;
+
+	/** Changes a random friend's persona state, game or rich presence and posts the matching callback. */
+	void Churn();
+
+	/** Decodes an avatar handle from Get*FriendAvatar, see FSteamStandInUtils. */
+	bool GetAvatar(int32 Image, uint64& SteamID, int32& Size) const;
+
+	CSteamID GetLocalSteamID() const { return m_LocalSteamID; }
+
+private:
+	struct FStandInFriend
+	{
+		CSteamID SteamID;
+		TArray<ANSICHAR> Name;
+		TArray<ANSICHAR> Nickname;
+		EPersonaState PersonaState;
+		int32 SteamLevel;
+		AppId_t GameAppID;
+		FriendsGroupID_t GroupID;
+		TArray<TPair<TArray<ANSICHAR>, TArray<ANSICHAR>>> RichPresence;
+	};
+
+	struct FStandInClan
+	{
+		CSteamID SteamID;
+		TArray<ANSICHAR> Name;
+		TArray<ANSICHAR> Tag;
+		TArray<int32> Members;   // indices into m_Friends
+		TArray<int32> Officers;  // indices into m_Friends, the first is the owner
+		bool bPublic;
+		bool bOfficialGameGroup;
+	};
+
+	struct FStandInChatMessage
+	{
+		CSteamID Sender;
+		TArray<ANSICHAR> Text;
+	};
+
+	const FStandInFriend* FindFriend(CSteamID SteamID) const;
+	const FStandInClan* FindClan(CSteamID SteamID) const;
+	int32 GetOnlineCount(const FStandInClan& Clan) const;
+
+	void SetFriendRichPresence(FStandInFriend& Friend, const char* Key, const FString& Value);
+
+	/** Avatars are generated, their handle encodes who and which size. */
+	int32 GetAvatarHandle(CSteamID SteamID, int32 SizeIndex) const;
+
+	static int32 CopyMessage(const FStandInChatMessage& Message, void* Dest, int32 DestSize);
+
+	FSteamStandInBackend& m_Backend;
+	FRandomStream& m_Random;
+	AppId_t m_AppID;
+
+	CSteamID m_LocalSteamID;
+	TArray<ANSICHAR> m_LocalName;
+	TArray<TPair<TArray<ANSICHAR>, TArray<ANSICHAR>>> m_LocalRichPresence;
+
+	TArray<FStandInFriend> m_Friends;
+	TMap<uint64, int32> m_FriendIndices;
+
+	TArray<TArray<ANSICHAR>> m_GroupNames;  // group ID - 1
+
+	TArray<FStandInClan> m_Clans;
+	TMap<uint64, int32> m_ClanIndices;
+
+	TSet<uint64> m_JoinedClanChats;
+	TMap<uint64, TArray<FStandInChatMessage>> m_ChatLogs;  // by clan or friend
+
+	TArray<CSteamID> m_CoplayFriends;
+
+	bool m_bListenForFriendsMessages;
+};
+
+/**
+ * Auth tickets shared by the user and game server interfaces, so a client ticket can be validated by a server in the same process.
+ */
+class FSteamStandInAuth
+{
+public:
+	explicit FSteamStandInAuth(FSteamStandInBackend& Backend) : m_Backend(Backend), m_NextTicket(1) {}
+
+	HAuthTicket GetAuthSessionTicket(CSteamID Owner, void* pTicket, int cbMaxTicket, uint32* pcbTicket, bool bGameServer);
+	EBeginAuthSessionResult BeginAuthSession(const void* pAuthTicket, int cbAuthTicket, CSteamID steamID, bool bGameServer);
+	void EndAuthSession(CSteamID steamID, bool bGameServer);
+	void CancelAuthTicket(HAuthTicket hAuthTicket);
+	EUserHasLicenseForAppResult UserHasLicenseForApp(CSteamID steamID, bool bGameServer) const;
+
+private:
+	struct FStandInTicket
+	{
+		uint64 SteamID;
+		uint32 Ticket;
+		uint32 Magic;
+	};
+
+	static constexpr uint32 TicketMagic = 0x5354414E;
+
+	FSteamStandInBackend& m_Backend;
+	HAuthTicket m_NextTicket;
+	TSet<HAuthTicket> m_ActiveTickets;
+	TMap<uint64, HAuthTicket> m_Sessions[2];  // client, game server
+};
+
+class FSteamStandInUser final : public ISteamBridgeUser
+{
+public:
+	FSteamStandInUser(FSteamStandInBackend& Backend, FSteamStandInAuth& Auth, CSteamID SteamID, const FSteamStandInConfig& Config);
+
+	virtual HSteamUser GetHSteamUser() override;
+	virtual bool BLoggedOn() override;
+	virtual CSteamID GetSteamID() override;
+	virtual int InitiateGameConnection(void* pAuthBlob, int cbMaxAuthBlob, CSteamID steamIDGameServer, uint32 unIPServer, uint16 usPortServer, bool bSecure) override;
+	virtual void TerminateGameConnection(uint32 unIPServer, uint16 usPortServer) override;
+	virtual void StartVoiceRecording() override;
+	virtual void StopVoiceRecording() override;
+	virtual EVoiceResult GetAvailableVoice(uint32* pcbCompressed) override;
+	virtual EVoiceResult GetVoice(bool bWantCompressed, void* pDestBuffer, uint32 cbDestBufferSize, uint32* nBytesWritten) override;
+	virtual EVoiceResult DecompressVoice(const void* pCompressed, uint32 cbCompressed, void* pDestBuffer, uint32 cbDestBufferSize, uint32* nBytesWritten, uint32 nDesiredSampleRate) override;
+	virtual uint32 GetVoiceOptimalSampleRate() override;
+	virtual HAuthTicket GetAuthSessionTicket(void* pTicket, int cbMaxTicket, uint32* pcbTicket) override;
+	virtual EBeginAuthSessionResult BeginAuthSession(const void* pAuthTicket, int cbAuthTicket, CSteamID steamID) override;
+	virtual void EndAuthSession(CSteamID steamID) override;
+	virtual void CancelAuthTicket(HAuthTicket hAuthTicket) override;
+	virtual EUserHasLicenseForAppResult UserHasLicenseForApp(CSteamID steamID, AppId_t appID) override;
+	virtual bool BIsBehindNAT() override;
+	virtual void AdvertiseGame(CSteamID steamIDGameServer, uint32 unIPServer, uint16 usPortServer) override;
+	virtual bool GetEncryptedAppTicket(void* pTicket, int cbMaxTicket, uint32* pcbTicket) override;
+	virtual int GetGameBadgeLevel(int nSeries, bool bFoil) override;
+	virtual int GetPlayerSteamLevel() override;
+	virtual bool BIsPhoneVerified() override;
+	virtual bool BIsTwoFactorEnabled() override;
+	virtual bool BIsPhoneIdentifying() override;
+	virtual bool BIsPhoneRequiringVerification() override;
+	virtual SteamAPICall_t GetDurationControl() override;
+
+private:
+	FSteamStandInBackend& m_Backend;
+	FSteamStandInAuth& m_Auth;
+	CSteamID m_SteamID;
+	AppId_t m_AppID;
+	bool m_bRecordingVoice;
+};
+
+class FSteamStandInGameServer final : public ISteamBridgeGameServer
+{
+public:
+	FSteamStandInGameServer(FSteamStandInBackend& Backend, FSteamStandInAuth& Auth, const FSteamStandInConfig& Config);
+
+	virtual void SetProduct(const char* pszProduct) override;
+	virtual void SetGameDescription(const char* pszGameDescription) override;
+	virtual void SetModDir(const char* pszModDir) override;
+	virtual void SetDedicatedServer(bool bDedicated) override;
+	virtual void LogOn(const char* pszToken) override;
+	virtual void LogOnAnonymous() override;
+	virtual void LogOff() override;
+	virtual bool BLoggedOn() override;
+	virtual bool BSecure() override;
+	virtual CSteamID GetSteamID() override;
+	virtual bool WasRestartRequested() override;
+	virtual void SetMaxPlayerCount(int cPlayersMax) override;
+	virtual void SetBotPlayerCount(int cBotplayers) override;
+	virtual void SetServerName(const char* pszServerName) override;
+	virtual void SetMapName(const char* pszMapName) override;
+	virtual void SetPasswordProtected(bool bPasswordProtected) override;
+	virtual void SetSpectatorPort(uint16 unSpectatorPort) override;
+	virtual void SetSpectatorServerName(const char* pszSpectatorServerName) override;
+	virtual void ClearAllKeyValues() override;
+	virtual void SetKeyValue(const char* pKey, const char* pValue) override;
+	virtual void SetGameTags(const char* pchGameTags) override;
+	virtual void SetGameData(const char* pchGameData) override;
+	virtual void SetRegion(const char* pszRegion) override;
+	virtual HAuthTicket GetAuthSessionTicket(void* pTicket, int cbMaxTicket, uint32* pcbTicket) override;
+	virtual EBeginAuthSessionResult BeginAuthSession(const void* pAuthTicket, int cbAuthTicket, CSteamID steamID) override;
+	virtual void EndAuthSession(CSteamID steamID) override;
+	virtual void CancelAuthTicket(HAuthTicket hAuthTicket) override;
+	virtual EUserHasLicenseForAppResult UserHasLicenseForApp(CSteamID steamID, AppId_t appID) override;
+	virtual bool RequestUserGroupStatus(CSteamID steamIDUser, CSteamID steamIDGroup) override;
+	virtual void EnableHeartbeats(bool bActive) override;
+	virtual void SetHeartbeatInterval(int iHeartbeatInterval) override;
+	virtual void ForceHeartbeat() override;
+	virtual SteamAPICall_t AssociateWithClan(CSteamID steamIDClan) override;
+
+private:
+	void SetLoggedOn();
+
+	FSteamStandInBackend& m_Backend;
+	FSteamStandInAuth& m_Auth;
+	AppId_t m_AppID;
+	CSteamID m_SteamID;
+	TArray<TPair<TArray<ANSICHAR>, TArray<ANSICHAR>>> m_KeyValues;
+	bool m_bLoggedOn;
+};
+
+class FSteamStandInHTTP final : public ISteamBridgeHTTP
+{
+public:
+	explicit FSteamStandInHTTP(FSteamStandInBackend& Backend) : m_Backend(Backend), m_NextRequest(1), m_NextCookieContainer(1) {}
+
+	virtual HTTPRequestHandle CreateHTTPRequest(EHTTPMethod eHTTPRequestMethod, const char* pchAbsoluteURL) override;
+	virtual bool SetHTTPRequestContextValue(HTTPRequestHandle hRequest, uint64 ulContextValue) override;
+	virtual bool SetHTTPRequestNetworkActivityTimeout(HTTPRequestHandle hRequest, uint32 unTimeoutSeconds) override;
+	virtual bool SetHTTPRequestHeaderValue(HTTPRequestHandle hRequest, const char* pchHeaderName, const char* pchHeaderValue) override;
+	virtual bool SetHTTPRequestGetOrPostParameter(HTTPRequestHandle hRequest, const char* pchParamName, const char* pchParamValue) override;
+	virtual bool SendHTTPRequest(HTTPRequestHandle hRequest, SteamAPICall_t* pCallHandle) override;
+	virtual bool SendHTTPRequestAndStreamResponse(HTTPRequestHandle hRequest, SteamAPICall_t* pCallHandle) override;
+	virtual bool DeferHTTPRequest(HTTPRequestHandle hRequest) override;
+	virtual bool PrioritizeHTTPRequest(HTTPRequestHandle hRequest) override;
+	virtual bool GetHTTPResponseHeaderSize(HTTPRequestHandle hRequest, const char* pchHeaderName, uint32* unResponseHeaderSize) override;
+	virtual bool GetHTTPResponseHeaderValue(HTTPRequestHandle hRequest, const char* pchHeaderName, uint8* pHeaderValueBuffer, uint32 unBufferSize) override;
+	virtual bool GetHTTPResponseBodySize(HTTPRequestHandle hRequest, uint32* unBodySize) override;
+	virtual bool GetHTTPResponseBodyData(HTTPRequestHandle hRequest, uint8* pBodyDataBuffer, uint32 unBufferSize) override;
+	virtual bool GetHTTPStreamingResponseBodyData(HTTPRequestHandle hRequest, uint32 cOffset, uint8* pBodyDataBuffer, uint32 unBufferSize) override;
+	virtual bool ReleaseHTTPRequest(HTTPRequestHandle hRequest) override;
+	virtual bool GetHTTPDownloadProgressPct(HTTPRequestHandle hRequest, float* pflPercentOut) override;
+	virtual bool SetHTTPRequestRawPostBody(HTTPRequestHandle hRequest, const char* pchContentType, uint8* pubBody, uint32 unBodyLen) override;
+	virtual HTTPCookieContainerHandle CreateCookieContainer(bool bAllowResponsesToModify) override;
+	virtual bool ReleaseCookieContainer(HTTPCookieContainerHandle hCookieContainer) override;
+	virtual bool SetCookie(HTTPCookieContainerHandle hCookieContainer, const char* pchHost, const char* pchUrl, const char* pchCookie) override;
+	virtual bool SetHTTPRequestCookieContainer(HTTPRequestHandle hRequest, HTTPCookieContainerHandle hCookieContainer) override;
+	virtual bool SetHTTPRequestUserAgentInfo(HTTPRequestHandle hRequest, const char* pchUserAgentInfo) override;
+	virtual bool SetHTTPRequestRequiresVerifiedCertificate(HTTPRequestHandle hRequest, bool bRequireVerifiedCertificate) override;
+	virtual bool SetHTTPRequestAbsoluteTimeoutMS(HTTPRequestHandle hRequest, uint32 unMilliseconds) override;
+	virtual bool GetHTTPRequestWasTimedOut(HTTPRequestHandle hRequest, bool* pbWasTimedOut) override;
+
+private:
+	struct FStandInRequest
+	{
+		EHTTPMethod Method;
+		FString URL;
+		uint64 ContextValue = 0;
+		TArray<TPair<FString, FString>> Headers;
+		TArray<TPair<FString, FString>> Parameters;
+		FString ContentType;
+		TArray<uint8> Body;
+		HTTPCookieContainerHandle CookieContainer = INVALID_HTTPCOOKIE_HANDLE;
+		EHTTPStatusCode StatusCode = k_EHTTPStatusCodeInvalid;
+		TArray<TPair<FString, FString>> ResponseHeaders;
+		TArray<uint8> ResponseBody;
+		bool bSent = false;
+	};
+
+	/** Answers the request in process: echoes it back as JSON, or fails with NNN for a /status/NNN path. */
+	static void Respond(FStandInRequest& Request, const TArray<FString>& Cookies);
+
+	bool Send(HTTPRequestHandle hRequest, SteamAPICall_t* pCallHandle, bool bStream);
+	const FString* FindResponseHeader(HTTPRequestHandle hRequest, const char* pchHeaderName) const;
+
+	FSteamStandInBackend& m_Backend;
+	HTTPRequestHandle m_NextRequest;
+	HTTPCookieContainerHandle m_NextCookieContainer;
+	TMap<HTTPRequestHandle, FStandInRequest> m_Requests;
+	TMap<HTTPCookieContainerHandle, TArray<FString>> m_CookieContainers;
+};
+
+class FSteamStandInInventory final : public ISteamBridgeInventory
+{
+public:
+	FSteamStandInInventory(FSteamStandInBackend& Backend, FRandomStream& Random, CSteamID Owner);
+
+	virtual bool GetAllItems(SteamInventoryResult_t* pResultHandle) override;
+	virtual bool AddPromoItem(SteamInventoryResult_t* pResultHandle, SteamItemDef_t itemDef) override;
+	virtual bool AddPromoItems(SteamInventoryResult_t* pResultHandle, const SteamItemDef_t* pArrayItemDefs, uint32 unArrayLength) override;
+	virtual bool ConsumeItem(SteamInventoryResult_t* pResultHandle, SteamItemInstanceID_t itemConsume, uint32 unQuantity) override;
+	virtual bool CheckResultSteamID(SteamInventoryResult_t resultHandle, CSteamID steamIDExpected) override;
+	virtual bool DeserializeResult(SteamInventoryResult_t* pOutResultHandle, const void* pBuffer, uint32 unBufferSize, bool bRESERVED_MUST_BE_FALSE) override;
+	virtual void DestroyResult(SteamInventoryResult_t resultHandle) override;
+	virtual bool GetItemPrice(SteamItemDef_t iDefinition, uint64* pCurrentPrice, uint64* pBasePrice) override;
+	virtual uint32 GetNumItemsWithPrices() override;
+
+private:
+	/** Item definitions FirstItemDef to FirstItemDef + ItemDefCount - 1 exist and have prices. */
+	static constexpr SteamItemDef_t FirstItemDef = 100;
+	static constexpr int32 ItemDefCount = 10;
+
+	SteamInventoryResult_t AddResult(TArray<SteamItemDetails_t>&& Items, bool bFullUpdate);
+	SteamItemDetails_t& Grant(SteamItemDef_t ItemDef);
+
+	FSteamStandInBackend& m_Backend;
+	CSteamID m_Owner;
+	SteamItemInstanceID_t m_NextInstance;
+	SteamInventoryResult_t m_NextResult;
+	TArray<SteamItemDetails_t> m_Items;
+	TMap<SteamInventoryResult_t, TArray<SteamItemDetails_t>> m_Results;
+};
+
+class FSteamStandInUtils final : public ISteamBridgeUtils
+{
+public:
+	explicit FSteamStandInUtils(const FSteamStandInFriends& Friends) : m_Friends(Friends) {}
+
+	virtual bool GetImageSize(int iImage, uint32* pnWidth, uint32* pnHeight) override;
+	virtual bool GetImageRGBA(int iImage, uint8* pubDest, int nDestBufferSize) override;
+
+private:
+	const FSteamStandInFriends& m_Friends;
+};
+
+/**
+ * A deterministic, in-process Steam for running the wrappers without a Steam client: a seeded friends list and clans with persona churn,
+ * generated avatars, auth tickets, a loopback HTTP responder and an inventory. Call results and callbacks are posted to the dispatcher after the configured latency.
+ */
+class FSteamStandInBackend final : public ISteamBridgeBackend
+{
+public:
+	explicit FSteamStandInBackend(const FSteamStandInConfig& Config);
+
+	virtual ISteamBridgeFriends* Friends() override { return &m_Friends; }
+	virtual ISteamBridgeUser* User() override { return &m_User; }
+	virtual ISteamBridgeGameServer* GameServer() override { return &m_GameServer; }
+	virtual ISteamBridgeHTTP* HTTP() override { return &m_HTTP; }
+	virtual ISteamBridgeInventory* Inventory() override { return &m_Inventory; }
+	virtual ISteamBridgeUtils* Utils() override { return &m_Utils; }
+
+	virtual void Tick(double Now) override;
+	virtual bool IsStandIn() const override { return true; }
+
+	/**
+	 * Posts a callback to the dispatcher once the latency has elapsed.
+	 *
+	 * @param const P & Payload
+	 * @param bool bGameServer Whether it's delivered to the game server callbacks
+	 * @return void
+	 */
+	template <class P>
+	void Post(const P& Payload, bool bGameServer = false)
+	{
+		Schedule(P::k_iCallback, &Payload, sizeof(P), bGameServer, k_uAPICallInvalid);
+	}
+
+	/**
+	 * Issues an API call handle whose result is posted once the latency has elapsed.
+	 *
+	 * @param const P & Payload
+	 * @param bool bGameServer
+	 * @return SteamAPICall_t
+	 */
+	template <class P>
+	SteamAPICall_t PostCallResult(const P& Payload, bool bGameServer = false)
+	{
+		const SteamAPICall_t APICall = m_NextAPICall++;
+		Schedule(P::k_iCallback, &Payload, sizeof(P), bGameServer, APICall);
+		return APICall;
+	}
+
+	/** Zeroes a callback struct so the fields the stand-in doesn't simulate are deterministic. */
+	template <class P>
+	static P MakePayload()
+	{
+		P Payload;
+		FMemory::Memzero(&Payload, sizeof(P));
+		return Payload;
+	}
+
+	static TArray<ANSICHAR> ToUTF8(const FString& String);
+
+private:
+	struct FScheduledCallback
+	{
+		double DueTime;
+		FSteamQueuedCallback Queued;
+	};
+
+	void Schedule(int32 CallbackID, const void* Payload, int32 Size, bool bGameServer, SteamAPICall_t APICall);
+
+	FRandomStream m_Random;
+	double m_LatencySeconds;
+	double m_ChurnIntervalSeconds;
+	double m_NextChurnTime;
+	SteamAPICall_t m_NextAPICall;
+
+	// The latency is constant, so callbacks are scheduled in the order they fall due
+	TArray<FScheduledCallback> m_Scheduled;
+
+	FSteamStandInFriends m_Friends;
+	FSteamStandInAuth m_Auth;
+	FSteamStandInUser m_User;
+	FSteamStandInGameServer m_GameServer;
+	FSteamStandInHTTP m_HTTP;
+	FSteamStandInInventory m_Inventory;
+	FSteamStandInUtils m_Utils;
+};
@@ -0,0 +1,227 @@
+// Copyright 2020 Russ 'trdwll' Treadwell <trdwll.com>. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Steam.h"
+#include "SteamBackend.h"
+
+// Straight forwarding to the Steamworks accessors, which already resolve the interface for the current Steam user.
+
+class FSteamworksFriends final : public ISteamBridgeFriends
+{
+public:
+	virtual const char* GetPersonaName() override { return SteamFriends()->GetPersonaName(); }
+	virtual SteamAPICall_t SetPersonaName(const char* pchPersonaName) override { return SteamFriends()->SetPersonaName(pchPersonaName); }
+	virtual EPersonaState GetPersonaState() override { return SteamFriends()->GetPersonaState(); }
+	virtual int GetFriendCount(int iFriendFlags) override { return SteamFriends()->GetFriendCount(iFriendFlags); }
+	virtual CSteamID GetFriendByIndex(int iFriend, int iFriendFlags) override { return SteamFriends()->GetFriendByIndex(iFriend, iFriendFlags); }
+	virtual EFriendRelationship GetFriendRelationship(CSteamID steamIDFriend) override { return SteamFriends()->GetFriendRelationship(steamIDFriend); }
+	virtual EPersonaState GetFriendPersonaState(CSteamID steamIDFriend) override { return SteamFriends()->GetFriendPersonaState(steamIDFriend); }
+	virtual const char* GetFriendPersonaName(CSteamID steamIDFriend) override { return SteamFriends()->GetFriendPersonaName(steamIDFriend); }
+	virtual bool GetFriendGamePlayed(CSteamID steamIDFriend, FriendGameInfo_t* pFriendGameInfo) override { return SteamFriends()->GetFriendGamePlayed(steamIDFriend, pFriendGameInfo); }
+	virtual const char* GetFriendPersonaNameHistory(CSteamID steamIDFriend, int iPersonaName) override { return SteamFriends()->GetFriendPersonaNameHistory(steamIDFriend, iPersonaName); }
+	virtual int GetFriendSteamLevel(CSteamID steamIDFriend) override { return SteamFriends()->GetFriendSteamLevel(steamIDFriend); }
+	virtual const char* GetPlayerNickname(CSteamID steamIDPlayer) override { return SteamFriends()->GetPlayerNickname(steamIDPlayer); }
+	virtual int GetFriendsGroupCount() override { return SteamFriends()->GetFriendsGroupCount(); }
+	virtual FriendsGroupID_t GetFriendsGroupIDByIndex(int iFG) override { return SteamFriends()->GetFriendsGroupIDByIndex(iFG); }
+	virtual const char* GetFriendsGroupName(FriendsGroupID_t friendsGroupID) override { return SteamFriends()->GetFriendsGroupName(friendsGroupID); }
+	virtual int GetFriendsGroupMembersCount(FriendsGroupID_t friendsGroupID) override { return SteamFriends()->GetFriendsGroupMembersCount(friendsGroupID); }
+	virtual void GetFriendsGroupMembersList(FriendsGroupID_t friendsGroupID, CSteamID* pOutSteamIDMembers, int nMembersCount) override { SteamFriends()->GetFriendsGroupMembersList(friendsGroupID, pOutSteamIDMembers, nMembersCount); }
+	virtual bool HasFriend(CSteamID steamIDFriend, int iFriendFlags) override { return SteamFriends()->HasFriend(steamIDFriend, iFriendFlags); }
+	virtual int GetClanCount() override { return SteamFriends()->GetClanCount(); }
+	virtual CSteamID GetClanByIndex(int iClan) override { return SteamFriends()->GetClanByIndex(iClan); }
+	virtual const char* GetClanName(CSteamID steamIDClan) override { return SteamFriends()->GetClanName(steamIDClan); }
+	virtual const char* GetClanTag(CSteamID steamIDClan) override { return SteamFriends()->GetClanTag(steamIDClan); }
+	virtual bool GetClanActivityCounts(CSteamID steamIDClan, int* pnOnline, int* pnInGame, int* pnChatting) override { return SteamFriends()->GetClanActivityCounts(steamIDClan, pnOnline, pnInGame, pnChatting); }
+	virtual SteamAPICall_t DownloadClanActivityCounts(CSteamID* psteamIDClans, int cClansToRequest) override { return SteamFriends()->DownloadClanActivityCounts(psteamIDClans, cClansToRequest); }
+	virtual int GetFriendCountFromSource(CSteamID steamIDSource) override { return SteamFriends()->GetFriendCountFromSource(steamIDSource); }
+	virtual CSteamID GetFriendFromSourceByIndex(CSteamID steamIDSource, int iFriend) override { return SteamFriends()->GetFriendFromSourceByIndex(steamIDSource, iFriend); }
+	virtual bool IsUserInSource(CSteamID steamIDUser, CSteamID steamIDSource) override { return SteamFriends()->IsUserInSource(steamIDUser, steamIDSource); }
+	virtual void SetInGameVoiceSpeaking(CSteamID steamIDUser, bool bSpeaking) override { SteamFriends()->SetInGameVoiceSpeaking(steamIDUser, bSpeaking); }
+	virtual void ActivateGameOverlay(const char* pchDialog) override { SteamFriends()->ActivateGameOverlay(pchDialog); }
+	virtual void ActivateGameOverlayToUser(const char* pchDialog, CSteamID steamID) override { SteamFriends()->ActivateGameOverlayToUser(pchDialog, steamID); }
+	virtual void ActivateGameOverlayToWebPage(const char* pchURL, EActivateGameOverlayToWebPageMode eMode) override { SteamFriends()->ActivateGameOverlayToWebPage(pchURL, eMode); }
+	virtual void ActivateGameOverlayToStore(AppId_t nAppID, EOverlayToStoreFlag eFlag) override { SteamFriends()->ActivateGameOverlayToStore(nAppID, eFlag); }
+	virtual void SetPlayedWith(CSteamID steamIDUserPlayedWith) override { SteamFriends()->SetPlayedWith(steamIDUserPlayedWith); }
+	virtual void ActivateGameOverlayInviteDialog(CSteamID steamIDLobby) override { SteamFriends()->ActivateGameOverlayInviteDialog(steamIDLobby); }
+	virtual int GetSmallFriendAvatar(CSteamID steamIDFriend) override { return SteamFriends()->GetSmallFriendAvatar(steamIDFriend); }
+	virtual int GetMediumFriendAvatar(CSteamID steamIDFriend) override { return SteamFriends()->GetMediumFriendAvatar(steamIDFriend); }
+	virtual int GetLargeFriendAvatar(CSteamID steamIDFriend) override { return SteamFriends()->GetLargeFriendAvatar(steamIDFriend); }
+	virtual bool RequestUserInformation(CSteamID steamIDUser, bool bRequireNameOnly) override { return SteamFriends()->RequestUserInformation(steamIDUser, bRequireNameOnly); }
+	virtual SteamAPICall_t RequestClanOfficerList(CSteamID steamIDClan) override { return SteamFriends()->RequestClanOfficerList(steamIDClan); }
+	virtual CSteamID GetClanOwner(CSteamID steamIDClan) override { return SteamFriends()->GetClanOwner(steamIDClan); }
+	virtual int GetClanOfficerCount(CSteamID steamIDClan) override { return SteamFriends()->GetClanOfficerCount(steamIDClan); }
+	virtual CSteamID GetClanOfficerByIndex(CSteamID steamIDClan, int iOfficer) override { return SteamFriends()->GetClanOfficerByIndex(steamIDClan, iOfficer); }
+	virtual uint32 GetUserRestrictions() override { return SteamFriends()->GetUserRestrictions(); }
+	virtual bool SetRichPresence(const char* pchKey, const char* pchValue) override { return SteamFriends()->SetRichPresence(pchKey, pchValue); }
+	virtual void ClearRichPresence() override { SteamFriends()->ClearRichPresence(); }
+	virtual const char* GetFriendRichPresence(CSteamID steamIDFriend, const char* pchKey) override { return SteamFriends()->GetFriendRichPresence(steamIDFriend, pchKey); }
+	virtual int GetFriendRichPresenceKeyCount(CSteamID steamIDFriend) override { return SteamFriends()->GetFriendRichPresenceKeyCount(steamIDFriend); }
+	virtual const char* GetFriendRichPresenceKeyByIndex(CSteamID steamIDFriend, int iKey) override { return SteamFriends()->GetFriendRichPresenceKeyByIndex(steamIDFriend, iKey); }
+	virtual void RequestFriendRichPresence(CSteamID steamIDFriend) override { SteamFriends()->RequestFriendRichPresence(steamIDFriend); }
+	virtual bool InviteUserToGame(CSteamID steamIDFriend, const char* pchConnectString) override { return SteamFriends()->InviteUserToGame(steamIDFriend, pchConnectString); }
+	virtual int GetCoplayFriendCount() override { return SteamFriends()->GetCoplayFriendCount(); }
+	virtual CSteamID GetCoplayFriend(int iCoplayFriend) override { return SteamFriends()->GetCoplayFriend(iCoplayFriend); }
+	virtual AppId_t GetFriendCoplayGame(CSteamID steamIDFriend) override { return SteamFriends()->GetFriendCoplayGame(steamIDFriend); }
+	virtual SteamAPICall_t JoinClanChatRoom(CSteamID steamIDClan) override { return SteamFriends()->JoinClanChatRoom(steamIDClan); }
+	virtual bool LeaveClanChatRoom(CSteamID steamIDClan) override { return SteamFriends()->LeaveClanChatRoom(steamIDClan); }
+	virtual int GetClanChatMemberCount(CSteamID steamIDClan) override { return SteamFriends()->GetClanChatMemberCount(steamIDClan); }
+	virtual CSteamID GetChatMemberByIndex(CSteamID steamIDClan, int iUser) override { return SteamFriends()->GetChatMemberByIndex(steamIDClan, iUser); }
+	virtual bool SendClanChatMessage(CSteamID steamIDClanChat, const char* pchText) override { return SteamFriends()->SendClanChatMessage(steamIDClanChat, pchText); }
+	virtual int GetClanChatMessage(CSteamID steamIDClanChat, int iMessage, void* prgchText, int cchTextMax, EChatEntryType* peChatEntryType, CSteamID* psteamidChatter) override { return SteamFriends()->GetClanChatMessage(steamIDClanChat, iMessage, prgchText, cchTextMax, peChatEntryType, psteamidChatter); }
+	virtual bool IsClanChatAdmin(CSteamID steamIDClanChat, CSteamID steamIDUser) override { return SteamFriends()->IsClanChatAdmin(steamIDClanChat, steamIDUser); }
+	virtual bool IsClanChatWindowOpenInSteam(CSteamID steamIDClanChat) override { return SteamFriends()->IsClanChatWindowOpenInSteam(steamIDClanChat); }
+	virtual bool OpenClanChatWindowInSteam(CSteamID steamIDClanChat) override { return SteamFriends()->OpenClanChatWindowInSteam(steamIDClanChat); }
+	virtual bool CloseClanChatWindowInSteam(CSteamID steamIDClanChat) override { return SteamFriends()->CloseClanChatWindowInSteam(steamIDClanChat); }
+	virtual bool SetListenForFriendsMessages(bool bInterceptEnabled) override { return SteamFriends()->SetListenForFriendsMessages(bInterceptEnabled); }
+	virtual bool ReplyToFriendMessage(CSteamID steamIDFriend, const char* pchMsgToSend) override { return SteamFriends()->ReplyToFriendMessage(steamIDFriend, pchMsgToSend); }
+	virtual int GetFriendMessage(CSteamID steamIDFriend, int iMessageID, void* pvData, int cubData, EChatEntryType* peChatEntryType) override { return SteamFriends()->GetFriendMessage(steamIDFriend, iMessageID, pvData, cubData, peChatEntryType); }
+	virtual SteamAPICall_t GetFollowerCount(CSteamID steamID) override { return SteamFriends()->GetFollowerCount(steamID); }
+	virtual SteamAPICall_t IsFollowing(CSteamID steamID) override { return SteamFriends()->IsFollowing(steamID); }
+	virtual SteamAPICall_t EnumerateFollowingList(uint32 unStartIndex) override { return SteamFriends()->EnumerateFollowingList(unStartIndex); }
+	virtual bool IsClanPublic(CSteamID steamIDClan) override { return SteamFriends()->IsClanPublic(steamIDClan); }
+	virtual bool IsClanOfficialGameGroup(CSteamID steamIDClan) override { return SteamFriends()->IsClanOfficialGameGroup(steamIDClan); }
+};
+
+class FSteamworksUser final : public ISteamBridgeUser
+{
+public:
+	virtual HSteamUser GetHSteamUser() override { return SteamUser()->GetHSteamUser(); }
+	virtual bool BLoggedOn() override { return SteamUser()->BLoggedOn(); }
+	virtual CSteamID GetSteamID() override { return SteamUser()->GetSteamID(); }
+	virtual int InitiateGameConnection(void* pAuthBlob, int cbMaxAuthBlob, CSteamID steamIDGameServer, uint32 unIPServer, uint16 usPortServer, bool bSecure) override { return SteamUser()->InitiateGameConnection(pAuthBlob, cbMaxAuthBlob, steamIDGameServer, unIPServer, usPortServer, bSecure); }
+	virtual void TerminateGameConnection(uint32 unIPServer, uint16 usPortServer) override { SteamUser()->TerminateGameConnection(unIPServer, usPortServer); }
+	virtual void StartVoiceRecording() override { SteamUser()->StartVoiceRecording(); }
+	virtual void StopVoiceRecording() override { SteamUser()->StopVoiceRecording(); }
+	virtual EVoiceResult GetAvailableVoice(uint32* pcbCompressed) override { return SteamUser()->GetAvailableVoice(pcbCompressed); }
+	virtual EVoiceResult GetVoice(bool bWantCompressed, void* pDestBuffer, uint32 cbDestBufferSize, uint32* nBytesWritten) override { return SteamUser()->GetVoice(bWantCompressed, pDestBuffer, cbDestBufferSize, nBytesWritten); }
+	virtual EVoiceResult DecompressVoice(const void* pCompressed, uint32 cbCompressed, void* pDestBuffer, uint32 cbDestBufferSize, uint32* nBytesWritten, uint32 nDesiredSampleRate) override { return SteamUser()->DecompressVoice(pCompressed, cbCompressed, pDestBuffer, cbDestBufferSize, nBytesWritten, nDesiredSampleRate); }
+	virtual uint32 GetVoiceOptimalSampleRate() override { return SteamUser()->GetVoiceOptimalSampleRate(); }
+	virtual HAuthTicket GetAuthSessionTicket(void* pTicket, int cbMaxTicket, uint32* pcbTicket) override { return SteamUser()->GetAuthSessionTicket(pTicket, cbMaxTicket, pcbTicket); }
+	virtual EBeginAuthSessionResult BeginAuthSession(const void* pAuthTicket, int cbAuthTicket, CSteamID steamID) override { return SteamUser()->BeginAuthSession(pAuthTicket, cbAuthTicket, steamID); }
+	virtual void EndAuthSession(CSteamID steamID) override { SteamUser()->EndAuthSession(steamID); }
+	virtual void CancelAuthTicket(HAuthTicket hAuthTicket) override { SteamUser()->CancelAuthTicket(hAuthTicket); }
+	virtual EUserHasLicenseForAppResult UserHasLicenseForApp(CSteamID steamID, AppId_t appID) override { return SteamUser()->UserHasLicenseForApp(steamID, appID); }
+	virtual bool BIsBehindNAT() override { return SteamUser()->BIsBehindNAT(); }
+	virtual void AdvertiseGame(CSteamID steamIDGameServer, uint32 unIPServer, uint16 usPortServer) override { SteamUser()->AdvertiseGame(steamIDGameServer, unIPServer, usPortServer); }
+	virtual bool GetEncryptedAppTicket(void* pTicket, int cbMaxTicket, uint32* pcbTicket) override { return SteamUser()->GetEncryptedAppTicket(pTicket, cbMaxTicket, pcbTicket); }
+	virtual int GetGameBadgeLevel(int nSeries, bool bFoil) override { return SteamUser()->GetGameBadgeLevel(nSeries, bFoil); }
+	virtual int GetPlayerSteamLevel() override { return SteamUser()->GetPlayerSteamLevel(); }
+	virtual bool BIsPhoneVerified() override { return SteamUser()->BIsPhoneVerified(); }
+	virtual bool BIsTwoFactorEnabled() override { return SteamUser()->BIsTwoFactorEnabled(); }
+	virtual bool BIsPhoneIdentifying() override { return SteamUser()->BIsPhoneIdentifying(); }
+	virtual bool BIsPhoneRequiringVerification() override { return SteamUser()->BIsPhoneRequiringVerification(); }
+	virtual SteamAPICall_t GetDurationControl() override { return SteamUser()->GetDurationControl(); }
+};
+
+class FSteamworksGameServer final : public ISteamBridgeGameServer
+{
+public:
+	virtual void SetProduct(const char* pszProduct) override { SteamGameServer()->SetProduct(pszProduct); }
+	virtual void SetGameDescription(const char* pszGameDescription) override { SteamGameServer()->SetGameDescription(pszGameDescription); }
+	virtual void SetModDir(const char* pszModDir) override { SteamGameServer()->SetModDir(pszModDir); }
+	virtual void SetDedicatedServer(bool bDedicated) override { SteamGameServer()->SetDedicatedServer(bDedicated); }
+	virtual void LogOn(const char* pszToken) override { SteamGameServer()->LogOn(pszToken); }
+	virtual void LogOnAnonymous() override { SteamGameServer()->LogOnAnonymous(); }
+	virtual void LogOff() override { SteamGameServer()->LogOff(); }
+	virtual bool BLoggedOn() override { return SteamGameServer()->BLoggedOn(); }
+	virtual bool BSecure() override { return SteamGameServer()->BSecure(); }
+	virtual CSteamID GetSteamID() override { return SteamGameServer()->GetSteamID(); }
+	virtual bool WasRestartRequested() override { return SteamGameServer()->WasRestartRequested(); }
+	virtual void SetMaxPlayerCount(int cPlayersMax) override { SteamGameServer()->SetMaxPlayerCount(cPlayersMax); }
+	virtual void SetBotPlayerCount(int cBotplayers) override { SteamGameServer()->SetBotPlayerCount(cBotplayers); }
+	virtual void SetServerName(const char* pszServerName) override { SteamGameServer()->SetServerName(pszServerName); }
+	virtual void SetMapName(const char* pszMapName) override { SteamGameServer()->SetMapName(pszMapName); }
+	virtual void SetPasswordProtected(bool bPasswordProtected) override { SteamGameServer()->SetPasswordProtected(bPasswordProtected); }
+	virtual void SetSpectatorPort(uint16 unSpectatorPort) override { SteamGameServer()->SetSpectatorPort(unSpectatorPort); }
+	virtual void SetSpectatorServerName(const char* pszSpectatorServerName) override { SteamGameServer()->SetSpectatorServerName(pszSpectatorServerName); }
+	virtual void ClearAllKeyValues() override { SteamGameServer()->ClearAllKeyValues(); }
+	virtual void SetKeyValue(const char* pKey, const char* pValue) override { SteamGameServer()->SetKeyValue(pKey, pValue); }
+	virtual void SetGameTags(const char* pchGameTags) override { SteamGameServer()->SetGameTags(pchGameTags); }
+	virtual void SetGameData(const char* pchGameData) override { SteamGameServer()->SetGameData(pchGameData); }
+	virtual void SetRegion(const char* pszRegion) override { SteamGameServer()->SetRegion(pszRegion); }
+	virtual HAuthTicket GetAuthSessionTicket(void* pTicket, int cbMaxTicket, uint32* pcbTicket) override { return SteamGameServer()->GetAuthSessionTicket(pTicket, cbMaxTicket, pcbTicket); }
+	virtual EBeginAuthSessionResult BeginAuthSession(const void* pAuthTicket, int cbAuthTicket, CSteamID steamID) override { return SteamGameServer()->BeginAuthSession(pAuthTicket, cbAuthTicket, steamID); }
+	virtual void EndAuthSession(CSteamID steamID) override { SteamGameServer()->EndAuthSession(steamID); }
+	virtual void CancelAuthTicket(HAuthTicket hAuthTicket) override { SteamGameServer()->CancelAuthTicket(hAuthTicket); }
+	virtual EUserHasLicenseForAppResult UserHasLicenseForApp(CSteamID steamID, AppId_t appID) override { return SteamGameServer()->UserHasLicenseForApp(steamID, appID); }
+	virtual bool RequestUserGroupStatus(CSteamID steamIDUser, CSteamID steamIDGroup) override { return SteamGameServer()->RequestUserGroupStatus(steamIDUser, steamIDGroup); }
+	virtual void EnableHeartbeats(bool bActive) override { SteamGameServer()->EnableHeartbeats(bActive); }
+	virtual void SetHeartbeatInterval(int iHeartbeatInterval) override { SteamGameServer()->SetHeartbeatInterval(iHeartbeatInterval); }
+	virtual void ForceHeartbeat() override { SteamGameServer()->ForceHeartbeat(); }
+	virtual SteamAPICall_t AssociateWithClan(CSteamID steamIDClan) override { return SteamGameServer()->AssociateWithClan(steamIDClan); }
+};
+
+class FSteamworksHTTP final : public ISteamBridgeHTTP
+{
+public:
+	virtual HTTPRequestHandle CreateHTTPRequest(EHTTPMethod eHTTPRequestMethod, const char* pchAbsoluteURL) override { return SteamHTTP()->CreateHTTPRequest(eHTTPRequestMethod, pchAbsoluteURL); }
+	virtual bool SetHTTPRequestContextValue(HTTPRequestHandle hRequest, uint64 ulContextValue) override { return SteamHTTP()->SetHTTPRequestContextValue(hRequest, ulContextValue); }
+	virtual bool SetHTTPRequestNetworkActivityTimeout(HTTPRequestHandle hRequest, uint32 unTimeoutSeconds) override { return SteamHTTP()->SetHTTPRequestNetworkActivityTimeout(hRequest, unTimeoutSeconds); }
+	virtual bool SetHTTPRequestHeaderValue(HTTPRequestHandle hRequest, const char* pchHeaderName, const char* pchHeaderValue) override { return SteamHTTP()->SetHTTPRequestHeaderValue(hRequest, pchHeaderName, pchHeaderValue); }
+	virtual bool SetHTTPRequestGetOrPostParameter(HTTPRequestHandle hRequest, const char* pchParamName, const char* pchParamValue) override { return SteamHTTP()->SetHTTPRequestGetOrPostParameter(hRequest, pchParamName, pchParamValue); }
+	virtual bool SendHTTPRequest(HTTPRequestHandle hRequest, SteamAPICall_t* pCallHandle) override { return SteamHTTP()->SendHTTPRequest(hRequest, pCallHandle); }
+	virtual bool SendHTTPRequestAndStreamResponse(HTTPRequestHandle hRequest, SteamAPICall_t* pCallHandle) override { return SteamHTTP()->SendHTTPRequestAndStreamResponse(hRequest, pCallHandle); }
+	virtual bool DeferHTTPRequest(HTTPRequestHandle hRequest) override { return SteamHTTP()->DeferHTTPRequest(hRequest); }
+	virtual bool PrioritizeHTTPRequest(HTTPRequestHandle hRequest) override { return SteamHTTP()->PrioritizeHTTPRequest(hRequest); }
+	virtual bool GetHTTPResponseHeaderSize(HTTPRequestHandle hRequest, const char* pchHeaderName, uint32* unResponseHeaderSize) override { return SteamHTTP()->GetHTTPResponseHeaderSize(hRequest, pchHeaderName, unResponseHeaderSize); }
+	virtual bool GetHTTPResponseHeaderValue(HTTPRequestHandle hRequest, const char* pchHeaderName, uint8* pHeaderValueBuffer, uint32 unBufferSize) override { return SteamHTTP()->GetHTTPResponseHeaderValue(hRequest, pchHeaderName, pHeaderValueBuffer, unBufferSize); }
+	virtual bool GetHTTPResponseBodySize(HTTPRequestHandle hRequest, uint32* unBodySize) override { return SteamHTTP()->GetHTTPResponseBodySize(hRequest, unBodySize); }
+	virtual bool GetHTTPResponseBodyData(HTTPRequestHandle hRequest, uint8* pBodyDataBuffer, uint32 unBufferSize) override { return SteamHTTP()->GetHTTPResponseBodyData(hRequest, pBodyDataBuffer, unBufferSize); }
+	virtual bool GetHTTPStreamingResponseBodyData(HTTPRequestHandle hRequest, uint32 cOffset, uint8* pBodyDataBuffer, uint32 unBufferSize) override { return SteamHTTP()->GetHTTPStreamingResponseBodyData(hRequest, cOffset, pBodyDataBuffer, unBufferSize); }
+	virtual bool ReleaseHTTPRequest(HTTPRequestHandle hRequest) override { return SteamHTTP()->ReleaseHTTPRequest(hRequest); }
+	virtual bool GetHTTPDownloadProgressPct(HTTPRequestHandle hRequest, float* pflPercentOut) override { return SteamHTTP()->GetHTTPDownloadProgressPct(hRequest, pflPercentOut); }
+	virtual bool SetHTTPRequestRawPostBody(HTTPRequestHandle hRequest, const char* pchContentType, uint8* pubBody, uint32 unBodyLen) override { return SteamHTTP()->SetHTTPRequestRawPostBody(hRequest, pchContentType, pubBody, unBodyLen); }
+	virtual HTTPCookieContainerHandle CreateCookieContainer(bool bAllowResponsesToModify) override { return SteamHTTP()->CreateCookieContainer(bAllowResponsesToModify); }
+	virtual bool ReleaseCookieContainer(HTTPCookieContainerHandle hCookieContainer) override { return SteamHTTP()->ReleaseCookieContainer(hCookieContainer); }
+	virtual bool SetCookie(HTTPCookieContainerHandle hCookieContainer, const char* pchHost, const char* pchUrl, const char* pchCookie) override { return SteamHTTP()->SetCookie(hCookieContainer, pchHost, pchUrl, pchCookie); }
+	virtual bool SetHTTPRequestCookieContainer(HTTPRequestHandle hRequest, HTTPCookieContainerHandle hCookieContainer) override { return SteamHTTP()->SetHTTPRequestCookieContainer(hRequest, hCookieContainer); }
+	virtual bool SetHTTPRequestUserAgentInfo(HTTPRequestHandle hRequest, const char* pchUserAgentInfo) override { return SteamHTTP()->SetHTTPRequestUserAgentInfo(hRequest, pchUserAgentInfo); }
+	virtual bool SetHTTPRequestRequiresVerifiedCertificate(HTTPRequestHandle hRequest, bool bRequireVerifiedCertificate) override { return SteamHTTP()->SetHTTPRequestRequiresVerifiedCertificate(hRequest, bRequireVerifiedCertificate); }
+	virtual bool SetHTTPRequestAbsoluteTimeoutMS(HTTPRequestHandle hRequest, uint32 unMilliseconds) override { return SteamHTTP()->SetHTTPRequestAbsoluteTimeoutMS(hRequest, unMilliseconds); }
+	virtual bool GetHTTPRequestWasTimedOut(HTTPRequestHandle hRequest, bool* pbWasTimedOut) override { return SteamHTTP()->GetHTTPRequestWasTimedOut(hRequest, pbWasTimedOut); }
+};
+
+class FSteamworksInventory final : public ISteamBridgeInventory
+{
+public:
+	virtual bool GetAllItems(SteamInventoryResult_t* pResultHandle) override { return SteamInventory()->GetAllItems(pResultHandle); }
+	virtual bool AddPromoItem(SteamInventoryResult_t* pResultHandle, SteamItemDef_t itemDef) override { return SteamInventory()->AddPromoItem(pResultHandle, itemDef); }
+	virtual bool AddPromoItems(SteamInventoryResult_t* pResultHandle, const SteamItemDef_t* pArrayItemDefs, uint32 unArrayLength) override { return SteamInventory()->AddPromoItems(pResultHandle, pArrayItemDefs, unArrayLength); }
+	virtual bool ConsumeItem(SteamInventoryResult_t* pResultHandle, SteamItemInstanceID_t itemConsume, uint32 unQuantity) override { return SteamInventory()->ConsumeItem(pResultHandle, itemConsume, unQuantity); }
+	virtual bool CheckResultSteamID(SteamInventoryResult_t resultHandle, CSteamID steamIDExpected) override { return SteamInventory()->CheckResultSteamID(resultHandle, steamIDExpected); }
+	virtual bool DeserializeResult(SteamInventoryResult_t* pOutResultHandle, const void* pBuffer, uint32 unBufferSize, bool bRESERVED_MUST_BE_FALSE) override { return SteamInventory()->DeserializeResult(pOutResultHandle, pBuffer, unBufferSize, bRESERVED_MUST_BE_FALSE); }
+	virtual void DestroyResult(SteamInventoryResult_t resultHandle) override { SteamInventory()->DestroyResult(resultHandle); }
+	virtual bool GetItemPrice(SteamItemDef_t iDefinition, uint64* pCurrentPrice, uint64* pBasePrice) override { return SteamInventory()->GetItemPrice(iDefinition, pCurrentPrice, pBasePrice); }
+	virtual uint32 GetNumItemsWithPrices() override { return SteamInventory()->GetNumItemsWithPrices(); }
+};
+
+class FSteamworksUtils final : public ISteamBridgeUtils
+{
+public:
+	virtual bool GetImageSize(int iImage, uint32* pnWidth, uint32* pnHeight) override { return SteamUtils()->GetImageSize(iImage, pnWidth, pnHeight); }
+	virtual bool GetImageRGBA(int iImage, uint8* pubDest, int nDestBufferSize) override { return SteamUtils()->GetImageRGBA(iImage, pubDest, nDestBufferSize); }
+};
+
+/**
+ * The default backend, calls Steam.
+ */
+class FSteamworksBackend final : public ISteamBridgeBackend
+{
+public:
+	virtual ISteamBridgeFriends* Friends() override { return &m_Friends; }
+	virtual ISteamBridgeUser* User() override { return &m_User; }
+	virtual ISteamBridgeGameServer* GameServer() override { return &m_GameServer; }
+	virtual ISteamBridgeHTTP* HTTP() override { return &m_HTTP; }
+	virtual ISteamBridgeInventory* Inventory() override { return &m_Inventory; }
+	virtual ISteamBridgeUtils* Utils() override { return &m_Utils; }
+
+private:
+	FSteamworksFriends m_Friends;
+	FSteamworksUser m_User;
+	FSteamworksGameServer m_GameServer;
+	FSteamworksHTTP m_HTTP;
+	FSteamworksInventory m_Inventory;
+	FSteamworksUtils m_Utils;
+};
@@ -4,23 +4,27 @@
 
 #include "Core/SteamApps.h"
 
+#include "SteamBridgeStats.h"
+#include "SteamBridgeTrace.h"
 #include "SteamBridgeUtils.h"
+#include "SteamCallbackDispatcher.h"
 
 USteamApps::USteamApps()
 {
-	//OnDlcInstalledCallback.Register(this, &USteamApps::OnDlcInstalled);
-	//OnFileDetailsResultCallback.Register(this, &USteamApps::OnFileDetailsResult);
-	//OnNewUrlLaunchParametersCallback.Register(this, &USteamApps::OnNewUrlLaunchParameters);
+	//FSteamCallbackDispatcher::RegisterLazy(OnDlcInstalledCallback, this, &USteamApps::OnDlcInstalled, m_OnDlcInstalled);
+	//FSteamCallbackDispatcher::RegisterLazy(OnFileDetailsResultCallback, this, &USteamApps::OnFileDetailsResult, m_OnFileDetailsResult);
+	//FSteamCallbackDispatcher::RegisterLazy(OnNewUrlLaunchParametersCallback, this, &USteamApps::OnNewUrlLaunchParameters, m_OnNewUrlLaunchParameters);
 }
 
 USteamApps::~USteamApps()
 {
-	OnDlcInstalledCallback.Unregister();
-	OnNewUrlLaunchParametersCallback.Unregister();
+	FSteamCallbackDispatcher::Unregister(OnDlcInstalledCallback);
+	FSteamCallbackDispatcher::Unregister(OnNewUrlLaunchParametersCallback);
 }
 
 bool USteamApps::BGetDLCDataByIndex(int32 DLC, int32& AppID, bool& bAvailable, FString& Name)
 {
+	STEAMBRIDGE_TRACE_SCOPE(USteamApps::BGetDLCDataByIndex);
 	if (DLC > GetDLCCount())
 	{
 		return false;
@@ -36,6 +40,7 @@ bool USteamApps::BGetDLCDataByIndex(int32 DLC, int32& AppID, bool& bAvailable, F
 
 int32 USteamApps::GetAppInstallDir(int32 AppID, FString& Folder)
 {
+	STEAMBRIDGE_TRACE_SCOPE(USteamApps::GetAppInstallDir);
 	const uint32 buffer = 1024 * 1024 * 10;
 	TArray<char> TempPath;
 	TempPath.SetNum(buffer);
@@ -51,6 +56,7 @@ int32 USteamApps::GetAppInstallDir(int32 AppID, FString& Folder)
 
 bool USteamApps::GetCurrentBetaName(FString& Name)
 {
+	STEAMBRIDGE_TRACE_SCOPE(USteamApps::GetCurrentBetaName);
 	TArray<char> TempStr;
 	bool bResult = SteamApps()->GetCurrentBetaName(TempStr.GetData(), 4096);
 	Name = UTF8_TO_TCHAR(TempStr.GetData());
@@ -59,6 +65,7 @@ bool USteamApps::GetCurrentBetaName(FString& Name)
 
 bool USteamApps::GetDlcDownloadProgress(int32 AppID, int64& BytesDownloaded, int64& BytesTotal)
 {
+	STEAMBRIDGE_TRACE_SCOPE(USteamApps::GetDlcDownloadProgress);
 	uint64 TempDownloaded = 0, TempTotal = 0;
 	bool bResult = SteamApps()->GetDlcDownloadProgress(AppID, &TempDownloaded, &TempTotal);
 	BytesDownloaded = TempDownloaded;
@@ -68,6 +75,7 @@ bool USteamApps::GetDlcDownloadProgress(int32 AppID, int64& BytesDownloaded, int
 
 int32 USteamApps::GetLaunchCommandLine(FString& CommandLine)
 {
+	STEAMBRIDGE_TRACE_SCOPE(USteamApps::GetLaunchCommandLine);
 	TArray<char> TempStr;
 	int32 res = SteamApps()->GetLaunchCommandLine(TempStr.GetData(), 2048);
 	CommandLine = UTF8_TO_TCHAR(TempStr.GetData());
@@ -76,15 +84,18 @@ int32 USteamApps::GetLaunchCommandLine(FString& CommandLine)
 
 void USteamApps::OnDlcInstalled(DlcInstalled_t* pParam)
 {
+	STEAMBRIDGE_CALLBACK_SCOPE(OnDlcInstalled, pParam);
 	m_OnDlcInstalled.Broadcast((int32)pParam->m_nAppID);
 }
 
 void USteamApps::OnFileDetailsResult(FileDetailsResult_t* pParam)
 {
+	STEAMBRIDGE_CALLBACK_SCOPE(OnFileDetailsResult, pParam);
 	m_OnFileDetailsResult.Broadcast((ESteamResult)pParam->m_eResult, (int64)pParam->m_ulFileSize, UTF8_TO_TCHAR(pParam->m_FileSHA), (int32)pParam->m_unFlags);
 }
 
 void USteamApps::OnNewUrlLaunchParameters(NewUrlLaunchParameters_t* pParam)
 {
+	STEAMBRIDGE_CALLBACK_SCOPE(OnNewUrlLaunchParameters, pParam);
 	m_OnNewUrlLaunchParameters.Broadcast();
 }
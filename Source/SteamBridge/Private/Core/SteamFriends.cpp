@@ -3,91 +3,271 @@
 #include "Core/SteamFriends.h"
 
 #include "Engine/Texture2D.h"
+#include "Misc/Paths.h"
 #include "Steam.h"
+#include "SteamBridgeSettings.h"
+#include "SteamBridgeStats.h"
+#include "SteamBridgeTrace.h"
+#include "SteamCallbackDispatcher.h"
+#include "SteamEnumStrings.h"
+
+// A user information request that hasn't produced a PersonaStateChange by then is issued again (or expired)
+static constexpr double UserInformationTimeoutSeconds = 10.0;
+
+// How often timed out user information requests and stale request memos are swept
+static constexpr double RequestExpiryIntervalSeconds = 1.0;
+
+// How many groups RefreshClanActivityCounts asks Steam about per DownloadClanActivityCounts call
+static constexpr int32 ClanActivityCountsBatchSize = 16;
+
+// Steam chat messages are at most 2048 UTF-8 characters, 8192 bytes plus the terminator
+static constexpr int32 MaxChatMessageBytes = 8193;
+
+/** What GetClanChatMessage and GetFriendMessage read messages into, rather than allocating per message. Callbacks are dispatched on the game thread, so it's only used there. */
+static ANSICHAR GChatMessageBuffer[MaxChatMessageBytes];
+
+/** Terminates the message Steam wrote into GChatMessageBuffer. */
+static const ANSICHAR* TerminateChatMessage(int32 Length)
+{
+	GChatMessageBuffer[FMath::Clamp(Length, 0, MaxChatMessageBytes - 1)] = '\0';
+	return GChatMessageBuffer;
+}
+
+// The width and height Steam returns avatars at, by ESteamAvatarSize
+static constexpr int32 AvatarImageSizes[] = {32, 64, 184};
+
+/** Clears the size from the user's pending avatars, returning whether it was pending. */
+static bool TakePendingAvatar(TMap<uint64, uint8>& PendingAvatars, uint64 SteamID, ESteamAvatarSize AvatarSize)
+{
+	uint8* const PendingSizes = PendingAvatars.Find(SteamID);
+	if (PendingSizes == nullptr || (*PendingSizes & (1 << (uint8)AvatarSize)) == 0)
+	{
+		return false;
+	}
+
+	*PendingSizes &= ~(1 << (uint8)AvatarSize);
+	if (*PendingSizes == 0)
+	{
+		PendingAvatars.Remove(SteamID);
+	}
+	return true;
+}
+
+/** Overwrites Out keeping its allocation, which a plain assignment doesn't. */
+static void AssignUTF8(FString& Out, const char* In)
+{
+	const FUTF8ToTCHAR Converted(In);
+	Out.Reset(Converted.Length());
+	Out.AppendChars(Converted.Get(), Converted.Length());
+}
+
+/** Resizes the array for a column, or empties it (keeping its allocation) when the column wasn't asked for. */
+template <class T>
+static void SizeQueryColumn(TArray<T>& Column, bool bRequested, int32 Num)
+{
+	Column.SetNum(bRequested ? Num : 0, false);
+}
 
 USteamFriends::USteamFriends()
 {
-	OnAvatarImageLoadedCallback.Register(this, &USteamFriends::OnAvatarImageLoaded);
-	OnClanOfficerListResponseCallback.Register(this, &USteamFriends::OnClanOfficerListResponse);
-	OnDownloadClanActivityCountsResultCallback.Register(this, &USteamFriends::OnDownloadClanActivityCountsResult);
-	OnFriendRichPresenceUpdateCallback.Register(this, &USteamFriends::OnFriendRichPresenceUpdate);
-	OnFriendsEnumerateFollowingListCallback.Register(this, &USteamFriends::OnFriendsEnumerateFollowingList);
-	OnFriendsGetFollowerCountCallback.Register(this, &USteamFriends::OnFriendsGetFollowerCount);
-	OnFriendsIsFollowingCallback.Register(this, &USteamFriends::OnFriendsIsFollowing);
-	OnGameConnectedChatJoinCallback.Register(this, &USteamFriends::OnGameConnectedChatJoin);
-	OnGameConnectedChatLeaveCallback.Register(this, &USteamFriends::OnGameConnectedChatLeave);
-	OnGameConnectedClanChatMsgCallback.Register(this, &USteamFriends::OnGameConnectedClanChatMsg);
-	OnGameConnectedFriendChatMsgCallback.Register(this, &USteamFriends::OnGameConnectedFriendChatMsg);
-	OnGameLobbyJoinRequestedCallback.Register(this, &USteamFriends::OnGameLobbyJoinRequested);
-	OnGameOverlayActivatedCallback.Register(this, &USteamFriends::OnGameOverlayActivated);
-	OnGameRichPresenceJoinRequestedCallback.Register(this, &USteamFriends::OnGameRichPresenceJoinRequested);
-	OnGameServerChangeRequestedCallback.Register(this, &USteamFriends::OnGameServerChangeRequested);
-	OnJoinClanChatRoomCompletionResultCallback.Register(this, &USteamFriends::OnJoinClanChatRoomCompletionResult);
-	OnPersonaStateChangeCallback.Register(this, &USteamFriends::OnPersonaStateChange);
-	OnSetPersonaNameResponseCallback.Register(this, &USteamFriends::OnSetPersonaNameResponse);
+	FSteamCallbackDispatcher::RegisterLazy(OnAvatarImageLoadedCallback, this, &USteamFriends::OnAvatarImageLoaded, m_OnAvatarImageLoaded);
+	FSteamCallbackDispatcher::RegisterLazy(OnClanOfficerListResponseCallback, this, &USteamFriends::OnClanOfficerListResponse, m_OnClanOfficerListResponse);
+	FSteamCallbackDispatcher::RegisterLazy(OnDownloadClanActivityCountsResultCallback, this, &USteamFriends::OnDownloadClanActivityCountsResult, m_OnDownloadClanActivityCountsResult);
+	FSteamCallbackDispatcher::RegisterLazy(OnFriendRichPresenceUpdateCallback, this, &USteamFriends::OnFriendRichPresenceUpdate, m_OnFriendRichPresenceUpdate);
+	FSteamCallbackDispatcher::RegisterLazy(OnFriendsEnumerateFollowingListCallback, this, &USteamFriends::OnFriendsEnumerateFollowingList, m_OnFriendsEnumerateFollowingList);
+	FSteamCallbackDispatcher::RegisterLazy(OnFriendsGetFollowerCountCallback, this, &USteamFriends::OnFriendsGetFollowerCount, m_OnFriendsGetFollowerCount);
+	FSteamCallbackDispatcher::RegisterLazy(OnFriendsIsFollowingCallback, this, &USteamFriends::OnFriendsIsFollowing, m_OnFriendsIsFollowing);
+	FSteamCallbackDispatcher::RegisterLazy(OnGameConnectedChatJoinCallback, this, &USteamFriends::OnGameConnectedChatJoin, m_OnGameConnectedChatJoin);
+	FSteamCallbackDispatcher::RegisterLazy(OnGameConnectedChatLeaveCallback, this, &USteamFriends::OnGameConnectedChatLeave, m_OnGameConnectedChatLeave);
+	FSteamCallbackDispatcher::RegisterLazy(OnGameConnectedClanChatMsgCallback, this, &USteamFriends::OnGameConnectedClanChatMsg, m_OnGameConnectedClanChatMsg);
+	FSteamCallbackDispatcher::RegisterLazy(OnGameConnectedFriendChatMsgCallback, this, &USteamFriends::OnGameConnectedFriendChatMsg, m_OnGameConnectedFriendChatMsg);
+	FSteamCallbackDispatcher::RegisterLazy(OnGameLobbyJoinRequestedCallback, this, &USteamFriends::OnGameLobbyJoinRequested, m_OnGameLobbyJoinRequested);
+	FSteamCallbackDispatcher::RegisterLazy(OnGameOverlayActivatedCallback, this, &USteamFriends::OnGameOverlayActivated, m_OnGameOverlayActivated);
+	FSteamCallbackDispatcher::RegisterLazy(OnGameRichPresenceJoinRequestedCallback, this, &USteamFriends::OnGameRichPresenceJoinRequested, m_OnGameRichPresenceJoinRequested);
+	FSteamCallbackDispatcher::RegisterLazy(OnGameServerChangeRequestedCallback, this, &USteamFriends::OnGameServerChangeRequested, m_OnGameServerChangeRequested);
+	FSteamCallbackDispatcher::RegisterLazy(OnJoinClanChatRoomCompletionResultCallback, this, &USteamFriends::OnJoinClanChatRoomCompletionResult, m_OnJoinClanChatRoomCompletionResult);
+	FSteamCallbackDispatcher::RegisterLazy(OnPersonaStateChangeCallback, this, &USteamFriends::OnPersonaStateChange, m_OnPersonaStateChange);
+	FSteamCallbackDispatcher::RegisterLazy(OnSetPersonaNameResponseCallback, this, &USteamFriends::OnSetPersonaNameResponse, m_OnSetPersonaNameResponse);
+	FSteamCallbackDispatcher::Get().AddLazyTrigger(OnPersonaStateChangeCallback, m_OnPersonaStateChangeFlags);
+
+	FSteamCallbackDispatcher::Get().OnPostDispatch().AddUObject(this, &USteamFriends::FlushPersonaStateChanges);
+	FSteamCallbackDispatcher::Get().OnPostDispatch().AddUObject(this, &USteamFriends::PublishFriendsSnapshot);
+	FSteamCallbackDispatcher::Get().OnPostDispatch().AddUObject(this, &USteamFriends::PublishRichPresence);
+	FSteamCallbackDispatcher::Get().OnPostDispatch().AddUObject(this, &USteamFriends::PumpUserInformationPrefetch);
+	FSteamCallbackDispatcher::Get().OnPostDispatch().AddUObject(this, &USteamFriends::ExpireRequests);
 }
 
 USteamFriends::~USteamFriends()
 {
-	OnAvatarImageLoadedCallback.Unregister();
-	OnClanOfficerListResponseCallback.Unregister();
-	OnDownloadClanActivityCountsResultCallback.Unregister();
-	OnFriendRichPresenceUpdateCallback.Unregister();
-	OnFriendsEnumerateFollowingListCallback.Unregister();
-	OnFriendsGetFollowerCountCallback.Unregister();
-	OnFriendsIsFollowingCallback.Unregister();
-	OnGameConnectedChatJoinCallback.Unregister();
-	OnGameConnectedChatLeaveCallback.Unregister();
-	OnGameConnectedClanChatMsgCallback.Unregister();
-	OnGameConnectedFriendChatMsgCallback.Unregister();
-	OnGameLobbyJoinRequestedCallback.Unregister();
-	OnGameOverlayActivatedCallback.Unregister();
-	OnGameRichPresenceJoinRequestedCallback.Unregister();
-	OnGameServerChangeRequestedCallback.Unregister();
-	OnJoinClanChatRoomCompletionResultCallback.Unregister();
-	OnPersonaStateChangeCallback.Unregister();
-	OnSetPersonaNameResponseCallback.Unregister();
+	// Unregistering drops the lazy registrations along with whatever retained them
+	FSteamCallbackDispatcher::Unregister(OnAvatarImageLoadedCallback);
+	FSteamCallbackDispatcher::Unregister(OnClanOfficerListResponseCallback);
+	FSteamCallbackDispatcher::Unregister(OnDownloadClanActivityCountsResultCallback);
+	FSteamCallbackDispatcher::Unregister(OnFriendRichPresenceUpdateCallback);
+	FSteamCallbackDispatcher::Unregister(OnFriendsEnumerateFollowingListCallback);
+	FSteamCallbackDispatcher::Unregister(OnFriendsGetFollowerCountCallback);
+	FSteamCallbackDispatcher::Unregister(OnFriendsIsFollowingCallback);
+	FSteamCallbackDispatcher::Unregister(OnGameConnectedChatJoinCallback);
+	FSteamCallbackDispatcher::Unregister(OnGameConnectedChatLeaveCallback);
+	FSteamCallbackDispatcher::Unregister(OnGameConnectedClanChatMsgCallback);
+	FSteamCallbackDispatcher::Unregister(OnGameConnectedFriendChatMsgCallback);
+	FSteamCallbackDispatcher::Unregister(OnGameLobbyJoinRequestedCallback);
+	FSteamCallbackDispatcher::Unregister(OnGameOverlayActivatedCallback);
+	FSteamCallbackDispatcher::Unregister(OnGameRichPresenceJoinRequestedCallback);
+	FSteamCallbackDispatcher::Unregister(OnGameServerChangeRequestedCallback);
+	FSteamCallbackDispatcher::Unregister(OnJoinClanChatRoomCompletionResultCallback);
+	FSteamCallbackDispatcher::Unregister(OnPersonaStateChangeCallback);
+	FSteamCallbackDispatcher::Unregister(OnSetPersonaNameResponseCallback);
+
+	FSteamCallbackDispatcher::Get().OnPostDispatch().RemoveAll(this);
 }
 
 void USteamFriends::ActivateGameOverlay(const ESteamGameOverlayTypes OverlayType)
 {
-	const FString Str = USteamBridgeUtils::GetEnumValueAsStringParsed(USteamBridgeUtils::GetEnumValueAsString<ESteamGameOverlayTypes>("ESteamGameOverlayTypes", OverlayType));
-	SteamFriends()->ActivateGameOverlay(TCHAR_TO_ANSI(*Str));
+	STEAMBRIDGE_TRACE_SCOPE(USteamFriends::ActivateGameOverlay);
+	SteamBridgeFriends()->ActivateGameOverlay(FSteamEnumStrings::ToString(OverlayType));
 }
 
 void USteamFriends::ActivateGameOverlayToUser(const ESteamGameUserOverlayTypes OverlayType, FSteamID SteamID)
 {
-	const FString Str = USteamBridgeUtils::GetEnumValueAsStringParsed(USteamBridgeUtils::GetEnumValueAsString<ESteamGameUserOverlayTypes>("ESteamGameUserOverlayTypes", OverlayType));
-	SteamFriends()->ActivateGameOverlayToUser(TCHAR_TO_ANSI(*Str), SteamID.Value);
+	STEAMBRIDGE_TRACE_SCOPE(USteamFriends::ActivateGameOverlayToUser);
+	SteamBridgeFriends()->ActivateGameOverlayToUser(FSteamEnumStrings::ToString(OverlayType), SteamID.Value);
 }
 
-FSteamAPICall USteamFriends::DownloadClanActivityCounts(TArray<FSteamID>& SteamClanIDs, int32 ClansToRequest) const
+FSteamAPICall USteamFriends::DownloadClanActivityCountsForClans(const TArray<FSteamID>& SteamClanIDs) const
 {
+	STEAMBRIDGE_TRACE_SCOPE(USteamFriends::DownloadClanActivityCountsForClans);
 	TArray<CSteamID> TmpArray;
-	uint64 res = SteamFriends()->DownloadClanActivityCounts(TmpArray.GetData(), ClansToRequest);
+	TmpArray.Reserve(SteamClanIDs.Num());
+	for (const FSteamID& SteamClanID : SteamClanIDs)
+	{
+		TmpArray.Emplace(SteamClanID.Value);
+	}
+
+	return FSteamBridgeTrace::APICallIssued(SteamBridgeFriends()->DownloadClanActivityCounts(TmpArray.GetData(), TmpArray.Num()));
+}
+
+TFuture<TSteamCallResult<DownloadClanActivityCountsResult_t>> USteamFriends::DownloadClanActivityCountsAsync(const TArray<FSteamID>& SteamClanIDs) const
+{
+	STEAMBRIDGE_TRACE_SCOPE(USteamFriends::DownloadClanActivityCountsAsync);
+	return FSteamCallResults::Await<DownloadClanActivityCountsResult_t>(DownloadClanActivityCountsForClans(SteamClanIDs));
+}
 
-	for (int32 i = 0; i < ClansToRequest; i++)
+FSteamAPICall USteamFriends::DownloadClanActivityCounts(TArray<FSteamID>& SteamClanIDs, int32 ClansToRequest) const
+{
+	STEAMBRIDGE_TRACE_SCOPE(USteamFriends::DownloadClanActivityCounts);
+	if (ClansToRequest >= SteamClanIDs.Num())
 	{
-		SteamClanIDs.Add(TmpArray[i].ConvertToUint64());
+		return DownloadClanActivityCountsForClans(SteamClanIDs);
 	}
 
-	return res;
+	return DownloadClanActivityCountsForClans(TArray<FSteamID>(SteamClanIDs.GetData(), FMath::Max(ClansToRequest, 0)));
+}
+
+const FSteamClanCache& USteamFriends::GetClanCache() const
+{
+	return GetClanCacheMutable();
+}
+
+FSteamClanCache& USteamFriends::GetClanCacheMutable() const
+{
+	if (!m_ClanCache.IsValid())
+	{
+		m_ClanCache = MakeShared<FSteamClanCache>();
+		m_ClanCache->Load();
+	}
+
+	return *m_ClanCache;
+}
+
+bool USteamFriends::GetCachedClan(FSteamID SteamIDClan, FSteamClanInfo& Clan) const
+{
+	STEAMBRIDGE_TRACE_SCOPE(USteamFriends::GetCachedClan);
+	const FSteamClanInfo* const Found = GetClanCache().Find(SteamIDClan.Value);
+	if (Found == nullptr)
+	{
+		return false;
+	}
+
+	Clan = *Found;
+	return true;
+}
+
+void USteamFriends::RefreshClanCache()
+{
+	STEAMBRIDGE_TRACE_SCOPE(USteamFriends::RefreshClanCache);
+	// Creating the cache loads it
+	if (m_ClanCache.IsValid())
+	{
+		m_ClanCache->Load();
+	}
+	else
+	{
+		GetClanCacheMutable();
+	}
+}
+
+void USteamFriends::RefreshClanActivityCounts()
+{
+	STEAMBRIDGE_TRACE_SCOPE(USteamFriends::RefreshClanActivityCounts);
+	GetClanCacheMutable().RefreshActivityCounts(ClanActivityCountsBatchSize);
+}
+
+bool USteamFriends::GetCachedClanOfficers(FSteamID SteamIDClan, TArray<FSteamID>& Officers) const
+{
+	const TArray<FSteamID>* const Found = m_ClanCache.IsValid() ? m_ClanCache->FindOfficers(SteamIDClan.Value) : nullptr;
+	if (Found == nullptr)
+	{
+		return false;
+	}
+
+	Officers = *Found;
+	return true;
+}
+
+TFuture<TArray<FSteamID>> USteamFriends::GetClanOfficersAsync(FSteamID SteamIDClan) const
+{
+	STEAMBRIDGE_TRACE_SCOPE(USteamFriends::GetClanOfficersAsync);
+	TWeakPtr<FSteamClanCache> WeakCache = GetClanCacheMutable().AsShared();
+	return RequestClanOfficerListAsync(SteamIDClan).Then([WeakCache, SteamIDClan](TFuture<TSteamCallResult<ClanOfficerListResponse_t>> Future) {
+		const TSteamCallResult<ClanOfficerListResponse_t> Result = Future.Get();
+		const TSharedPtr<FSteamClanCache> Cache = WeakCache.Pin();
+		if (!Cache.IsValid() || Result.bIOFailure || !Result.Result.m_bSuccess)
+		{
+			return TArray<FSteamID>();
+		}
+
+		Cache->ReadOfficers(SteamIDClan.Value);
+		return *Cache->FindOfficers(SteamIDClan.Value);
+	});
+}
+
+int32 USteamFriends::GetFollowerCount(FSteamID SteamID) const
+{
+	STEAMBRIDGE_TRACE_SCOPE(USteamFriends::GetFollowerCount);
+	return m_FollowerCountRequests.Issue(SteamID.Value, [SteamID]() { return FSteamBridgeTrace::APICallIssued(SteamBridgeFriends()->GetFollowerCount(SteamID.Value)); },
+		GetDefault<USteamBridgeSettings>()->m_RequestMemoSeconds);
+}
+
+TFuture<TSteamCallResult<FriendsGetFollowerCount_t>> USteamFriends::GetFollowerCountAsync(FSteamID SteamID) const
+{
+	STEAMBRIDGE_TRACE_SCOPE(USteamFriends::GetFollowerCountAsync);
+	return m_FollowerCountRequests.Request(SteamID.Value, [SteamID]() { return FSteamBridgeTrace::APICallIssued(SteamBridgeFriends()->GetFollowerCount(SteamID.Value)); },
+		GetDefault<USteamBridgeSettings>()->m_RequestMemoSeconds);
 }
 
 int32 USteamFriends::GetClanChatMessage(FSteamID SteamIDClanChat, int32 MessageID, FString& Message, ESteamChatEntryType& ChatEntryType, FSteamID& SteamIDChatter)
 {
+	STEAMBRIDGE_TRACE_SCOPE(USteamFriends::GetClanChatMessage);
 	EChatEntryType TmpEntryType;
-	TArray<char> TmpMessage;
-	TmpMessage.SetNum(MAX_int32);
 	CSteamID TmpSteamID;
-	int32 res = SteamFriends()->GetClanChatMessage(SteamIDClanChat.Value, MessageID, TmpMessage.GetData(), MAX_int32, &TmpEntryType, &TmpSteamID);
+	int32 res = SteamBridgeFriends()->GetClanChatMessage(SteamIDClanChat.Value, MessageID, GChatMessageBuffer, MaxChatMessageBytes, &TmpEntryType, &TmpSteamID);
 	if (res < 0)
 	{
 		return -1;
 	}
 	SteamIDChatter = TmpSteamID.ConvertToUint64();
-	TmpMessage.SetNum(res);
-	Message = UTF8_TO_TCHAR(TmpMessage.GetData());
+	AssignUTF8(Message, TerminateChatMessage(res));
 	ChatEntryType = (ESteamChatEntryType)TmpEntryType;
 
 	return res;
@@ -95,38 +275,171 @@ int32 USteamFriends::GetClanChatMessage(FSteamID SteamIDClanChat, int32 MessageI
 
 FSteamID USteamFriends::GetFriendByIndex(int32 FriendIndex, const TArray<ESteamFriendFlags>& FriendFlags) const
 {
-	int32 flags = FriendFlags.Contains(ESteamFriendFlags::All) ? 0xFFFF : 0;
+	return GetFriendByIndex(FriendIndex, FSteamFriendFlags::FromArray(FriendFlags));
+}
+
+int32 USteamFriends::GetFriendCount(const TArray<ESteamFriendFlags>& FriendFlags) const
+{
+	return GetFriendCount(FSteamFriendFlags::FromArray(FriendFlags));
+}
 
-	if (flags == 0)
+TSharedRef<const FSteamFriendsSnapshot> USteamFriends::GetFriendsSnapshot() const
+{
+	if (!m_FriendsSnapshot.IsValid())
 	{
-		for (int32 i = 0; i < FriendFlags.Num(); i++)
+		m_FriendsSnapshot = FSteamFriendsSnapshot::Build(ESteamFriendFlags::Immediate);
+		m_PatchedFriendsSnapshot = MakeUnique<FSteamFriendsSnapshot>(*m_FriendsSnapshot);
+
+		// The snapshot is patched from these whether or not anything is bound to them
+		FSteamCallbackDispatcher::Get().Retain(OnPersonaStateChangeCallback);
+		FSteamCallbackDispatcher::Get().Retain(OnFriendRichPresenceUpdateCallback);
+	}
+
+	return m_FriendsSnapshot.ToSharedRef();
+}
+
+FString USteamFriends::GetFriendRichPresence(FSteamID SteamIDFriend, const FString& Key) const
+{
+	STEAMBRIDGE_TRACE_SCOPE(USteamFriends::GetFriendRichPresence);
+	const FString* const Value = GetFriendRichPresenceCache().Find(SteamIDFriend.Value, TCHAR_TO_UTF8(*Key));
+	return Value != nullptr ? *Value : FString();
+}
+
+FString USteamFriends::GetFriendRichPresenceByKey(FSteamID SteamIDFriend, FSteamKey Key) const
+{
+	STEAMBRIDGE_TRACE_SCOPE(USteamFriends::GetFriendRichPresenceByKey);
+	const FString* const Value = GetFriendRichPresenceCache().Find(SteamIDFriend.Value, FSteamKeys::ToUTF8(Key));
+	return Value != nullptr ? *Value : FString();
+}
+
+FSteamFriendRichPresenceCache& USteamFriends::GetFriendRichPresenceCache() const
+{
+	if (!m_bFriendRichPresenceCached)
+	{
+		// Entries are invalidated from these whether or not anything is bound to them, and removed once the user is no longer a friend
+		FSteamCallbackDispatcher::Get().Retain(OnFriendRichPresenceUpdateCallback);
+		FSteamCallbackDispatcher::Get().Retain(OnPersonaStateChangeCallback);
+		m_bFriendRichPresenceCached = true;
+
+		// Read lazily, FindFriendsWithRichPresence reads each friend once and then only the ones that change
+		ISteamBridgeFriends* const Friends = SteamBridgeFriends();
+		const int32 NumFriends = Friends->GetFriendCount(k_EFriendFlagImmediate);
+		for (int32 i = 0; i < NumFriends; i++)
 		{
-			flags |= 1 << (int32)FriendFlags[i];
+			m_FriendRichPresence.Invalidate(Friends->GetFriendByIndex(i, k_EFriendFlagImmediate).ConvertToUint64());
 		}
 	}
 
-	return SteamFriends()->GetFriendByIndex(FriendIndex, flags).ConvertToUint64();
+	return m_FriendRichPresence;
 }
 
-int32 USteamFriends::GetFriendCount(const TArray<ESteamFriendFlags>& FriendFlags) const
+bool USteamFriends::GetFriendsSnapshotEntry(int32 Index, FSteamID& SteamID, FString& PersonaName, ESteamPersonaState& PersonaState, FSteamID& GameID, int32& SteamLevel) const
 {
-	int32 flags = FriendFlags.Contains(ESteamFriendFlags::All) ? 0xFFFF : 0;
+	STEAMBRIDGE_TRACE_SCOPE(USteamFriends::GetFriendsSnapshotEntry);
+	const TSharedRef<const FSteamFriendsSnapshot> Snapshot = GetFriendsSnapshot();
+	if (!Snapshot->GetSteamIDs().IsValidIndex(Index))
+	{
+		return false;
+	}
+
+	SteamID = Snapshot->GetSteamIDs()[Index];
+	PersonaName = Snapshot->GetPersonaNames()[Index];
+	PersonaState = Snapshot->GetPersonaStates()[Index];
+	GameID = Snapshot->GetGameIDs()[Index];
+	SteamLevel = Snapshot->GetSteamLevels()[Index];
+	return true;
+}
 
-	if (flags == 0)
+int32 USteamFriends::QueryFriends(FSteamFriendFlags FriendFlags, FSteamFriendQueryFields Fields, FSteamFriendsQueryResult& Result) const
+{
+	STEAMBRIDGE_TRACE_SCOPE(USteamFriends::QueryFriends);
+	ISteamBridgeFriends* const Friends = SteamBridgeFriends();
+	const int32 Count = Friends->GetFriendCount((int32)FriendFlags.GetBits());
+
+	const bool bPersonaName = Fields.HasAny(ESteamFriendQueryFields::PersonaName);
+	const bool bPersonaState = Fields.HasAny(ESteamFriendQueryFields::PersonaState);
+	const bool bRelationship = Fields.HasAny(ESteamFriendQueryFields::Relationship);
+	const bool bGamePlayed = Fields.HasAny(ESteamFriendQueryFields::GamePlayed);
+	const bool bSteamLevel = Fields.HasAny(ESteamFriendQueryFields::SteamLevel);
+	const bool bRichPresence = Fields.HasAny(ESteamFriendQueryFields::RichPresence);
+
+	SizeQueryColumn(Result.SteamIDs, true, Count);
+	SizeQueryColumn(Result.PersonaNames, bPersonaName, Count);
+	SizeQueryColumn(Result.PersonaStates, bPersonaState, Count);
+	SizeQueryColumn(Result.Relationships, bRelationship, Count);
+	SizeQueryColumn(Result.GameIDs, bGamePlayed, Count);
+	SizeQueryColumn(Result.SteamLevels, bSteamLevel, Count);
+	SizeQueryColumn(Result.RichPresenceOffsets, bRichPresence, Count + 1);
+
+	int32 RichPresenceCount = 0;
+	for (int32 i = 0; i < Count; i++)
 	{
-		for (int32 i = 0; i < FriendFlags.Num(); i++)
+		const CSteamID SteamID = Friends->GetFriendByIndex(i, (int32)FriendFlags.GetBits());
+		Result.SteamIDs[i] = SteamID.ConvertToUint64();
+
+		if (bPersonaName)
 		{
-			flags |= 1 << (int32)FriendFlags[i];
+			AssignUTF8(Result.PersonaNames[i], Friends->GetFriendPersonaName(SteamID));
+		}
+
+		if (bPersonaState)
+		{
+			Result.PersonaStates[i] = (ESteamPersonaState)Friends->GetFriendPersonaState(SteamID);
+		}
+
+		if (bRelationship)
+		{
+			Result.Relationships[i] = (ESteamFriendRelationship)Friends->GetFriendRelationship(SteamID);
+		}
+
+		if (bGamePlayed)
+		{
+			FriendGameInfo_t GameInfo;
+			Result.GameIDs[i] = Friends->GetFriendGamePlayed(SteamID, &GameInfo) ? GameInfo.m_gameID.ToUint64() : 0;
+		}
+
+		if (bSteamLevel)
+		{
+			Result.SteamLevels[i] = Friends->GetFriendSteamLevel(SteamID);
+		}
+
+		if (bRichPresence)
+		{
+			Result.RichPresenceOffsets[i] = RichPresenceCount;
+
+			const int32 KeyCount = Friends->GetFriendRichPresenceKeyCount(SteamID);
+			for (int32 KeyIndex = 0; KeyIndex < KeyCount; KeyIndex++, RichPresenceCount++)
+			{
+				// Strings left over from the previous query are overwritten rather than freed and allocated again
+				if (RichPresenceCount == Result.RichPresenceKeys.Num())
+				{
+					Result.RichPresenceKeys.AddDefaulted();
+					Result.RichPresenceValues.AddDefaulted();
+				}
+
+				const char* const Key = Friends->GetFriendRichPresenceKeyByIndex(SteamID, KeyIndex);
+				AssignUTF8(Result.RichPresenceKeys[RichPresenceCount], Key);
+				AssignUTF8(Result.RichPresenceValues[RichPresenceCount], Friends->GetFriendRichPresence(SteamID, Key));
+			}
 		}
 	}
 
-	return SteamFriends()->GetFriendCount(flags);
+	if (bRichPresence)
+	{
+		Result.RichPresenceOffsets[Count] = RichPresenceCount;
+	}
+
+	SizeQueryColumn(Result.RichPresenceKeys, bRichPresence, RichPresenceCount);
+	SizeQueryColumn(Result.RichPresenceValues, bRichPresence, RichPresenceCount);
+
+	return Count;
 }
 
 bool USteamFriends::GetFriendGamePlayed(FSteamID SteamIDFriend, FSteamID& GameID, FString& GameIP, int32& GamePort, int32& QueryPort, FSteamID& SteamIDLobby)
 {
+	STEAMBRIDGE_TRACE_SCOPE(USteamFriends::GetFriendGamePlayed);
 	FriendGameInfo_t InGameInfoStruct;
-	bool bResult = SteamFriends()->GetFriendGamePlayed(SteamIDFriend.Value, &InGameInfoStruct);
+	bool bResult = SteamBridgeFriends()->GetFriendGamePlayed(SteamIDFriend.Value, &InGameInfoStruct);
 	GameID = InGameInfoStruct.m_gameID.ToUint64();
 	GameIP = USteamBridgeUtils::ConvertIPToString(InGameInfoStruct.m_unGameIP);
 	GamePort = InGameInfoStruct.m_usGamePort;
@@ -137,22 +450,72 @@ bool USteamFriends::GetFriendGamePlayed(FSteamID SteamIDFriend, FSteamID& GameID
 
 int32 USteamFriends::GetFriendMessage(FSteamID SteamIDFriend, int32 MessageIndex, FString& Message, ESteamChatEntryType& ChatEntryType)
 {
+	STEAMBRIDGE_TRACE_SCOPE(USteamFriends::GetFriendMessage);
 	EChatEntryType TmpEntryType;
-	TArray<char> TmpMessage;
-	TmpMessage.SetNum(MAX_int32);
-	int32 res = SteamFriends()->GetFriendMessage(SteamIDFriend.Value, MessageIndex, TmpMessage.GetData(), MAX_int32, &TmpEntryType);
+	int32 res = SteamBridgeFriends()->GetFriendMessage(SteamIDFriend.Value, MessageIndex, GChatMessageBuffer, MaxChatMessageBytes, &TmpEntryType);
 	if (res < 0)
 	{
 		return 0;
 	}
-	TmpMessage.SetNum(res);
-	Message = UTF8_TO_TCHAR(TmpMessage.GetData());
+	AssignUTF8(Message, TerminateChatMessage(res));
 	ChatEntryType = (ESteamChatEntryType)TmpEntryType;
 	return res;
 }
 
+bool USteamFriends::GetChatHistoryMessage(FSteamID SteamIDChat, int32 Index, FSteamChatMessage& Message) const
+{
+	const FSteamChatMessage* const Found = m_ChatHistory.Get(SteamIDChat.Value, Index);
+	if (Found == nullptr)
+	{
+		return false;
+	}
+
+	Message = *Found;
+	return true;
+}
+
+FSteamAPICall USteamFriends::JoinClanChatRoom(FSteamID SteamIDClan) const
+{
+	STEAMBRIDGE_TRACE_SCOPE(USteamFriends::JoinClanChatRoom);
+	if (!m_bClanChatMsgRetained && InitChatHistory())
+	{
+		// The chat history is filled from GameConnectedClanChatMsg whether or not anything is bound to it
+		FSteamCallbackDispatcher::Get().Retain(OnGameConnectedClanChatMsgCallback);
+		m_bClanChatMsgRetained = true;
+	}
+
+	return FSteamBridgeTrace::APICallIssued(SteamBridgeFriends()->JoinClanChatRoom(SteamIDClan.Value));
+}
+
+bool USteamFriends::SetListenForFriendsMessages(bool bInterceptEnabled) const
+{
+	STEAMBRIDGE_TRACE_SCOPE(USteamFriends::SetListenForFriendsMessages);
+	if (bInterceptEnabled != m_bFriendChatMsgRetained && (!bInterceptEnabled || InitChatHistory()))
+	{
+		// Same as JoinClanChatRoom, for GameConnectedFriendChatMsg
+		if (bInterceptEnabled)
+		{
+			FSteamCallbackDispatcher::Get().Retain(OnGameConnectedFriendChatMsgCallback);
+		}
+		else
+		{
+			FSteamCallbackDispatcher::Get().Release(OnGameConnectedFriendChatMsgCallback);
+		}
+		m_bFriendChatMsgRetained = bInterceptEnabled;
+	}
+
+	return SteamBridgeFriends()->SetListenForFriendsMessages(bInterceptEnabled);
+}
+
+bool USteamFriends::InitChatHistory() const
+{
+	m_ChatHistory.SetCapacity(GetDefault<USteamBridgeSettings>()->m_ChatHistoryLength);
+	return m_ChatHistory.GetCapacity() > 0;
+}
+
 void USteamFriends::GetFriendsGroupMembersList(FSteamFriendsGroupID FriendsGroupID, TArray<FSteamID>& MemberSteamIDs)
 {
+	STEAMBRIDGE_TRACE_SCOPE(USteamFriends::GetFriendsGroupMembersList);
 	int32 count = GetFriendsGroupMembersCount(FriendsGroupID);
 	if (count < 0)
 	{
@@ -160,7 +523,7 @@ void USteamFriends::GetFriendsGroupMembersList(FSteamFriendsGroupID FriendsGroup
 	}
 
 	TArray<CSteamID> TmpArray;
-	SteamFriends()->GetFriendsGroupMembersList(FriendsGroupID.Value, TmpArray.GetData(), count);
+	SteamBridgeFriends()->GetFriendsGroupMembersList(FriendsGroupID.Value, TmpArray.GetData(), count);
 	for (int32 i = 0; i < count; i++)
 	{
 		MemberSteamIDs.Add(TmpArray[i].ConvertToUint64());
@@ -169,98 +532,416 @@ void USteamFriends::GetFriendsGroupMembersList(FSteamFriendsGroupID FriendsGroup
 
 UTexture2D* USteamFriends::GetFriendAvatar(FSteamID SteamIDFriend, ESteamAvatarSize AvatarSize) const
 {
-	int32 Avatar = 0;
+	STEAMBRIDGE_TRACE_SCOPE(USteamFriends::GetFriendAvatar);
+	const int32 Avatar = GetFriendAvatarImage(SteamIDFriend, AvatarSize);
+
+	const int64 BudgetBytes = (int64)GetDefault<USteamBridgeSettings>()->m_AvatarCacheBudgetKB * 1024;
+	if (BudgetBytes <= 0)
+	{
+		return FSteamAvatarCache::CopyToTexture(Avatar);
+	}
+
+	RetainAvatarImageLoaded();
+	if (Avatar == -1)
+	{
+		m_PendingAvatars.FindOrAdd(SteamIDFriend.Value) |= 1 << (uint8)AvatarSize;
+
+		// Until Steam has it, show what the avatar was last session
+		FSteamAvatarDiskCache* const DiskCache = GetAvatarDiskCache();
+		return DiskCache != nullptr ? DiskCache->Load(SteamIDFriend.Value, AvatarSize) : nullptr;
+	}
+
+	return CacheFriendAvatar(SteamIDFriend.Value, Avatar, AvatarSize, BudgetBytes);
+}
+
+bool USteamFriends::GetFriendAvatarAtlasSlot(FSteamID SteamIDFriend, ESteamAvatarSize AvatarSize, UTexture2D*& Page, FBox2D& UV) const
+{
+	STEAMBRIDGE_TRACE_SCOPE(USteamFriends::GetFriendAvatarAtlasSlot);
+	const int32 Avatar = GetFriendAvatarImage(SteamIDFriend, AvatarSize);
+
+	RetainAvatarImageLoaded();
+	if (Avatar == -1)
+	{
+		m_PendingAtlasAvatars.FindOrAdd(SteamIDFriend.Value) |= 1 << (uint8)AvatarSize;
+		return false;
+	}
+
+	TUniquePtr<FSteamAvatarAtlas>& Atlas = m_AvatarAtlases[(uint8)AvatarSize];
+	if (!Atlas.IsValid())
+	{
+		const USteamBridgeSettings* const Settings = GetDefault<USteamBridgeSettings>();
+		Atlas = MakeUnique<FSteamAvatarAtlas>(AvatarImageSizes[(uint8)AvatarSize], Settings->m_AvatarAtlasPageSize, Settings->m_AvatarAtlasMaxPages);
+	}
+
+	return Atlas->Get(Avatar, Page, UV);
+}
+
+FSlateBrush USteamFriends::MakeFriendAvatarBrush(FSteamID SteamIDFriend, ESteamAvatarSize AvatarSize) const
+{
+	FSlateBrush Brush;
+	UTexture2D* Page = nullptr;
+	FBox2D UV(ForceInit);
+	if (GetFriendAvatarAtlasSlot(SteamIDFriend, AvatarSize, Page, UV))
+	{
+		Brush.SetResourceObject(Page);
+		Brush.ImageSize = FVector2D(AvatarImageSizes[(uint8)AvatarSize], AvatarImageSizes[(uint8)AvatarSize]);
+		Brush.SetUVRegion(UV);
+	}
+	return Brush;
+}
+
+int32 USteamFriends::GetFriendAvatarImage(FSteamID SteamIDFriend, ESteamAvatarSize AvatarSize) const
+{
 	switch (AvatarSize)
 	{
 	case ESteamAvatarSize::Small:
-		Avatar = SteamFriends()->GetSmallFriendAvatar(SteamIDFriend.Value);
-		break;
+		return SteamBridgeFriends()->GetSmallFriendAvatar(SteamIDFriend.Value);
 	case ESteamAvatarSize::Medium:
-		Avatar = SteamFriends()->GetMediumFriendAvatar(SteamIDFriend.Value);
-		break;
+		return SteamBridgeFriends()->GetMediumFriendAvatar(SteamIDFriend.Value);
 	case ESteamAvatarSize::Large:
-		Avatar = SteamFriends()->GetLargeFriendAvatar(SteamIDFriend.Value);
-		break;
+		return SteamBridgeFriends()->GetLargeFriendAvatar(SteamIDFriend.Value);
+	}
+	return 0;
+}
+
+FSteamAvatarDiskCache* USteamFriends::GetAvatarDiskCache() const
+{
+	if (!m_AvatarDiskCache.IsValid() && GetDefault<USteamBridgeSettings>()->m_bUseAvatarDiskCache)
+	{
+		m_AvatarDiskCache = MakeUnique<FSteamAvatarDiskCache>(FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("SteamBridge"), TEXT("Avatars")),
+			(int64)GetDefault<USteamBridgeSettings>()->m_AvatarDiskCacheBudgetKB * 1024);
+	}
+
+	return m_AvatarDiskCache.Get();
+}
+
+UTexture2D* USteamFriends::CacheFriendAvatar(uint64 SteamID, int32 Avatar, ESteamAvatarSize AvatarSize, int64 BudgetBytes) const
+{
+	bool bCreated = false;
+	UTexture2D* const Texture = m_AvatarCache.Get(Avatar, AvatarSize, BudgetBytes, &bCreated);
+	FSteamAvatarDiskCache* const DiskCache = bCreated ? GetAvatarDiskCache() : nullptr;
+	if (DiskCache != nullptr)
+	{
+		DiskCache->Store(SteamID, AvatarSize, Texture);
+	}
+
+	return Texture;
+}
+
+void USteamFriends::RetainAvatarImageLoaded() const
+{
+	if (!m_bAvatarImageLoadedRetained)
+	{
+		// Cached avatars are refreshed from AvatarImageLoaded whether or not anything is bound to it
+		FSteamCallbackDispatcher::Get().Retain(OnAvatarImageLoadedCallback);
+		m_bAvatarImageLoadedRetained = true;
+	}
+}
+
+TArray<ESteamUserRestrictions> USteamFriends::GetUserRestrictions() const
+{
+	return GetUserRestrictionFlags().ToArray();
+}
+
+bool USteamFriends::HasFriend(FSteamID SteamIDFriend, const TArray<ESteamFriendFlags>& FriendFlags)
+{
+	return HasFriend(SteamIDFriend, FSteamFriendFlags::FromArray(FriendFlags));
+}
+
+void USteamFriends::BroadcastPersonaStateChange(uint64 SteamID, uint32 SteamChangeFlags)
+{
+	// Patched first so handlers see the change in the snapshot
+	PatchFriendsSnapshot(SteamID, SteamChangeFlags);
+
+	if (m_bFriendRichPresenceCached && (SteamChangeFlags & k_EPersonaChangeRelationshipChanged) != 0 &&
+		SteamBridgeFriends()->GetFriendRelationship(SteamID) != k_EFriendRelationshipFriend)
+	{
+		m_FriendRichPresence.Remove(SteamID);
+	}
+
+	// EPersonaChange bit N maps to ESteamPersonaChange value N + 1, the single value delegate gets the lowest change
+	const ESteamPersonaChange FirstChange = SteamChangeFlags == 0 ? ESteamPersonaChange::None : (ESteamPersonaChange)FMath::Min<uint32>(FMath::CountTrailingZeros(SteamChangeFlags) + 1, (uint32)ESteamPersonaChange::ChangeErr);
+	m_OnPersonaStateChange.Broadcast(SteamID, FirstChange);
+	m_OnPersonaStateChangeFlags.Broadcast(SteamID, (int32)(SteamChangeFlags << 1));
+}
+
+void USteamFriends::PublishRichPresence()
+{
+	m_RichPresence.Flush(GetDefault<USteamBridgeSettings>()->m_RichPresenceIntervalMs / 1000.0);
+}
+
+void USteamFriends::FlushPersonaStateChanges()
+{
+	if (m_PendingPersonaChanges.Num() == 0)
+	{
+		return;
+	}
+
+	const double CoalesceWindowSeconds = GetDefault<USteamBridgeSettings>()->m_PersonaCoalesceWindowMs / 1000.0;
+	if (FPlatformTime::Seconds() - m_PersonaCoalesceWindowStart < CoalesceWindowSeconds)
+	{
+		return;
+	}
+
+	for (const auto& Change : m_PendingPersonaChanges)
+	{
+		BroadcastPersonaStateChange(Change.Key, Change.Value);
+	}
+
+	m_PendingPersonaChanges.Reset();
+}
+
+void USteamFriends::PatchFriendsSnapshot(uint64 SteamID, uint32 SteamChangeFlags)
+{
+	if (!m_PatchedFriendsSnapshot.IsValid() || !m_PatchedFriendsSnapshot->IsAffectedBy(SteamID, SteamChangeFlags))
+	{
+		return;
+	}
+
+	if (m_PatchedFriendsSnapshot->Patch(SteamID, SteamChangeFlags))
+	{
+		m_bFriendsSnapshotPatched = true;
+	}
+}
+
+void USteamFriends::PublishFriendsSnapshot()
+{
+	if (!m_bFriendsSnapshotPatched)
+	{
+		return;
+	}
+	m_bFriendsSnapshotPatched = false;
+
+	// Someone is still holding the snapshot they were given, which must not change under them
+	if (m_FriendsSnapshot.IsUnique())
+	{
+		*m_FriendsSnapshot = *m_PatchedFriendsSnapshot;
+	}
+	else
+	{
+		m_FriendsSnapshot = MakeShared<FSteamFriendsSnapshot>(*m_PatchedFriendsSnapshot);
+	}
+}
+
+FSteamAPICall USteamFriends::RequestClanOfficerList(FSteamID SteamIDClan) const
+{
+	STEAMBRIDGE_TRACE_SCOPE(USteamFriends::RequestClanOfficerList);
+	return m_ClanOfficerListRequests.Issue(SteamIDClan.Value, [SteamIDClan]() { return FSteamBridgeTrace::APICallIssued(SteamBridgeFriends()->RequestClanOfficerList(SteamIDClan.Value)); },
+		GetDefault<USteamBridgeSettings>()->m_RequestMemoSeconds);
+}
+
+TFuture<TSteamCallResult<ClanOfficerListResponse_t>> USteamFriends::RequestClanOfficerListAsync(FSteamID SteamIDClan) const
+{
+	STEAMBRIDGE_TRACE_SCOPE(USteamFriends::RequestClanOfficerListAsync);
+	return m_ClanOfficerListRequests.Request(SteamIDClan.Value, [SteamIDClan]() { return FSteamBridgeTrace::APICallIssued(SteamBridgeFriends()->RequestClanOfficerList(SteamIDClan.Value)); },
+		GetDefault<USteamBridgeSettings>()->m_RequestMemoSeconds);
+}
+
+bool USteamFriends::RequestUserInformation(FSteamID SteamIDUser, bool bRequireNameOnly) const
+{
+	STEAMBRIDGE_TRACE_SCOPE(USteamFriends::RequestUserInformation);
+	const double Now = FPlatformTime::Seconds();
+	const double MemoSeconds = GetDefault<USteamBridgeSettings>()->m_RequestMemoSeconds;
+
+	// A request for the full information also covers a name only one, but not the other way around
+	const FUserInformationRequest* const Previous = m_UserInformationRequests.Find(SteamIDUser.Value);
+	if (Previous != nullptr && (bRequireNameOnly || !Previous->bRequireNameOnly))
+	{
+		if (Previous->bPending && Now - Previous->RequestTime < UserInformationTimeoutSeconds)
+		{
+			return true;
+		}
+
+		if (!Previous->bPending && Now - Previous->CompletedTime < MemoSeconds)
+		{
+			return false;
+		}
 	}
 
-	uint32 Width = 0, Height = 0;
-	SteamUtils()->GetImageSize(Avatar, &Width, &Height);
-	if (Width > 0 && Height > 0)
+	const bool bRequested = SteamBridgeFriends()->RequestUserInformation(SteamIDUser.Value, bRequireNameOnly);
+	if (bRequested)
 	{
-		UTexture2D* AvatarTexture = UTexture2D::CreateTransient(Width, Height, PF_B8G8R8A8);
-		uint8* AvatarRGBA = new uint8[Width * Height * 4];
-		SteamUtils()->GetImageRGBA(Avatar, (uint8*)AvatarRGBA, 4 * Height * Width);
-		for (uint32 i = 0; i < (Width * Height * 4); i += 4)
+		FUserInformationRequest& Request = m_UserInformationRequests.FindOrAdd(SteamIDUser.Value);
+		if (!Request.bPending && m_PendingUserInformationRequests++ == 0)
 		{
-			uint8 Temp = AvatarRGBA[i + 0];
-			AvatarRGBA[i + 0] = AvatarRGBA[i + 2];
-			AvatarRGBA[i + 2] = Temp;
+			// Completion is detected through PersonaStateChange, whether or not anything is bound to it
+			FSteamCallbackDispatcher::Get().Retain(OnPersonaStateChangeCallback);
 		}
-		uint8* MipData = (uint8*)AvatarTexture->PlatformData->Mips[0].BulkData.Lock(LOCK_READ_WRITE);
-		FMemory::Memcpy(MipData, (void*)AvatarRGBA, Height * Width * 4);
-		AvatarTexture->PlatformData->Mips[0].BulkData.Unlock();
-		AvatarTexture->PlatformData->SetNumSlices(1);
-		AvatarTexture->NeverStream = true;
-		AvatarTexture->UpdateResource();
-		delete[] AvatarRGBA;
 
-		return AvatarTexture;
+		Request.RequestTime = Now;
+		Request.bRequireNameOnly = bRequireNameOnly;
+		Request.bPending = true;
+	}
+	else
+	{
+		// Steam already has it cached
+		CompleteUserInformationRequest(SteamIDUser.Value);
+		if (MemoSeconds > 0.0)
+		{
+			FUserInformationRequest& Request = m_UserInformationRequests.FindOrAdd(SteamIDUser.Value);
+			Request.CompletedTime = Now;
+			Request.bRequireNameOnly = bRequireNameOnly;
+		}
 	}
 
-	return nullptr;
+	return bRequested;
 }
 
-TArray<ESteamUserRestrictions> USteamFriends::GetUserRestrictions() const
+void USteamFriends::PrefetchUserInformation(TArrayView<const FSteamID> SteamIDs, int32 Priority, bool bRequireNameOnly, TArray<TFuture<bool>>* Futures) const
 {
-	TArray<ESteamUserRestrictions> TmpArray;
-	uint32 flags = SteamFriends()->GetUserRestrictions();
-	for (int i = 0; i < 32; i++)
+	STEAMBRIDGE_TRACE_SCOPE(USteamFriends::PrefetchUserInformation);
+	if (Futures != nullptr)
+	{
+		Futures->Reset(SteamIDs.Num());
+	}
+
+	for (const FSteamID& SteamID : SteamIDs)
 	{
-		if (flags & 1 << i)
+		TFuture<bool> Future = m_UserInformationPrefetch.Request(SteamID.Value, Priority, bRequireNameOnly);
+		if (Futures != nullptr)
 		{
-			TmpArray.Add((ESteamUserRestrictions)i);
+			Futures->Add(MoveTemp(Future));
 		}
 	}
-	return TmpArray;
+
+	// The first requests go out now rather than after this frame's callbacks
+	PumpUserInformationPrefetch();
 }
 
-bool USteamFriends::HasFriend(FSteamID SteamIDFriend, const TArray<ESteamFriendFlags>& FriendFlags)
+void USteamFriends::CancelUserInformationPrefetch(const TArray<FSteamID>& SteamIDs) const
 {
-	int32 flags = FriendFlags.Contains(ESteamFriendFlags::All) ? 0xFFFF : 0;
+	STEAMBRIDGE_TRACE_SCOPE(USteamFriends::CancelUserInformationPrefetch);
+	for (const FSteamID& SteamID : SteamIDs)
+	{
+		m_UserInformationPrefetch.Cancel(SteamID.Value);
+	}
+}
+
+void USteamFriends::PumpUserInformationPrefetch() const
+{
+	m_UserInformationPrefetch.Pump(GetDefault<USteamBridgeSettings>()->m_MaxUserInformationRequestsInFlight, UserInformationTimeoutSeconds,
+		[this](uint64 SteamID, bool bRequireNameOnly) { return RequestUserInformation(SteamID, bRequireNameOnly); });
+}
+
+void USteamFriends::CompleteUserInformationRequest(uint64 SteamID) const
+{
+	FUserInformationRequest* const Request = m_UserInformationRequests.Find(SteamID);
+	if (Request == nullptr || !Request->bPending)
+	{
+		return;
+	}
+
+	if (--m_PendingUserInformationRequests == 0)
+	{
+		FSteamCallbackDispatcher::Get().Release(OnPersonaStateChangeCallback);
+	}
+
+	if (GetDefault<USteamBridgeSettings>()->m_RequestMemoSeconds > 0.0f)
+	{
+		Request->bPending = false;
+		Request->CompletedTime = FPlatformTime::Seconds();
+	}
+	else
+	{
+		m_UserInformationRequests.Remove(SteamID);
+	}
+}
+
+void USteamFriends::ExpireRequests()
+{
+	const double Now = FPlatformTime::Seconds();
+	if (Now < m_NextRequestExpiryTime)
+	{
+		return;
+	}
+	m_NextRequestExpiryTime = Now + RequestExpiryIntervalSeconds;
 
-	if (flags == 0)
+	const double MemoSeconds = GetDefault<USteamBridgeSettings>()->m_RequestMemoSeconds;
+	for (auto It = m_UserInformationRequests.CreateIterator(); It; ++It)
 	{
-		for (int32 i = 0; i < FriendFlags.Num(); i++)
+		const FUserInformationRequest& Request = It.Value();
+		if (Request.bPending ? Now - Request.RequestTime < UserInformationTimeoutSeconds : Now - Request.CompletedTime < MemoSeconds)
 		{
-			flags |= 1 << (int32)FriendFlags[i];
+			continue;
 		}
+
+		// Steam never answered, so nothing is waiting on PersonaStateChange for this user anymore
+		if (Request.bPending && --m_PendingUserInformationRequests == 0)
+		{
+			FSteamCallbackDispatcher::Get().Release(OnPersonaStateChangeCallback);
+		}
+		It.RemoveCurrent();
 	}
 
-	return SteamFriends()->HasFriend(SteamIDFriend.Value, flags);
+	m_ClanOfficerListRequests.PruneMemos(MemoSeconds);
+	m_FollowerCountRequests.PruneMemos(MemoSeconds);
 }
 
 void USteamFriends::OnAvatarImageLoaded(AvatarImageLoaded_t* pParam)
 {
+	STEAMBRIDGE_CALLBACK_SCOPE(OnAvatarImageLoaded, pParam);
+	const uint64 SteamID = pParam->m_steamID.ConvertToUint64();
+	const ESteamAvatarSize AvatarSize = FSteamAvatarCache::GetSizeForWidth(pParam->m_iWide);
+	const int64 BudgetBytes = (int64)GetDefault<USteamBridgeSettings>()->m_AvatarCacheBudgetKB * 1024;
+	if (m_AvatarCache.Refresh(pParam->m_iImage, AvatarSize))
+	{
+		// The image changed under the same handle, what's on disk is revalidated against it
+		if (FSteamAvatarDiskCache* const DiskCache = GetAvatarDiskCache())
+		{
+			DiskCache->Store(SteamID, AvatarSize, m_AvatarCache.Get(pParam->m_iImage, AvatarSize, BudgetBytes));
+		}
+	}
+	else if (TakePendingAvatar(m_PendingAvatars, SteamID, AvatarSize))
+	{
+		CacheFriendAvatar(SteamID, pParam->m_iImage, AvatarSize, BudgetBytes);
+	}
+
+	if (TakePendingAvatar(m_PendingAtlasAvatars, SteamID, AvatarSize))
+	{
+		UTexture2D* Page = nullptr;
+		FBox2D UV(ForceInit);
+		GetFriendAvatarAtlasSlot(SteamID, AvatarSize, Page, UV);
+	}
+	else if (m_AvatarAtlases[(uint8)AvatarSize].IsValid())
+	{
+		m_AvatarAtlases[(uint8)AvatarSize]->Refresh(pParam->m_iImage);
+	}
+
 	m_OnAvatarImageLoaded.Broadcast(pParam->m_steamID.ConvertToUint64(), pParam->m_iImage, pParam->m_iWide, pParam->m_iTall);
 }
 
 void USteamFriends::OnClanOfficerListResponse(ClanOfficerListResponse_t* pParam)
 {
+	STEAMBRIDGE_CALLBACK_SCOPE(OnClanOfficerListResponse, pParam);
+	if (m_ClanCache.IsValid() && pParam->m_bSuccess)
+	{
+		m_ClanCache->ReadOfficers(pParam->m_steamIDClan.ConvertToUint64());
+	}
+
 	m_OnClanOfficerListResponse.Broadcast(pParam->m_steamIDClan.ConvertToUint64(), pParam->m_cOfficers, pParam->m_bSuccess == 1);
 }
 
 void USteamFriends::OnDownloadClanActivityCountsResult(DownloadClanActivityCountsResult_t* pParam)
 {
+	STEAMBRIDGE_CALLBACK_SCOPE(OnDownloadClanActivityCountsResult, pParam);
 	m_OnDownloadClanActivityCountsResult.Broadcast(pParam->m_bSuccess);
 }
 
 void USteamFriends::OnFriendRichPresenceUpdate(FriendRichPresenceUpdate_t* pParam)
 {
+	STEAMBRIDGE_CALLBACK_SCOPE(OnFriendRichPresenceUpdate, pParam);
+	// Rich presence is set by the game the friend is playing, so it's the cue to re-read that
+	PatchFriendsSnapshot(pParam->m_steamIDFriend.ConvertToUint64(), k_EPersonaChangeGamePlayed);
+	if (m_bFriendRichPresenceCached)
+	{
+		m_FriendRichPresence.Invalidate(pParam->m_steamIDFriend.ConvertToUint64());
+	}
 	m_OnFriendRichPresenceUpdate.Broadcast(pParam->m_steamIDFriend.ConvertToUint64(), pParam->m_nAppID);
 }
 
 void USteamFriends::OnFriendsEnumerateFollowingList(FriendsEnumerateFollowingList_t* pParam)
 {
+	STEAMBRIDGE_CALLBACK_SCOPE(OnFriendsEnumerateFollowingList, pParam);
 #if 0
 	TArray<FSteamID> TmpArray;
 
@@ -275,65 +956,120 @@ void USteamFriends::OnFriendsEnumerateFollowingList(FriendsEnumerateFollowingLis
 
 void USteamFriends::OnFriendsGetFollowerCount(FriendsGetFollowerCount_t* pParam)
 {
+	STEAMBRIDGE_CALLBACK_SCOPE(OnFriendsGetFollowerCount, pParam);
 	m_OnFriendsGetFollowerCount.Broadcast((ESteamResult)pParam->m_eResult, pParam->m_steamID.ConvertToUint64(), pParam->m_nCount);
 }
 
 void USteamFriends::OnFriendsIsFollowing(FriendsIsFollowing_t* pParam)
 {
+	STEAMBRIDGE_CALLBACK_SCOPE(OnFriendsIsFollowing, pParam);
 	m_OnFriendsIsFollowing.Broadcast((ESteamResult)pParam->m_eResult, pParam->m_steamID.ConvertToUint64(), pParam->m_bIsFollowing);
 }
 
 void USteamFriends::OnGameConnectedChatJoin(GameConnectedChatJoin_t* pParam)
 {
+	STEAMBRIDGE_CALLBACK_SCOPE(OnGameConnectedChatJoin, pParam);
 	m_OnGameConnectedChatJoin.Broadcast(pParam->m_steamIDClanChat.ConvertToUint64(), pParam->m_steamIDUser.ConvertToUint64());
 }
 
 void USteamFriends::OnGameConnectedChatLeave(GameConnectedChatLeave_t* pParam)
 {
+	STEAMBRIDGE_CALLBACK_SCOPE(OnGameConnectedChatLeave, pParam);
 	m_OnGameConnectedChatLeave.Broadcast(pParam->m_steamIDClanChat.ConvertToUint64(), pParam->m_steamIDUser.ConvertToUint64(), pParam->m_bKicked, pParam->m_bDropped);
 }
 
 void USteamFriends::OnGameConnectedClanChatMsg(GameConnectedClanChatMsg_t* pParam)
 {
+	STEAMBRIDGE_CALLBACK_SCOPE(OnGameConnectedClanChatMsg, pParam);
+	if (m_bClanChatMsgRetained)
+	{
+		EChatEntryType ChatEntryType;
+		CSteamID SteamIDChatter;
+		const int32 Length = SteamBridgeFriends()->GetClanChatMessage(pParam->m_steamIDClanChat, pParam->m_iMessageID, GChatMessageBuffer, MaxChatMessageBytes, &ChatEntryType, &SteamIDChatter);
+		if (Length >= 0)
+		{
+			m_ChatHistory.Add(pParam->m_steamIDClanChat.ConvertToUint64(), pParam->m_iMessageID, SteamIDChatter.ConvertToUint64(), (ESteamChatEntryType)ChatEntryType, TerminateChatMessage(Length));
+		}
+	}
+
 	m_OnGameConnectedClanChatMsg.Broadcast(pParam->m_steamIDClanChat.ConvertToUint64(), pParam->m_steamIDUser.ConvertToUint64(), pParam->m_iMessageID);
 }
 
 void USteamFriends::OnGameConnectedFriendChatMsg(GameConnectedFriendChatMsg_t* pParam)
 {
+	STEAMBRIDGE_CALLBACK_SCOPE(OnGameConnectedFriendChatMsg, pParam);
+	if (m_bFriendChatMsgRetained)
+	{
+		EChatEntryType ChatEntryType;
+		const int32 Length = SteamBridgeFriends()->GetFriendMessage(pParam->m_steamIDUser, pParam->m_iMessageID, GChatMessageBuffer, MaxChatMessageBytes, &ChatEntryType);
+		if (Length >= 0)
+		{
+			m_ChatHistory.Add(pParam->m_steamIDUser.ConvertToUint64(), pParam->m_iMessageID, pParam->m_steamIDUser.ConvertToUint64(), (ESteamChatEntryType)ChatEntryType, TerminateChatMessage(Length));
+		}
+	}
+
 	m_OnGameConnectedFriendChatMsg.Broadcast(pParam->m_steamIDUser.ConvertToUint64(), pParam->m_iMessageID);
 }
 
 void USteamFriends::OnGameLobbyJoinRequested(GameLobbyJoinRequested_t* pParam)
 {
+	STEAMBRIDGE_CALLBACK_SCOPE(OnGameLobbyJoinRequested, pParam);
 	m_OnGameLobbyJoinRequested.Broadcast(pParam->m_steamIDLobby.ConvertToUint64(), pParam->m_steamIDFriend.ConvertToUint64());
 }
 
 void USteamFriends::OnGameOverlayActivated(GameOverlayActivated_t* pParam)
 {
+	STEAMBRIDGE_CALLBACK_SCOPE(OnGameOverlayActivated, pParam);
 	m_OnGameOverlayActivated.Broadcast(pParam->m_bActive == 1);
 }
 
 void USteamFriends::OnGameRichPresenceJoinRequested(GameRichPresenceJoinRequested_t* pParam)
 {
+	STEAMBRIDGE_CALLBACK_SCOPE(OnGameRichPresenceJoinRequested, pParam);
 	m_OnGameRichPresenceJoinRequested.Broadcast(pParam->m_steamIDFriend.ConvertToUint64(), UTF8_TO_TCHAR(pParam->m_rgchConnect));
 }
 
 void USteamFriends::OnGameServerChangeRequested(GameServerChangeRequested_t* pParam)
 {
+	STEAMBRIDGE_CALLBACK_SCOPE(OnGameServerChangeRequested, pParam);
 	m_OnGameServerChangeRequested.Broadcast(UTF8_TO_TCHAR(pParam->m_rgchServer), UTF8_TO_TCHAR(pParam->m_rgchPassword));
 }
 
 void USteamFriends::OnJoinClanChatRoomCompletionResult(JoinClanChatRoomCompletionResult_t* pParam)
 {
+	STEAMBRIDGE_CALLBACK_SCOPE(OnJoinClanChatRoomCompletionResult, pParam);
 	m_OnJoinClanChatRoomCompletionResult.Broadcast(pParam->m_steamIDClanChat.ConvertToUint64(), (ESteamChatRoomEnterResponse)pParam->m_eChatRoomEnterResponse);
 }
 
 void USteamFriends::OnPersonaStateChange(PersonaStateChange_t* pParam)
 {
-	m_OnPersonaStateChange.Broadcast(pParam->m_ulSteamID, static_cast<ESteamPersonaChange>((uint8)pParam->m_nChangeFlags));
+	STEAMBRIDGE_CALLBACK_SCOPE(OnPersonaStateChange, pParam);
+	if (m_PendingUserInformationRequests > 0)
+	{
+		CompleteUserInformationRequest(pParam->m_ulSteamID);
+	}
+
+	if (!m_UserInformationPrefetch.IsEmpty())
+	{
+		m_UserInformationPrefetch.Complete(pParam->m_ulSteamID);
+	}
+
+	if (GetDefault<USteamBridgeSettings>()->m_PersonaCoalesceWindowMs <= 0)
+	{
+		BroadcastPersonaStateChange(pParam->m_ulSteamID, pParam->m_nChangeFlags);
+		return;
+	}
+
+	if (m_PendingPersonaChanges.Num() == 0)
+	{
+		m_PersonaCoalesceWindowStart = FPlatformTime::Seconds();
+	}
+
+	m_PendingPersonaChanges.FindOrAdd(pParam->m_ulSteamID) |= pParam->m_nChangeFlags;
 }
 
 void USteamFriends::OnSetPersonaNameResponse(SetPersonaNameResponse_t* pParam)
 {
+	STEAMBRIDGE_CALLBACK_SCOPE(OnSetPersonaNameResponse, pParam);
 	m_OnSetPersonaNameResponse.Broadcast(pParam->m_bSuccess, pParam->m_bLocalSuccess, (ESteamResult)pParam->m_result);
 }
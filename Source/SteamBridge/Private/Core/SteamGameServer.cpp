@@ -4,77 +4,89 @@
 
 #include "Core/SteamGameServer.h"
 
+#include "SteamBridgeStats.h"
+#include "SteamBridgeTrace.h"
 #include "SteamBridgeUtils.h"
+#include "SteamCallbackDispatcher.h"
 
 USteamGameServer::USteamGameServer()
 {
-	OnAssociateWithClanResultCallback.Register(this, &USteamGameServer::OnAssociateWithClanResult);
-	OnComputeNewPlayerCompatibilityResultCallback.Register(this, &USteamGameServer::OnComputeNewPlayerCompatibilityResult);
-	OnGSClientApproveCallback.Register(this, &USteamGameServer::OnGSClientApprove);
-	OnGSClientDenyCallback.Register(this, &USteamGameServer::OnGSClientDeny);
-	OnGSClientGroupStatusCallback.Register(this, &USteamGameServer::OnGSClientGroupStatus);
-	OnGSClientKickCallback.Register(this, &USteamGameServer::OnGSClientKick);
-	OnGSPolicyResponseCallback.Register(this, &USteamGameServer::OnGSPolicyResponse);
+	FSteamCallbackDispatcher::RegisterLazy(OnAssociateWithClanResultCallback, this, &USteamGameServer::OnAssociateWithClanResult, m_OnAssociateWithClanResult);
+	FSteamCallbackDispatcher::RegisterLazy(OnComputeNewPlayerCompatibilityResultCallback, this, &USteamGameServer::OnComputeNewPlayerCompatibilityResult, m_OnComputeNewPlayerCompatibilityResult);
+	FSteamCallbackDispatcher::RegisterLazy(OnGSClientApproveCallback, this, &USteamGameServer::OnGSClientApprove, m_OnGSClientApprove);
+	FSteamCallbackDispatcher::RegisterLazy(OnGSClientDenyCallback, this, &USteamGameServer::OnGSClientDeny, m_OnGSClientDeny);
+	FSteamCallbackDispatcher::RegisterLazy(OnGSClientGroupStatusCallback, this, &USteamGameServer::OnGSClientGroupStatus, m_OnGSClientGroupStatus);
+	FSteamCallbackDispatcher::RegisterLazy(OnGSClientKickCallback, this, &USteamGameServer::OnGSClientKick, m_OnGSClientKick);
+	FSteamCallbackDispatcher::RegisterLazy(OnGSPolicyResponseCallback, this, &USteamGameServer::OnGSPolicyResponse, m_OnGSPolicyResponse);
 }
 
 USteamGameServer::~USteamGameServer()
 {
-	OnAssociateWithClanResultCallback.Unregister();
-	OnComputeNewPlayerCompatibilityResultCallback.Unregister();
-	OnGSClientApproveCallback.Unregister();
-	OnGSClientDenyCallback.Unregister();
-	OnGSClientGroupStatusCallback.Unregister();
-	OnGSClientKickCallback.Unregister();
-	OnGSPolicyResponseCallback.Unregister();
+	FSteamCallbackDispatcher::Unregister(OnAssociateWithClanResultCallback);
+	FSteamCallbackDispatcher::Unregister(OnComputeNewPlayerCompatibilityResultCallback);
+	FSteamCallbackDispatcher::Unregister(OnGSClientApproveCallback);
+	FSteamCallbackDispatcher::Unregister(OnGSClientDenyCallback);
+	FSteamCallbackDispatcher::Unregister(OnGSClientGroupStatusCallback);
+	FSteamCallbackDispatcher::Unregister(OnGSClientKickCallback);
+	FSteamCallbackDispatcher::Unregister(OnGSPolicyResponseCallback);
 }
 
 ESteamBeginAuthSessionResult USteamGameServer::BeginAuthSession(TArray<uint8> AuthTicket, FSteamID SteamID)
 {
+	STEAMBRIDGE_TRACE_SCOPE(USteamGameServer::BeginAuthSession);
 	AuthTicket.SetNum(8192);
-	return (ESteamBeginAuthSessionResult)SteamGameServer()->BeginAuthSession(AuthTicket.GetData(), 8192, SteamID.Value);
+	return (ESteamBeginAuthSessionResult)SteamBridgeGameServer()->BeginAuthSession(AuthTicket.GetData(), 8192, SteamID.Value);
 }
 
 FHAuthTicket USteamGameServer::GetAuthSessionTicket(TArray<uint8> &AuthTicket)
 {
+	STEAMBRIDGE_TRACE_SCOPE(USteamGameServer::GetAuthSessionTicket);
 	uint32 length = 0;
 	AuthTicket.SetNum(8192);
-	FHAuthTicket result = (FHAuthTicket)SteamGameServer()->GetAuthSessionTicket(AuthTicket.GetData(), 8192, &length);
+	FHAuthTicket result = (FHAuthTicket)SteamBridgeGameServer()->GetAuthSessionTicket(AuthTicket.GetData(), 8192, &length);
 	AuthTicket.SetNum(length);
 	return result;
 }
 
 void USteamGameServer::OnAssociateWithClanResult(AssociateWithClanResult_t *pParam)
 {
+	STEAMBRIDGE_CALLBACK_SCOPE(OnAssociateWithClanResult, pParam);
 	m_OnAssociateWithClanResult.Broadcast((ESteamResult)pParam->m_eResult);
 }
 
 void USteamGameServer::OnComputeNewPlayerCompatibilityResult(ComputeNewPlayerCompatibilityResult_t *pParam)
 {
+	STEAMBRIDGE_CALLBACK_SCOPE(OnComputeNewPlayerCompatibilityResult, pParam);
 	m_OnComputeNewPlayerCompatibilityResult.Broadcast((ESteamResult)pParam->m_eResult, pParam->m_cPlayersThatDontLikeCandidate, pParam->m_cPlayersThatCandidateDoesntLike,
 		pParam->m_cClanPlayersThatDontLikeCandidate, pParam->m_SteamIDCandidate.ConvertToUint64());
 }
 
 void USteamGameServer::OnGSClientApprove(GSClientApprove_t *pParam)
 {
+	STEAMBRIDGE_CALLBACK_SCOPE(OnGSClientApprove, pParam);
 	m_OnGSClientApprove.Broadcast(pParam->m_SteamID.ConvertToUint64(), pParam->m_OwnerSteamID.ConvertToUint64());
 }
 
 void USteamGameServer::OnGSClientDeny(GSClientDeny_t *pParam)
 {
+	STEAMBRIDGE_CALLBACK_SCOPE(OnGSClientDeny, pParam);
 	m_OnGSClientDeny.Broadcast(pParam->m_SteamID.ConvertToUint64(), (ESteamDenyReason)pParam->m_eDenyReason, UTF8_TO_TCHAR(pParam->m_rgchOptionalText));
 }
 
 void USteamGameServer::OnGSClientGroupStatus(GSClientGroupStatus_t *pParam)
 {
+	STEAMBRIDGE_CALLBACK_SCOPE(OnGSClientGroupStatus, pParam);
 	m_OnGSClientGroupStatus.Broadcast(pParam->m_SteamIDUser.ConvertToUint64(), pParam->m_SteamIDGroup.ConvertToUint64(), pParam->m_bMember, pParam->m_bOfficer);
 }
 
 void USteamGameServer::OnGSClientKick(GSClientKick_t *pParam)
 {
+	STEAMBRIDGE_CALLBACK_SCOPE(OnGSClientKick, pParam);
 	m_OnGSClientKick.Broadcast(pParam->m_SteamID.ConvertToUint64(), (ESteamDenyReason)pParam->m_eDenyReason);
 }
 
 void USteamGameServer::OnGSPolicyResponse(GSPolicyResponse_t *pParam)
 {
+	STEAMBRIDGE_CALLBACK_SCOPE(OnGSPolicyResponse, pParam);
 	m_OnGSPolicyResponse.Broadcast(pParam->m_bSecure == 1);
 }
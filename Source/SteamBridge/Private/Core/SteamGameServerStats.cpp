@@ -4,38 +4,45 @@
 
 #include "Core/SteamGameServerStats.h"
 
+#include "SteamBridgeStats.h"
+#include "SteamBridgeTrace.h"
 #include "SteamBridgeUtils.h"
+#include "SteamCallbackDispatcher.h"
 
 USteamGameServerStats::USteamGameServerStats()
 {
-	OnGSStatsReceivedCallback.Register(this, &USteamGameServerStats::OnGSStatsReceived);
-	OnGSStatsStoredCallback.Register(this, &USteamGameServerStats::OnGSStatsStored);
-	OnGSStatsUnloadedCallback.Register(this, &USteamGameServerStats::OnGSStatsUnloaded);
+	FSteamCallbackDispatcher::RegisterLazy(OnGSStatsReceivedCallback, this, &USteamGameServerStats::OnGSStatsReceived, m_OnGSStatsReceived);
+	FSteamCallbackDispatcher::RegisterLazy(OnGSStatsStoredCallback, this, &USteamGameServerStats::OnGSStatsStored, m_OnGSStatsStored);
+	FSteamCallbackDispatcher::RegisterLazy(OnGSStatsUnloadedCallback, this, &USteamGameServerStats::OnGSStatsUnloaded, m_OnGSStatsUnloaded);
 }
 
 USteamGameServerStats::~USteamGameServerStats()
 {
-	OnGSStatsReceivedCallback.Unregister();
-	OnGSStatsStoredCallback.Unregister();
-	OnGSStatsUnloadedCallback.Unregister();
+	FSteamCallbackDispatcher::Unregister(OnGSStatsReceivedCallback);
+	FSteamCallbackDispatcher::Unregister(OnGSStatsStoredCallback);
+	FSteamCallbackDispatcher::Unregister(OnGSStatsUnloadedCallback);
 }
 
 bool USteamGameServerStats::UpdateUserAvgRateStat(FSteamID SteamIDUser, const FString& Name, float CountThisSession, float SessionLength) const
 {
+	STEAMBRIDGE_TRACE_SCOPE(USteamGameServerStats::UpdateUserAvgRateStat);
 	return SteamGameServerStats()->UpdateUserAvgRateStat(SteamIDUser.Value, TCHAR_TO_UTF8(*Name), CountThisSession, SessionLength);
 }
 
 void USteamGameServerStats::OnGSStatsReceived(GSStatsReceived_t *pParam)
 {
+	STEAMBRIDGE_CALLBACK_SCOPE(OnGSStatsReceived, pParam);
 	m_OnGSStatsReceived.Broadcast((ESteamResult)pParam->m_eResult, pParam->m_steamIDUser.ConvertToUint64());
 }
 
 void USteamGameServerStats::OnGSStatsStored(GSStatsStored_t *pParam)
 {
+	STEAMBRIDGE_CALLBACK_SCOPE(OnGSStatsStored, pParam);
 	m_OnGSStatsStored.Broadcast((ESteamResult)pParam->m_eResult, pParam->m_steamIDUser.ConvertToUint64());
 }
 
 void USteamGameServerStats::OnGSStatsUnloaded(GSStatsUnloaded_t *pParam)
 {
+	STEAMBRIDGE_CALLBACK_SCOPE(OnGSStatsUnloaded, pParam);
 	m_OnGSStatsUnloaded.Broadcast(pParam->m_steamIDUser.ConvertToUint64());
 }
@@ -4,172 +4,198 @@
 
 #include "Core/SteamHTMLSurface.h"
 
+#include "SteamBridgeStats.h"
+#include "SteamBridgeTrace.h"
 #include "SteamBridgeUtils.h"
+#include "SteamCallbackDispatcher.h"
 
 USteamHTMLSurface::USteamHTMLSurface()
 {
-	OnHTMLBrowserReadyCallback.Register(this, &USteamHTMLSurface::OnHTMLBrowserReady);
-	OnHTMLCanGoBackAndForwardCallback.Register(this, &USteamHTMLSurface::OnHTMLCanGoBackAndForward);
-	OnHTMLChangedTitleCallback.Register(this, &USteamHTMLSurface::OnHTMLChangedTitle);
-	OnHTMLCloseBrowserCallback.Register(this, &USteamHTMLSurface::OnHTMLCloseBrowser);
-	OnHTMLFileOpenDialogCallback.Register(this, &USteamHTMLSurface::OnHTMLFileOpenDialog);
-	OnHTMLFinishedRequestCallback.Register(this, &USteamHTMLSurface::OnHTMLFinishedRequest);
-	OnHTMLHideToolTipCallback.Register(this, &USteamHTMLSurface::OnHTMLHideToolTip);
-	OnHTMLHorizontalScrollCallback.Register(this, &USteamHTMLSurface::OnHTMLHorizontalScroll);
-	OnHTMLJSAlertCallback.Register(this, &USteamHTMLSurface::OnHTMLJSAlert);
-	OnHTMLJSConfirmCallback.Register(this, &USteamHTMLSurface::OnHTMLJSConfirm);
-	OnHTMLLinkAtPositionCallback.Register(this, &USteamHTMLSurface::OnHTMLLinkAtPosition);
-	OnHTMLNeedsPaintCallback.Register(this, &USteamHTMLSurface::OnHTMLNeedsPaint);
-	OnHTMLNewWindowCallback.Register(this, &USteamHTMLSurface::OnHTMLNewWindow);
-	OnHTMLOpenLinkInNewTabCallback.Register(this, &USteamHTMLSurface::OnHTMLOpenLinkInNewTab);
-	OnHTMLSearchResultsCallback.Register(this, &USteamHTMLSurface::OnHTMLSearchResults);
-	OnHTMLSetCursorCallback.Register(this, &USteamHTMLSurface::OnHTMLSetCursor);
-	OnHTMLShowToolTipCallback.Register(this, &USteamHTMLSurface::OnHTMLShowToolTip);
-	OnHTMLStartRequestCallback.Register(this, &USteamHTMLSurface::OnHTMLStartRequest);
-	OnHTMLStatusTextCallback.Register(this, &USteamHTMLSurface::OnHTMLStatusText);
-	OnHTMLUpdateToolTipCallback.Register(this, &USteamHTMLSurface::OnHTMLUpdateToolTip);
-	OnHTMLURLChangedCallback.Register(this, &USteamHTMLSurface::OnHTMLURLChanged);
-	OnHTMLVerticalScrollCallback.Register(this, &USteamHTMLSurface::OnHTMLVerticalScroll);
+	FSteamCallbackDispatcher::RegisterLazy(OnHTMLBrowserReadyCallback, this, &USteamHTMLSurface::OnHTMLBrowserReady, m_OnHTMLBrowserReady);
+	FSteamCallbackDispatcher::RegisterLazy(OnHTMLCanGoBackAndForwardCallback, this, &USteamHTMLSurface::OnHTMLCanGoBackAndForward, m_OnHTMLCanGoBackAndForward);
+	FSteamCallbackDispatcher::RegisterLazy(OnHTMLChangedTitleCallback, this, &USteamHTMLSurface::OnHTMLChangedTitle, m_OnHTMLChangedTitle);
+	FSteamCallbackDispatcher::RegisterLazy(OnHTMLCloseBrowserCallback, this, &USteamHTMLSurface::OnHTMLCloseBrowser, m_OnHTMLCloseBrowser);
+	FSteamCallbackDispatcher::RegisterLazy(OnHTMLFileOpenDialogCallback, this, &USteamHTMLSurface::OnHTMLFileOpenDialog, m_OnHTMLFileOpenDialog);
+	FSteamCallbackDispatcher::RegisterLazy(OnHTMLFinishedRequestCallback, this, &USteamHTMLSurface::OnHTMLFinishedRequest, m_OnHTMLFinishedRequest);
+	FSteamCallbackDispatcher::RegisterLazy(OnHTMLHideToolTipCallback, this, &USteamHTMLSurface::OnHTMLHideToolTip, m_OnHTMLHideToolTip);
+	FSteamCallbackDispatcher::RegisterLazy(OnHTMLHorizontalScrollCallback, this, &USteamHTMLSurface::OnHTMLHorizontalScroll, m_OnHTMLHorizontalScroll);
+	FSteamCallbackDispatcher::RegisterLazy(OnHTMLJSAlertCallback, this, &USteamHTMLSurface::OnHTMLJSAlert, m_OnHTMLJSAlert);
+	FSteamCallbackDispatcher::RegisterLazy(OnHTMLJSConfirmCallback, this, &USteamHTMLSurface::OnHTMLJSConfirm, m_OnHTMLJSConfirm);
+	FSteamCallbackDispatcher::RegisterLazy(OnHTMLLinkAtPositionCallback, this, &USteamHTMLSurface::OnHTMLLinkAtPosition, m_OnHTMLLinkAtPosition);
+	FSteamCallbackDispatcher::RegisterLazy(OnHTMLNeedsPaintCallback, this, &USteamHTMLSurface::OnHTMLNeedsPaint, m_OnHTMLNeedsPaint);
+	FSteamCallbackDispatcher::RegisterLazy(OnHTMLNewWindowCallback, this, &USteamHTMLSurface::OnHTMLNewWindow, m_OnHTMLNewWindow);
+	FSteamCallbackDispatcher::RegisterLazy(OnHTMLOpenLinkInNewTabCallback, this, &USteamHTMLSurface::OnHTMLOpenLinkInNewTab, m_OnHTMLOpenLinkInNewTab);
+	FSteamCallbackDispatcher::RegisterLazy(OnHTMLSearchResultsCallback, this, &USteamHTMLSurface::OnHTMLSearchResults, m_OnHTMLSearchResults);
+	FSteamCallbackDispatcher::RegisterLazy(OnHTMLSetCursorCallback, this, &USteamHTMLSurface::OnHTMLSetCursor, m_OnHTMLSetCursor);
+	FSteamCallbackDispatcher::RegisterLazy(OnHTMLShowToolTipCallback, this, &USteamHTMLSurface::OnHTMLShowToolTip, m_OnHTMLShowToolTip);
+	FSteamCallbackDispatcher::RegisterLazy(OnHTMLStartRequestCallback, this, &USteamHTMLSurface::OnHTMLStartRequest, m_OnHTMLStartRequest);
+	FSteamCallbackDispatcher::RegisterLazy(OnHTMLStatusTextCallback, this, &USteamHTMLSurface::OnHTMLStatusText, m_OnHTMLStatusText);
+	FSteamCallbackDispatcher::RegisterLazy(OnHTMLUpdateToolTipCallback, this, &USteamHTMLSurface::OnHTMLUpdateToolTip, m_OnHTMLUpdateToolTip);
+	FSteamCallbackDispatcher::RegisterLazy(OnHTMLURLChangedCallback, this, &USteamHTMLSurface::OnHTMLURLChanged, m_OnHTMLURLChanged);
+	FSteamCallbackDispatcher::RegisterLazy(OnHTMLVerticalScrollCallback, this, &USteamHTMLSurface::OnHTMLVerticalScroll, m_OnHTMLVerticalScroll);
 }
 
 USteamHTMLSurface::~USteamHTMLSurface()
 {
-	OnHTMLBrowserReadyCallback.Unregister();
-	OnHTMLCanGoBackAndForwardCallback.Unregister();
-	OnHTMLChangedTitleCallback.Unregister();
-	OnHTMLCloseBrowserCallback.Unregister();
-	OnHTMLFileOpenDialogCallback.Unregister();
-	OnHTMLFinishedRequestCallback.Unregister();
-	OnHTMLHideToolTipCallback.Unregister();
-	OnHTMLHorizontalScrollCallback.Unregister();
-	OnHTMLJSAlertCallback.Unregister();
-	OnHTMLJSConfirmCallback.Unregister();
-	OnHTMLLinkAtPositionCallback.Unregister();
-	OnHTMLNeedsPaintCallback.Unregister();
-	OnHTMLNewWindowCallback.Unregister();
-	OnHTMLOpenLinkInNewTabCallback.Unregister();
-	OnHTMLSearchResultsCallback.Unregister();
-	OnHTMLSetCursorCallback.Unregister();
-	OnHTMLShowToolTipCallback.Unregister();
-	OnHTMLStartRequestCallback.Unregister();
-	OnHTMLStatusTextCallback.Unregister();
-	OnHTMLUpdateToolTipCallback.Unregister();
-	OnHTMLURLChangedCallback.Unregister();
-	OnHTMLVerticalScrollCallback.Unregister();
+	FSteamCallbackDispatcher::Unregister(OnHTMLBrowserReadyCallback);
+	FSteamCallbackDispatcher::Unregister(OnHTMLCanGoBackAndForwardCallback);
+	FSteamCallbackDispatcher::Unregister(OnHTMLChangedTitleCallback);
+	FSteamCallbackDispatcher::Unregister(OnHTMLCloseBrowserCallback);
+	FSteamCallbackDispatcher::Unregister(OnHTMLFileOpenDialogCallback);
+	FSteamCallbackDispatcher::Unregister(OnHTMLFinishedRequestCallback);
+	FSteamCallbackDispatcher::Unregister(OnHTMLHideToolTipCallback);
+	FSteamCallbackDispatcher::Unregister(OnHTMLHorizontalScrollCallback);
+	FSteamCallbackDispatcher::Unregister(OnHTMLJSAlertCallback);
+	FSteamCallbackDispatcher::Unregister(OnHTMLJSConfirmCallback);
+	FSteamCallbackDispatcher::Unregister(OnHTMLLinkAtPositionCallback);
+	FSteamCallbackDispatcher::Unregister(OnHTMLNeedsPaintCallback);
+	FSteamCallbackDispatcher::Unregister(OnHTMLNewWindowCallback);
+	FSteamCallbackDispatcher::Unregister(OnHTMLOpenLinkInNewTabCallback);
+	FSteamCallbackDispatcher::Unregister(OnHTMLSearchResultsCallback);
+	FSteamCallbackDispatcher::Unregister(OnHTMLSetCursorCallback);
+	FSteamCallbackDispatcher::Unregister(OnHTMLShowToolTipCallback);
+	FSteamCallbackDispatcher::Unregister(OnHTMLStartRequestCallback);
+	FSteamCallbackDispatcher::Unregister(OnHTMLStatusTextCallback);
+	FSteamCallbackDispatcher::Unregister(OnHTMLUpdateToolTipCallback);
+	FSteamCallbackDispatcher::Unregister(OnHTMLURLChangedCallback);
+	FSteamCallbackDispatcher::Unregister(OnHTMLVerticalScrollCallback);
 }
 
 void USteamHTMLSurface::SetCookie(const FString& Hostname, const FString& Key, const FString& Value, const FString& Path, int32 Expires, bool bSecure, bool bHTTPOnly)
 {
+	STEAMBRIDGE_TRACE_SCOPE(USteamHTMLSurface::SetCookie);
 	SteamHTMLSurface()->SetCookie(TCHAR_TO_UTF8(*Hostname), TCHAR_TO_UTF8(*Key), TCHAR_TO_UTF8(*Value), TCHAR_TO_UTF8(*Path), Expires, bSecure, bHTTPOnly);
 }
 
 void USteamHTMLSurface::OnHTMLBrowserReady(HTML_BrowserReady_t* pParam)
 {
+	STEAMBRIDGE_CALLBACK_SCOPE(OnHTMLBrowserReady, pParam);
 	m_OnHTMLBrowserReady.Broadcast(pParam->unBrowserHandle);
 }
 
 void USteamHTMLSurface::OnHTMLCanGoBackAndForward(HTML_CanGoBackAndForward_t* pParam)
 {
+	STEAMBRIDGE_CALLBACK_SCOPE(OnHTMLCanGoBackAndForward, pParam);
 	m_OnHTMLCanGoBackAndForward.Broadcast(pParam->unBrowserHandle, pParam->bCanGoBack, pParam->bCanGoForward);
 }
 
 void USteamHTMLSurface::OnHTMLChangedTitle(HTML_ChangedTitle_t* pParam)
 {
+	STEAMBRIDGE_CALLBACK_SCOPE(OnHTMLChangedTitle, pParam);
 	m_OnHTMLChangedTitle.Broadcast(pParam->unBrowserHandle, UTF8_TO_TCHAR(pParam->pchTitle));
 }
 
 void USteamHTMLSurface::OnHTMLCloseBrowser(HTML_CloseBrowser_t* pParam)
 {
+	STEAMBRIDGE_CALLBACK_SCOPE(OnHTMLCloseBrowser, pParam);
 	m_OnHTMLCloseBrowser.Broadcast(pParam->unBrowserHandle);
 }
 
 void USteamHTMLSurface::OnHTMLFileOpenDialog(HTML_FileOpenDialog_t* pParam)
 {
+	STEAMBRIDGE_CALLBACK_SCOPE(OnHTMLFileOpenDialog, pParam);
 	m_OnHTMLFileOpenDialog.Broadcast(pParam->unBrowserHandle, UTF8_TO_TCHAR(pParam->pchTitle), UTF8_TO_TCHAR(pParam->pchInitialFile));
 }
 
 void USteamHTMLSurface::OnHTMLFinishedRequest(HTML_FinishedRequest_t* pParam)
 {
+	STEAMBRIDGE_CALLBACK_SCOPE(OnHTMLFinishedRequest, pParam);
 	m_OnHTMLFinishedRequest.Broadcast(pParam->unBrowserHandle, UTF8_TO_TCHAR(pParam->pchURL), UTF8_TO_TCHAR(pParam->pchPageTitle));
 }
 
 void USteamHTMLSurface::OnHTMLHideToolTip(HTML_HideToolTip_t* pParam)
 {
+	STEAMBRIDGE_CALLBACK_SCOPE(OnHTMLHideToolTip, pParam);
 	m_OnHTMLHideToolTip.Broadcast(pParam->unBrowserHandle);
 }
 
 void USteamHTMLSurface::OnHTMLHorizontalScroll(HTML_HorizontalScroll_t* pParam)
 {
+	STEAMBRIDGE_CALLBACK_SCOPE(OnHTMLHorizontalScroll, pParam);
 	m_OnHTMLHorizontalScroll.Broadcast(pParam->unBrowserHandle, pParam->unScrollMax, pParam->unScrollCurrent, pParam->flPageScale, pParam->bVisible, pParam->unPageSize);
 }
 
 void USteamHTMLSurface::OnHTMLJSAlert(HTML_JSAlert_t* pParam)
 {
+	STEAMBRIDGE_CALLBACK_SCOPE(OnHTMLJSAlert, pParam);
 	m_OnHTMLJSAlert.Broadcast(pParam->unBrowserHandle, UTF8_TO_TCHAR(pParam->pchMessage));
 }
 
 void USteamHTMLSurface::OnHTMLJSConfirm(HTML_JSConfirm_t* pParam)
 {
+	STEAMBRIDGE_CALLBACK_SCOPE(OnHTMLJSConfirm, pParam);
 	m_OnHTMLJSConfirm.Broadcast(pParam->unBrowserHandle, UTF8_TO_TCHAR(pParam->pchMessage));
 }
 
 void USteamHTMLSurface::OnHTMLLinkAtPosition(HTML_LinkAtPosition_t* pParam)
 {
+	STEAMBRIDGE_CALLBACK_SCOPE(OnHTMLLinkAtPosition, pParam);
 	m_OnHTMLLinkAtPosition.Broadcast(pParam->unBrowserHandle, UTF8_TO_TCHAR(pParam->pchURL), pParam->bInput, pParam->bLiveLink);
 }
 
 void USteamHTMLSurface::OnHTMLNeedsPaint(HTML_NeedsPaint_t* pParam)
 {
+	STEAMBRIDGE_CALLBACK_SCOPE(OnHTMLNeedsPaint, pParam);
 	m_OnHTMLNeedsPaint.Broadcast(pParam->unBrowserHandle, UTF8_TO_TCHAR(pParam->pBGRA), {(int32)pParam->unTall, (int32)pParam->unWide}, {(int32)pParam->unUpdateX, (int32)pParam->unUpdateY}, {(int32)pParam->unUpdateTall, (int32)pParam->unUpdateWide},
 		{(int32)pParam->unScrollX, (int32)pParam->unScrollY}, pParam->flPageScale, pParam->unPageSerial);
 }
 
 void USteamHTMLSurface::OnHTMLNewWindow(HTML_NewWindow_t* pParam)
 {
+	STEAMBRIDGE_CALLBACK_SCOPE(OnHTMLNewWindow, pParam);
 	m_OnHTMLNewWindow.Broadcast(pParam->unBrowserHandle, UTF8_TO_TCHAR(pParam->pchURL), {(int32)pParam->unX, (int32)pParam->unY}, {(int32)pParam->unTall, (int32)pParam->unWide});
 }
 
 void USteamHTMLSurface::OnHTMLOpenLinkInNewTab(HTML_OpenLinkInNewTab_t* pParam)
 {
+	STEAMBRIDGE_CALLBACK_SCOPE(OnHTMLOpenLinkInNewTab, pParam);
 	m_OnHTMLOpenLinkInNewTab.Broadcast(pParam->unBrowserHandle, UTF8_TO_TCHAR(pParam->pchURL));
 }
 
 void USteamHTMLSurface::OnHTMLSearchResults(HTML_SearchResults_t* pParam)
 {
+	STEAMBRIDGE_CALLBACK_SCOPE(OnHTMLSearchResults, pParam);
 	m_OnHTMLSearchResults.Broadcast(pParam->unBrowserHandle, pParam->unResults, pParam->unCurrentMatch);
 }
 
 void USteamHTMLSurface::OnHTMLSetCursor(HTML_SetCursor_t* pParam)
 {
+	STEAMBRIDGE_CALLBACK_SCOPE(OnHTMLSetCursor, pParam);
 	m_OnHTMLSetCursor.Broadcast(pParam->unBrowserHandle, (ESteamMouseCursor)pParam->eMouseCursor);
 }
 
 void USteamHTMLSurface::OnHTMLShowToolTip(HTML_ShowToolTip_t* pParam)
 {
+	STEAMBRIDGE_CALLBACK_SCOPE(OnHTMLShowToolTip, pParam);
 	m_OnHTMLShowToolTip.Broadcast(pParam->unBrowserHandle, UTF8_TO_TCHAR(pParam->pchMsg));
 }
 
 void USteamHTMLSurface::OnHTMLStartRequest(HTML_StartRequest_t* pParam)
 {
+	STEAMBRIDGE_CALLBACK_SCOPE(OnHTMLStartRequest, pParam);
 	m_OnHTMLStartRequest.Broadcast(pParam->unBrowserHandle, UTF8_TO_TCHAR(pParam->pchURL), UTF8_TO_TCHAR(pParam->pchTarget), UTF8_TO_TCHAR(pParam->pchPostData), pParam->bIsRedirect);
 }
 
 void USteamHTMLSurface::OnHTMLStatusText(HTML_StatusText_t* pParam)
 {
+	STEAMBRIDGE_CALLBACK_SCOPE(OnHTMLStatusText, pParam);
 	m_OnHTMLStatusText.Broadcast(pParam->unBrowserHandle, UTF8_TO_TCHAR(pParam->pchMsg));
 }
 
 void USteamHTMLSurface::OnHTMLUpdateToolTip(HTML_UpdateToolTip_t* pParam)
 {
+	STEAMBRIDGE_CALLBACK_SCOPE(OnHTMLUpdateToolTip, pParam);
 	m_OnHTMLUpdateToolTip.Broadcast(pParam->unBrowserHandle, UTF8_TO_TCHAR(pParam->pchMsg));
 }
 
 void USteamHTMLSurface::OnHTMLURLChanged(HTML_URLChanged_t* pParam)
 {
+	STEAMBRIDGE_CALLBACK_SCOPE(OnHTMLURLChanged, pParam);
 	m_OnHTMLURLChanged.Broadcast(pParam->unBrowserHandle, UTF8_TO_TCHAR(pParam->pchURL), UTF8_TO_TCHAR(pParam->pchPostData), pParam->bIsRedirect, UTF8_TO_TCHAR(pParam->pchPageTitle), pParam->bNewNavigation);
 }
 
 void USteamHTMLSurface::OnHTMLVerticalScroll(HTML_VerticalScroll_t* pParam)
 {
+	STEAMBRIDGE_CALLBACK_SCOPE(OnHTMLVerticalScroll, pParam);
 	m_OnHTMLVerticalScroll.Broadcast(pParam->unBrowserHandle, pParam->unScrollMax, pParam->unScrollCurrent, pParam->flPageScale, pParam->bVisible, pParam->unPageSize);
 }
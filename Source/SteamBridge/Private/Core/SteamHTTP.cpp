@@ -4,61 +4,73 @@
 
 #include "Core/SteamHTTP.h"
 
+#include "SteamBridgeStats.h"
+#include "SteamBridgeTrace.h"
 #include "SteamBridgeUtils.h"
+#include "SteamCallbackDispatcher.h"
 
 USteamHTTP::USteamHTTP()
 {
-	OnHTTPRequestCompletedCallback.Register(this, &USteamHTTP::OnHTTPRequestCompleted);
-	OnHTTPRequestDataReceivedCallback.Register(this, &USteamHTTP::OnHTTPRequestDataReceived);
-	OnHTTPRequestHeadersReceivedCallback.Register(this, &USteamHTTP::OnHTTPRequestHeadersReceived);
+	FSteamCallbackDispatcher::RegisterLazy(OnHTTPRequestCompletedCallback, this, &USteamHTTP::OnHTTPRequestCompleted, m_OnHTTPRequestCompleted);
+	FSteamCallbackDispatcher::RegisterLazy(OnHTTPRequestDataReceivedCallback, this, &USteamHTTP::OnHTTPRequestDataReceived, m_OnHTTPRequestDataReceived);
+	FSteamCallbackDispatcher::RegisterLazy(OnHTTPRequestHeadersReceivedCallback, this, &USteamHTTP::OnHTTPRequestHeadersReceived, m_OnHTTPRequestHeadersReceived);
 }
 
 USteamHTTP::~USteamHTTP()
 {
-	OnHTTPRequestCompletedCallback.Unregister();
-	OnHTTPRequestDataReceivedCallback.Unregister();
-	OnHTTPRequestHeadersReceivedCallback.Unregister();
+	FSteamCallbackDispatcher::Unregister(OnHTTPRequestCompletedCallback);
+	FSteamCallbackDispatcher::Unregister(OnHTTPRequestDataReceivedCallback);
+	FSteamCallbackDispatcher::Unregister(OnHTTPRequestHeadersReceivedCallback);
 }
 
 bool USteamHTTP::GetHTTPResponseBodySize(FHTTPRequestHandle RequestHandle, int32& BodySize)
 {
+	STEAMBRIDGE_TRACE_SCOPE(USteamHTTP::GetHTTPResponseBodySize);
 	uint32 Tmp = 0;
 	BodySize = Tmp;
-	return SteamHTTP()->GetHTTPResponseBodySize(RequestHandle, &Tmp);
+	return SteamBridgeHTTP()->GetHTTPResponseBodySize(RequestHandle, &Tmp);
 }
 
 bool USteamHTTP::GetHTTPResponseHeaderSize(FHTTPRequestHandle RequestHandle, const FString& HeaderName, int32& ResponseHeaderSize)
 {
+	STEAMBRIDGE_TRACE_SCOPE(USteamHTTP::GetHTTPResponseHeaderSize);
 	uint32 Tmp = 0;
 	ResponseHeaderSize = Tmp;
-	return SteamHTTP()->GetHTTPResponseHeaderSize(RequestHandle, TCHAR_TO_UTF8(*HeaderName), &Tmp);
+	return SteamBridgeHTTP()->GetHTTPResponseHeaderSize(RequestHandle, TCHAR_TO_UTF8(*HeaderName), &Tmp);
 }
 
 bool USteamHTTP::SendHTTPRequest(FHTTPRequestHandle RequestHandle, FSteamAPICall& CallHandle)
 {
+	STEAMBRIDGE_TRACE_SCOPE(USteamHTTP::SendHTTPRequest);
 	SteamAPICall_t Tmp = 0;
-	CallHandle = Tmp;
-	return SteamHTTP()->SendHTTPRequest(RequestHandle, &Tmp);
+	bool bResult = SteamBridgeHTTP()->SendHTTPRequest(RequestHandle, &Tmp);
+	CallHandle = FSteamBridgeTrace::APICallIssued(Tmp);
+	return bResult;
 }
 
 bool USteamHTTP::SendHTTPRequestAndStreamResponse(FHTTPRequestHandle RequestHandle, FSteamAPICall& CallHandle)
 {
+	STEAMBRIDGE_TRACE_SCOPE(USteamHTTP::SendHTTPRequestAndStreamResponse);
 	SteamAPICall_t Tmp = 0;
-	CallHandle = Tmp;
-	return SteamHTTP()->SendHTTPRequestAndStreamResponse(RequestHandle, &Tmp);
+	bool bResult = SteamBridgeHTTP()->SendHTTPRequestAndStreamResponse(RequestHandle, &Tmp);
+	CallHandle = FSteamBridgeTrace::APICallIssued(Tmp);
+	return bResult;
 }
 
 void USteamHTTP::OnHTTPRequestCompleted(HTTPRequestCompleted_t* pParam)
 {
+	STEAMBRIDGE_CALLBACK_SCOPE(OnHTTPRequestCompleted, pParam);
 	m_OnHTTPRequestCompleted.Broadcast(pParam->m_hRequest, pParam->m_ulContextValue, pParam->m_bRequestSuccessful, (ESteamHTTPStatus::Type)pParam->m_eStatusCode, pParam->m_unBodySize);
 }
 
 void USteamHTTP::OnHTTPRequestDataReceived(HTTPRequestDataReceived_t* pParam)
 {
+	STEAMBRIDGE_CALLBACK_SCOPE(OnHTTPRequestDataReceived, pParam);
 	m_OnHTTPRequestDataReceived.Broadcast(pParam->m_hRequest, pParam->m_ulContextValue, pParam->m_cOffset, pParam->m_cBytesReceived);
 }
 
 void USteamHTTP::OnHTTPRequestHeadersReceived(HTTPRequestHeadersReceived_t* pParam)
 {
+	STEAMBRIDGE_CALLBACK_SCOPE(OnHTTPRequestHeadersReceived, pParam);
 	m_OnHTTPRequestHeadersReceived.Broadcast(pParam->m_hRequest, pParam->m_ulContextValue);
 }
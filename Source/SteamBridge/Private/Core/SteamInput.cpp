@@ -4,6 +4,7 @@
 
 #include "Core/SteamInput.h"
 
+#include "SteamBridgeTrace.h"
 #include "SteamBridgeUtils.h"
 
 USteamInput::USteamInput()
@@ -16,6 +17,7 @@ USteamInput::~USteamInput()
 
 int32 USteamInput::GetActiveActionSetLayers(FInputHandle InputHandle, TArray<FInputHandle>& Handles)
 {
+	STEAMBRIDGE_TRACE_SCOPE(USteamInput::GetActiveActionSetLayers);
 	TArray<uint64> Tmp;
 	int32 result = SteamInput()->GetActiveActionSetLayers(InputHandle.Value, Tmp.GetData());
 
@@ -29,12 +31,14 @@ int32 USteamInput::GetActiveActionSetLayers(FInputHandle InputHandle, TArray<FIn
 
 FSteamInputAnalogActionData USteamInput::GetAnalogActionData(FInputHandle InputHandle, FInputActionSetHandle ActionSetLayerHandle) const
 {
+	STEAMBRIDGE_TRACE_SCOPE(USteamInput::GetAnalogActionData);
 	InputAnalogActionData_t data = SteamInput()->GetAnalogActionData(InputHandle.Value, ActionSetLayerHandle.Value);
 	return {(ESteamControllerSourceMode)data.eMode, data.x, data.y, data.bActive};
 }
 
 int32 USteamInput::GetAnalogActionOrigins(FInputHandle InputHandle, FInputActionSetHandle ActionSetHandle, FInputAnalogActionHandle AnalogActionHandle, TArray<ESteamInputActionOrigin>& Origins)
 {
+	STEAMBRIDGE_TRACE_SCOPE(USteamInput::GetAnalogActionOrigins);
 	TArray<EInputActionOrigin> Tmp;
 	int32 result = SteamInput()->GetAnalogActionOrigins(InputHandle, ActionSetHandle, AnalogActionHandle, Tmp.GetData());
 
@@ -48,6 +52,7 @@ int32 USteamInput::GetAnalogActionOrigins(FInputHandle InputHandle, FInputAction
 
 int32 USteamInput::GetConnectedControllers(TArray<FInputHandle>& Handles)
 {
+	STEAMBRIDGE_TRACE_SCOPE(USteamInput::GetConnectedControllers);
 	TArray<uint64> Tmp;
 	int32 result = SteamInput()->GetConnectedControllers(Tmp.GetData());
 
@@ -61,12 +66,14 @@ int32 USteamInput::GetConnectedControllers(TArray<FInputHandle>& Handles)
 
 FSteamInputDigitalActionData USteamInput::GetDigitalActionData(FInputHandle InputHandle, FInputDigitalActionHandle DigitalActionHandle) const
 {
+	STEAMBRIDGE_TRACE_SCOPE(USteamInput::GetDigitalActionData);
 	InputDigitalActionData_t data = SteamInput()->GetDigitalActionData(InputHandle.Value, DigitalActionHandle);
 	return {data.bState, data.bActive};
 }
 
 int32 USteamInput::GetDigitalActionOrigins(FInputHandle InputHandle, FInputActionSetHandle ActionSetHandle, FInputDigitalActionHandle DigitalActionHandle, TArray<ESteamInputActionOrigin>& Origins)
 {
+	STEAMBRIDGE_TRACE_SCOPE(USteamInput::GetDigitalActionOrigins);
 	TArray<EInputActionOrigin> Tmp;
 	int32 result = SteamInput()->GetDigitalActionOrigins(InputHandle.Value, ActionSetHandle.Value, DigitalActionHandle, Tmp.GetData());
 
@@ -80,26 +87,17 @@ int32 USteamInput::GetDigitalActionOrigins(FInputHandle InputHandle, FInputActio
 
 FSteamInputMotionData USteamInput::GetMotionData(FInputHandle InputHandle) const
 {
+	STEAMBRIDGE_TRACE_SCOPE(USteamInput::GetMotionData);
 	InputMotionData_t data = SteamInput()->GetMotionData(InputHandle.Value);
 	return {{data.rotQuatX, data.rotQuatY, data.rotQuatZ, data.rotQuatW}, {data.posAccelX, data.posAccelY, data.posAccelZ}, {data.rotVelX, data.rotVelY, data.rotVelZ}};
 }
 
 void USteamInput::SetLEDColorU(FInputHandle InputHandle, uint8 R, uint8 G, uint8 B, const TArray<ESteamControllerLEDFlag_>& Flags)
 {
-	int Tmp = 0;
-	for (int i = 0; i < Flags.Num(); i++)
-	{
-		Tmp |= 1 << (uint8)Flags[i];
-	}
-	SteamInput()->SetLEDColor(InputHandle.Value, R, G, B, Tmp);
+	SetLEDColorU(InputHandle, R, G, B, FSteamControllerLEDFlags::FromArray(Flags));
 }
 
 void USteamInput::SetLEDColor(FInputHandle InputHandle, const FLinearColor& Color, const TArray<ESteamControllerLEDFlag_>& Flags)
 {
-	int Tmp = 0;
-	for (int i = 0; i < Flags.Num(); i++)
-	{
-		Tmp |= 1 << (uint8)Flags[i];
-	}
-	SteamInput()->SetLEDColor(InputHandle.Value, Color.R, Color.G, Color.B, Tmp);
+	SetLEDColor(InputHandle, Color, FSteamControllerLEDFlags::FromArray(Flags));
 }
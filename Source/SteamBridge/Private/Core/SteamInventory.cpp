@@ -4,6 +4,7 @@
 
 #include "Core/SteamInventory.h"
 
+#include "SteamBridgeTrace.h"
 #include "SteamBridgeUtils.h"
 
 USteamInventory::USteamInventory()
@@ -16,19 +17,21 @@ USteamInventory::~USteamInventory()
 
 bool USteamInventory::AddPromoItems(FSteamInventoryResult& ResultHandle, const TArray<FSteamItemDef>& ItemDefs) const
 {
+	STEAMBRIDGE_TRACE_SCOPE(USteamInventory::AddPromoItems);
 	TArray<int32> Tmp;
 	for (int32 i = 0; i < ItemDefs.Num(); i++)
 	{
 		Tmp.Add(ItemDefs[i]);
 	}
 
-	return SteamInventory()->AddPromoItems(&ResultHandle.Value, Tmp.GetData(), Tmp.Num());
+	return SteamBridgeInventory()->AddPromoItems(&ResultHandle.Value, Tmp.GetData(), Tmp.Num());
 }
 
 bool USteamInventory::GetItemPrice(FSteamItemDef ItemDef, int64& CurrentPrice, int64& BasePrice) const
 {
+	STEAMBRIDGE_TRACE_SCOPE(USteamInventory::GetItemPrice);
 	uint64 TmpCurrent = 0, TmpBase = 0;
 	CurrentPrice = TmpCurrent;
 	BasePrice = TmpBase;
-	return SteamInventory()->GetItemPrice(ItemDef.Value, &TmpCurrent, &TmpBase);
+	return SteamBridgeInventory()->GetItemPrice(ItemDef.Value, &TmpCurrent, &TmpBase);
 }
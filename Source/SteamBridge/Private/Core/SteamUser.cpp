@@ -2,58 +2,63 @@
 
 #include "Core/SteamUser.h"
 
+#include "SteamBridgeStats.h"
+#include "SteamBridgeTrace.h"
 #include "SteamBridgeUtils.h"
+#include "SteamCallbackDispatcher.h"
 
 USteamUser::USteamUser()
 {
-	OnClientGameServerDenyCallback.Register(this, &USteamUser::OnClientGameServerDeny);
-	OnDurationControlCallback.Register(this, &USteamUser::OnDurationControl);
-	OnEncryptedAppTicketResponseCallback.Register(this, &USteamUser::OnEncryptedAppTicketResponse);
-	OnGameWebCallback.Register(this, &USteamUser::OnGameWeb);
-	OnGetAuthSessionTicketResponseCallback.Register(this, &USteamUser::OnGetAuthSessionTicketResponse);
-	OnIPCFailureCallback.Register(this, &USteamUser::OnIPCFailure);
-	OnLicensesUpdatedCallback.Register(this, &USteamUser::OnLicensesUpdated);
-	OnMicroTxnAuthorizationResponseCallback.Register(this, &USteamUser::OnMicroTxnAuthorizationResponse);
-	OnSteamServerConnectFailureCallback.Register(this, &USteamUser::OnSteamServerConnectFailure);
-	OnSteamServersConnectedCallback.Register(this, &USteamUser::OnSteamServersConnected);
-	OnSteamServersDisconnectedCallback.Register(this, &USteamUser::OnSteamServersDisconnected);
-	OnStoreAuthURLResponseCallback.Register(this, &USteamUser::OnStoreAuthURLResponse);
-	OnValidateAuthTicketResponseCallback.Register(this, &USteamUser::OnValidateAuthTicketResponse);
+	FSteamCallbackDispatcher::RegisterLazy(OnClientGameServerDenyCallback, this, &USteamUser::OnClientGameServerDeny, m_OnClientGameServerDeny);
+	FSteamCallbackDispatcher::RegisterLazy(OnDurationControlCallback, this, &USteamUser::OnDurationControl, m_OnDurationControl);
+	FSteamCallbackDispatcher::RegisterLazy(OnEncryptedAppTicketResponseCallback, this, &USteamUser::OnEncryptedAppTicketResponse, m_OnEncryptedAppTicketResponse);
+	FSteamCallbackDispatcher::RegisterLazy(OnGameWebCallback, this, &USteamUser::OnGameWeb, m_OnGameWeb);
+	FSteamCallbackDispatcher::RegisterLazy(OnGetAuthSessionTicketResponseCallback, this, &USteamUser::OnGetAuthSessionTicketResponse, m_OnGetAuthSessionTicketResponse);
+	FSteamCallbackDispatcher::RegisterLazy(OnIPCFailureCallback, this, &USteamUser::OnIPCFailure, m_IPCFailure);
+	FSteamCallbackDispatcher::RegisterLazy(OnLicensesUpdatedCallback, this, &USteamUser::OnLicensesUpdated, m_OnLicensesUpdated);
+	FSteamCallbackDispatcher::RegisterLazy(OnMicroTxnAuthorizationResponseCallback, this, &USteamUser::OnMicroTxnAuthorizationResponse, m_OnMicroTxnAuthorizationResponse);
+	FSteamCallbackDispatcher::RegisterLazy(OnSteamServerConnectFailureCallback, this, &USteamUser::OnSteamServerConnectFailure, m_OnSteamServerConnectFailure);
+	FSteamCallbackDispatcher::RegisterLazy(OnSteamServersConnectedCallback, this, &USteamUser::OnSteamServersConnected, m_OnSteamServersConnected);
+	FSteamCallbackDispatcher::RegisterLazy(OnSteamServersDisconnectedCallback, this, &USteamUser::OnSteamServersDisconnected, m_OnSteamServersDisconnected);
+	FSteamCallbackDispatcher::RegisterLazy(OnStoreAuthURLResponseCallback, this, &USteamUser::OnStoreAuthURLResponse, m_OnStoreAuthURLResponse);
+	FSteamCallbackDispatcher::RegisterLazy(OnValidateAuthTicketResponseCallback, this, &USteamUser::OnValidateAuthTicketResponse, m_OnValidateAuthTicketResponse);
 }
 
 USteamUser::~USteamUser()
 {
-	OnClientGameServerDenyCallback.Unregister();
-	OnDurationControlCallback.Unregister();
-	OnEncryptedAppTicketResponseCallback.Unregister();
-	OnGameWebCallback.Unregister();
-	OnGetAuthSessionTicketResponseCallback.Unregister();
-	OnIPCFailureCallback.Unregister();
-	OnLicensesUpdatedCallback.Unregister();
-	OnMicroTxnAuthorizationResponseCallback.Unregister();
-	OnSteamServerConnectFailureCallback.Unregister();
-	OnSteamServersConnectedCallback.Unregister();
-	OnSteamServersDisconnectedCallback.Unregister();
-	OnStoreAuthURLResponseCallback.Unregister();
-	OnValidateAuthTicketResponseCallback.Unregister();
+	FSteamCallbackDispatcher::Unregister(OnClientGameServerDenyCallback);
+	FSteamCallbackDispatcher::Unregister(OnDurationControlCallback);
+	FSteamCallbackDispatcher::Unregister(OnEncryptedAppTicketResponseCallback);
+	FSteamCallbackDispatcher::Unregister(OnGameWebCallback);
+	FSteamCallbackDispatcher::Unregister(OnGetAuthSessionTicketResponseCallback);
+	FSteamCallbackDispatcher::Unregister(OnIPCFailureCallback);
+	FSteamCallbackDispatcher::Unregister(OnLicensesUpdatedCallback);
+	FSteamCallbackDispatcher::Unregister(OnMicroTxnAuthorizationResponseCallback);
+	FSteamCallbackDispatcher::Unregister(OnSteamServerConnectFailureCallback);
+	FSteamCallbackDispatcher::Unregister(OnSteamServersConnectedCallback);
+	FSteamCallbackDispatcher::Unregister(OnSteamServersDisconnectedCallback);
+	FSteamCallbackDispatcher::Unregister(OnStoreAuthURLResponseCallback);
+	FSteamCallbackDispatcher::Unregister(OnValidateAuthTicketResponseCallback);
 }
 
 void USteamUser::AdvertiseGame(FSteamID SteamID, const FString& IP, int32 Port)
 {
+	STEAMBRIDGE_TRACE_SCOPE(USteamUser::AdvertiseGame);
 	uint32 TmpIP;
 	USteamBridgeUtils::ConvertIPStringToUint32(IP, TmpIP);
-	SteamUser()->AdvertiseGame(SteamID.Value, TmpIP, FMath::Clamp<uint16>(Port, 0, 65535));
+	SteamBridgeUser()->AdvertiseGame(SteamID.Value, TmpIP, FMath::Clamp<uint16>(Port, 0, 65535));
 }
 
 ESteamVoiceResult USteamUser::DecompressVoice(TArray<uint8> CompressedBuffer, TArray<uint8>& UncompressedBuffer)
 {
+	STEAMBRIDGE_TRACE_SCOPE(USteamUser::DecompressVoice);
 	ESteamVoiceResult result = ESteamVoiceResult::NotInitialized;
 	uint16 BufferSize = 1024;
 	for (int i = 0; i < 4; i++)
 	{
 		uint32 BytesWritten = 0;
 		UncompressedBuffer.SetNum(BufferSize);
-		result = (ESteamVoiceResult)SteamUser()->DecompressVoice(CompressedBuffer.GetData(), CompressedBuffer.Num(), UncompressedBuffer.GetData(), UncompressedBuffer.Num(), &BytesWritten, 48000);
+		result = (ESteamVoiceResult)SteamBridgeUser()->DecompressVoice(CompressedBuffer.GetData(), CompressedBuffer.Num(), UncompressedBuffer.GetData(), UncompressedBuffer.Num(), &BytesWritten, 48000);
 		UncompressedBuffer.SetNum(BytesWritten);
 
 		if (result == ESteamVoiceResult::OK)
@@ -68,30 +73,33 @@ ESteamVoiceResult USteamUser::DecompressVoice(TArray<uint8> CompressedBuffer, TA
 
 FHAuthTicket USteamUser::GetAuthSessionTicket(TArray<uint8>& Ticket)
 {
+	STEAMBRIDGE_TRACE_SCOPE(USteamUser::GetAuthSessionTicket);
 	Ticket.SetNum(m_buffer);
 	uint32 TempCounter = 0;
-	FHAuthTicket bResult = SteamUser()->GetAuthSessionTicket(Ticket.GetData(), m_buffer, &TempCounter);
+	FHAuthTicket bResult = SteamBridgeUser()->GetAuthSessionTicket(Ticket.GetData(), m_buffer, &TempCounter);
 	Ticket.SetNum(TempCounter);
 	return bResult;
 }
 
 bool USteamUser::GetEncryptedAppTicket(TArray<uint8>& Ticket)
 {
+	STEAMBRIDGE_TRACE_SCOPE(USteamUser::GetEncryptedAppTicket);
 	uint32 TempCounter = 0;
 	Ticket.SetNum(m_buffer);
-	bool bResult = SteamUser()->GetEncryptedAppTicket(Ticket.GetData(), m_buffer, &TempCounter);
+	bool bResult = SteamBridgeUser()->GetEncryptedAppTicket(Ticket.GetData(), m_buffer, &TempCounter);
 	Ticket.SetNum(TempCounter);
 	return bResult;
 }
 
 ESteamVoiceResult USteamUser::GetVoice(TArray<uint8>& VoiceData)
 {
+	STEAMBRIDGE_TRACE_SCOPE(USteamUser::GetVoice);
 	int32 tmpData = 0;
 	ESteamVoiceResult result = GetAvailableVoice(tmpData);
 	if (result == ESteamVoiceResult::OK)
 	{
 		VoiceData.SetNum(tmpData);
-		result = (ESteamVoiceResult)SteamUser()->GetVoice(true, VoiceData.GetData(), VoiceData.Num(), (uint32*)&tmpData);
+		result = (ESteamVoiceResult)SteamBridgeUser()->GetVoice(true, VoiceData.GetData(), VoiceData.Num(), (uint32*)&tmpData);
 		VoiceData.SetNum(tmpData);
 	}
 	return result;
@@ -99,72 +107,86 @@ ESteamVoiceResult USteamUser::GetVoice(TArray<uint8>& VoiceData)
 
 int32 USteamUser::InitiateGameConnection(TArray<uint8>& pAuthBlob, FSteamID steamIDGameServer, int32 unIPServer, int32 usPortServer, bool bSecure)
 {
-	return SteamUser()->InitiateGameConnection(pAuthBlob.GetData(), m_buffer, steamIDGameServer.Value, unIPServer, usPortServer, bSecure);
+	STEAMBRIDGE_TRACE_SCOPE(USteamUser::InitiateGameConnection);
+	return SteamBridgeUser()->InitiateGameConnection(pAuthBlob.GetData(), m_buffer, steamIDGameServer.Value, unIPServer, usPortServer, bSecure);
 }
 
 void USteamUser::OnClientGameServerDeny(ClientGameServerDeny_t* pParam)
 {
+	STEAMBRIDGE_CALLBACK_SCOPE(OnClientGameServerDeny, pParam);
 	FString IP = USteamBridgeUtils::ConvertIPToString(pParam->m_unGameServerIP);
 	m_OnClientGameServerDeny.Broadcast(pParam->m_uAppID, IP, pParam->m_usGameServerPort, pParam->m_bSecure == 1, (ESteamDenyReason)pParam->m_uReason);
 }
 
 void USteamUser::OnDurationControl(DurationControl_t* pParam)
 {
+	STEAMBRIDGE_CALLBACK_SCOPE(OnDurationControl, pParam);
 	m_OnDurationControl.Broadcast((ESteamResult)pParam->m_eResult, (int32)pParam->m_appid, pParam->m_bApplicable, pParam->m_csecsLast5h, (ESteamDurationControlProgress)pParam->m_progress,
 		(ESteamDurationControlNotification)pParam->m_notification);
 }
 
 void USteamUser::OnEncryptedAppTicketResponse(EncryptedAppTicketResponse_t* pParam)
 {
+	STEAMBRIDGE_CALLBACK_SCOPE(OnEncryptedAppTicketResponse, pParam);
 	m_OnEncryptedAppTicketResponse.Broadcast((ESteamResult)pParam->m_eResult);
 }
 
 void USteamUser::OnGameWeb(GameWebCallback_t* pParam)
 {
+	STEAMBRIDGE_CALLBACK_SCOPE(OnGameWeb, pParam);
 	m_OnGameWeb.Broadcast(pParam->m_szURL);
 }
 
 void USteamUser::OnGetAuthSessionTicketResponse(GetAuthSessionTicketResponse_t* pParam)
 {
+	STEAMBRIDGE_CALLBACK_SCOPE(OnGetAuthSessionTicketResponse, pParam);
 	m_OnGetAuthSessionTicketResponse.Broadcast(pParam->m_hAuthTicket, (ESteamResult)pParam->m_eResult);
 }
 
 void USteamUser::OnIPCFailure(IPCFailure_t* pParam)
 {
+	STEAMBRIDGE_CALLBACK_SCOPE(OnIPCFailure, pParam);
 	m_IPCFailure.Broadcast((ESteamFailureType)pParam->m_eFailureType);
 }
 
 void USteamUser::OnLicensesUpdated(LicensesUpdated_t* pParam)
 {
+	STEAMBRIDGE_CALLBACK_SCOPE(OnLicensesUpdated, pParam);
 	m_OnLicensesUpdated.Broadcast();
 }
 
 void USteamUser::OnMicroTxnAuthorizationResponse(MicroTxnAuthorizationResponse_t* pParam)
 {
+	STEAMBRIDGE_CALLBACK_SCOPE(OnMicroTxnAuthorizationResponse, pParam);
 	m_OnMicroTxnAuthorizationResponse.Broadcast(pParam->m_unAppID, FString::FromInt(pParam->m_ulOrderID), pParam->m_bAuthorized == 1);
 }
 
 void USteamUser::OnSteamServerConnectFailure(SteamServerConnectFailure_t* pParam)
 {
+	STEAMBRIDGE_CALLBACK_SCOPE(OnSteamServerConnectFailure, pParam);
 	m_OnSteamServerConnectFailure.Broadcast((ESteamResult)pParam->m_eResult, pParam->m_bStillRetrying);
 }
 
 void USteamUser::OnSteamServersConnected(SteamServersConnected_t* pParam)
 {
+	STEAMBRIDGE_CALLBACK_SCOPE(OnSteamServersConnected, pParam);
 	m_OnSteamServersConnected.Broadcast();
 }
 
 void USteamUser::OnSteamServersDisconnected(SteamServersDisconnected_t* pParam)
 {
+	STEAMBRIDGE_CALLBACK_SCOPE(OnSteamServersDisconnected, pParam);
 	m_OnSteamServersDisconnected.Broadcast((ESteamResult)pParam->m_eResult);
 }
 
 void USteamUser::OnStoreAuthURLResponse(StoreAuthURLResponse_t* pParam)
 {
+	STEAMBRIDGE_CALLBACK_SCOPE(OnStoreAuthURLResponse, pParam);
 	m_OnStoreAuthURLResponse.Broadcast(pParam->m_szURL);
 }
 
 void USteamUser::OnValidateAuthTicketResponse(ValidateAuthTicketResponse_t* pParam)
 {
+	STEAMBRIDGE_CALLBACK_SCOPE(OnValidateAuthTicketResponse, pParam);
 	m_OnValidateAuthTicketResponse.Broadcast(pParam->m_SteamID.ConvertToUint64(), (ESteamAuthSessionResponse)pParam->m_eAuthSessionResponse, pParam->m_OwnerSteamID.ConvertToUint64());
 }
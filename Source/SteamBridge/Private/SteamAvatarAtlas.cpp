@@ -0,0 +1,155 @@
+// Copyright 2020 Russ 'trdwll' Treadwell <trdwll.com>. All Rights Reserved.
+
+#include "SteamAvatarAtlas.h"
+
+#include "Engine/Texture2D.h"
+#include "SteamBackend.h"
+#include "SteamBridgeTrace.h"
+#include "SteamImageUtils.h"
+
+FSteamAvatarAtlas::FSteamAvatarAtlas(int32 AvatarSize, int32 PageSize, int32 MaxPages) :
+	m_AvatarSize(AvatarSize), m_PageSize(FMath::Max(PageSize, AvatarSize)), m_SlotsPerRow(FMath::Max(PageSize, AvatarSize) / AvatarSize), m_MaxPages(FMath::Max(MaxPages, 1))
+{
+}
+
+bool FSteamAvatarAtlas::Get(int32 Image, UTexture2D*& Page, FBox2D& UV)
+{
+	STEAMBRIDGE_TRACE_SCOPE(FSteamAvatarAtlas::Get);
+	if (FEntry* const Entry = m_Entries.Find(Image))
+	{
+		if (Entry->Node != m_LRU.GetHead())
+		{
+			m_LRU.RemoveNode(Entry->Node, false);
+			m_LRU.AddHead(Entry->Node);
+		}
+
+		GetSlot(Entry->Slot, Page, UV);
+		return true;
+	}
+
+	// 0 is no avatar and -1 is still loading. Checked up front so a slot isn't evicted for an image that can't be added
+	uint32 Width = 0, Height = 0;
+	if (Image <= 0 || !SteamBridgeUtils()->GetImageSize(Image, &Width, &Height) || Width != (uint32)m_AvatarSize || Height != (uint32)m_AvatarSize)
+	{
+		return false;
+	}
+
+	const int32 Slot = AllocateSlot();
+	if (!Upload(Image, Slot))
+	{
+		m_FreeSlots.Add(Slot);
+		return false;
+	}
+
+	m_LRU.AddHead(Image);
+	m_Entries.Add(Image, {Slot, m_LRU.GetHead()});
+
+	GetSlot(Slot, Page, UV);
+	return true;
+}
+
+bool FSteamAvatarAtlas::Refresh(int32 Image)
+{
+	const FEntry* const Entry = m_Entries.Find(Image);
+	if (Entry == nullptr)
+	{
+		return false;
+	}
+
+	STEAMBRIDGE_TRACE_SCOPE(FSteamAvatarAtlas::Refresh);
+	Upload(Image, Entry->Slot);
+	return true;
+}
+
+void FSteamAvatarAtlas::Release(int32 Image)
+{
+	FEntry Entry = {INDEX_NONE, nullptr};
+	if (m_Entries.RemoveAndCopyValue(Image, Entry))
+	{
+		m_LRU.RemoveNode(Entry.Node);
+		m_FreeSlots.Add(Entry.Slot);
+	}
+}
+
+void FSteamAvatarAtlas::AddReferencedObjects(FReferenceCollector& Collector)
+{
+	Collector.AddReferencedObjects(m_Pages);
+}
+
+int32 FSteamAvatarAtlas::AllocateSlot()
+{
+	if (m_FreeSlots.Num() == 0)
+	{
+		if (m_Pages.Num() < m_MaxPages)
+		{
+			AddPage();
+		}
+		else
+		{
+			// The slot is overwritten by the new avatar, anything still drawing the old one shows the new one from then on
+			Release(m_LRU.GetTail()->GetValue());
+		}
+	}
+
+	return m_FreeSlots.Pop(false);
+}
+
+void FSteamAvatarAtlas::AddPage()
+{
+	UTexture2D* const Page = UTexture2D::CreateTransient(m_PageSize, m_PageSize, PF_B8G8R8A8);
+	Page->PlatformData->SetNumSlices(1);
+	Page->NeverStream = true;
+
+	// Slots that haven't been filled yet are transparent
+	void* const MipData = Page->PlatformData->Mips[0].BulkData.Lock(LOCK_READ_WRITE);
+	FMemory::Memzero(MipData, m_PageSize * m_PageSize * 4);
+	Page->PlatformData->Mips[0].BulkData.Unlock();
+	Page->UpdateResource();
+
+	// Pushed in reverse so slots are handed out from the top left
+	const int32 SlotsPerPage = m_SlotsPerRow * m_SlotsPerRow;
+	const int32 FirstSlot = m_Pages.Add(Page) * SlotsPerPage;
+	for (int32 Slot = FirstSlot + SlotsPerPage - 1; Slot >= FirstSlot; Slot--)
+	{
+		m_FreeSlots.Add(Slot);
+	}
+}
+
+bool FSteamAvatarAtlas::Upload(int32 Image, int32 Slot)
+{
+	uint32 Width = 0, Height = 0;
+	SteamBridgeUtils()->GetImageSize(Image, &Width, &Height);
+	if (Width != (uint32)m_AvatarSize || Height != (uint32)m_AvatarSize)
+	{
+		return false;
+	}
+
+	// Owned by the render thread once queued, it's freed after the copy into the page
+	uint8* const Pixels = (uint8*)FMemory::Malloc(Width * Height * 4);
+	if (!SteamBridgeUtils()->GetImageRGBA(Image, Pixels, Width * Height * 4))
+	{
+		FMemory::Free(Pixels);
+		return false;
+	}
+	FSteamImageUtils::ConvertRGBAToBGRA(Pixels, Pixels, Width * Height);
+
+	const int32 SlotsPerPage = m_SlotsPerRow * m_SlotsPerRow;
+	const int32 Cell = Slot % SlotsPerPage;
+	FUpdateTextureRegion2D* const Region = new FUpdateTextureRegion2D((Cell % m_SlotsPerRow) * m_AvatarSize, (Cell / m_SlotsPerRow) * m_AvatarSize, 0, 0, Width, Height);
+
+	m_Pages[Slot / SlotsPerPage]->UpdateTextureRegions(0, 1, Region, Width * 4, 4, Pixels, [](uint8* SrcData, const FUpdateTextureRegion2D* Regions) {
+		FMemory::Free(SrcData);
+		delete Regions;
+	});
+	return true;
+}
+
+void FSteamAvatarAtlas::GetSlot(int32 Slot, UTexture2D*& Page, FBox2D& UV) const
+{
+	const int32 SlotsPerPage = m_SlotsPerRow * m_SlotsPerRow;
+	const int32 Cell = Slot % SlotsPerPage;
+	const FVector2D Min((Cell % m_SlotsPerRow) * m_AvatarSize + 0.5f, (Cell / m_SlotsPerRow) * m_AvatarSize + 0.5f);
+
+	Page = m_Pages[Slot / SlotsPerPage];
+	UV = FBox2D(Min / m_PageSize, (Min + FVector2D(m_AvatarSize - 1.0f, m_AvatarSize - 1.0f)) / m_PageSize);
+}
@@ -0,0 +1,136 @@
+// Copyright 2020 Russ 'trdwll' Treadwell <trdwll.com>. All Rights Reserved.
+
+#include "SteamAvatarCache.h"
+
+#include "Engine/Texture2D.h"
+#include "SteamBackend.h"
+#include "SteamBridgeTrace.h"
+#include "SteamImageUtils.h"
+
+UTexture2D* FSteamAvatarCache::Get(int32 Image, ESteamAvatarSize Size, int64 BudgetBytes, bool* bOutCreated)
+{
+	STEAMBRIDGE_TRACE_SCOPE(FSteamAvatarCache::Get);
+	const uint64 Key = MakeKey(Image, Size);
+	if (FEntry* const Entry = m_Entries.Find(Key))
+	{
+		Touch(*Entry);
+		return Entry->Texture;
+	}
+
+	UTexture2D* const Texture = CopyToTexture(Image);
+	if (Texture == nullptr)
+	{
+		return nullptr;
+	}
+
+	const int64 Bytes = (int64)Texture->GetSizeX() * Texture->GetSizeY() * 4;
+	m_LRU.AddHead(Key);
+	m_Entries.Add(Key, {Texture, Bytes, m_LRU.GetHead()});
+	m_Bytes += Bytes;
+
+	if (bOutCreated != nullptr)
+	{
+		*bOutCreated = true;
+	}
+
+	// The texture just created is kept even when it alone exceeds the budget, it's what the caller is about to show
+	EvictTo(FMath::Max(BudgetBytes, Bytes));
+
+	return Texture;
+}
+
+bool FSteamAvatarCache::Refresh(int32 Image, ESteamAvatarSize Size)
+{
+	FEntry* const Entry = m_Entries.Find(MakeKey(Image, Size));
+	if (Entry == nullptr)
+	{
+		return false;
+	}
+
+	STEAMBRIDGE_TRACE_SCOPE(FSteamAvatarCache::Refresh);
+	UTexture2D* const Texture = CopyToTexture(Image, Entry->Texture);
+	if (Texture != nullptr)
+	{
+		const int64 Bytes = (int64)Texture->GetSizeX() * Texture->GetSizeY() * 4;
+		m_Bytes += Bytes - Entry->Bytes;
+		Entry->Texture = Texture;
+		Entry->Bytes = Bytes;
+	}
+	return true;
+}
+
+void FSteamAvatarCache::Empty()
+{
+	m_Entries.Empty();
+	m_LRU.Empty();
+	m_Bytes = 0;
+}
+
+UTexture2D* FSteamAvatarCache::CopyToTexture(int32 Image, UTexture2D* Texture)
+{
+	// 0 is no avatar and -1 is still loading
+	if (Image <= 0)
+	{
+		return nullptr;
+	}
+
+	uint32 Width = 0, Height = 0;
+	SteamBridgeUtils()->GetImageSize(Image, &Width, &Height);
+	if (Width == 0 || Height == 0)
+	{
+		return nullptr;
+	}
+
+	if (Texture == nullptr || Texture->GetSizeX() != (int32)Width || Texture->GetSizeY() != (int32)Height)
+	{
+		Texture = UTexture2D::CreateTransient(Width, Height, PF_B8G8R8A8);
+		Texture->PlatformData->SetNumSlices(1);
+		Texture->NeverStream = true;
+	}
+
+	// Steam writes straight into the mip, then the channels are swapped in place since the texture is BGRA
+	uint8* const MipData = (uint8*)Texture->PlatformData->Mips[0].BulkData.Lock(LOCK_READ_WRITE);
+	const bool bCopied = SteamBridgeUtils()->GetImageRGBA(Image, MipData, Width * Height * 4);
+	if (bCopied)
+	{
+		FSteamImageUtils::ConvertRGBAToBGRA(MipData, MipData, Width * Height);
+	}
+	Texture->PlatformData->Mips[0].BulkData.Unlock();
+
+	if (!bCopied)
+	{
+		return nullptr;
+	}
+
+	Texture->UpdateResource();
+	return Texture;
+}
+
+void FSteamAvatarCache::AddReferencedObjects(FReferenceCollector& Collector)
+{
+	for (auto& Entry : m_Entries)
+	{
+		Collector.AddReferencedObject(Entry.Value.Texture);
+	}
+}
+
+void FSteamAvatarCache::Touch(FEntry& Entry)
+{
+	// Relinks the node rather than freeing it and allocating another, a hit doesn't allocate
+	if (Entry.Node != m_LRU.GetHead())
+	{
+		m_LRU.RemoveNode(Entry.Node, false);
+		m_LRU.AddHead(Entry.Node);
+	}
+}
+
+void FSteamAvatarCache::EvictTo(int64 BudgetBytes)
+{
+	while (m_Bytes > BudgetBytes && m_LRU.GetTail() != nullptr)
+	{
+		FEntry Entry = {nullptr, 0, nullptr};
+		m_Entries.RemoveAndCopyValue(m_LRU.GetTail()->GetValue(), Entry);
+		m_Bytes -= Entry.Bytes;
+		m_LRU.RemoveNode(m_LRU.GetTail());
+	}
+}
@@ -0,0 +1,311 @@
+// Copyright 2020 Russ 'trdwll' Treadwell <trdwll.com>. All Rights Reserved.
+
+#include "SteamAvatarDiskCache.h"
+
+#include "Async/Async.h"
+#include "Engine/Texture2D.h"
+#include "HAL/FileManager.h"
+#include "Misc/ScopeLock.h"
+#include "Misc/Compression.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "SteamBridgeTrace.h"
+
+static constexpr uint32 AvatarFileMagic = 0x53415641;  // "AVAS"
+static constexpr uint32 AvatarFileVersion = 1;
+
+/** The header at the start of each avatar file, followed by the compressed pixels. */
+struct FSteamAvatarFileHeader
+{
+	uint32 Magic = 0;
+	uint32 Version = 0;
+	int32 Width = 0;
+	int32 Height = 0;
+	uint32 Crc = 0;
+
+	friend FArchive& operator<<(FArchive& Ar, FSteamAvatarFileHeader& Header)
+	{
+		return Ar << Header.Magic << Header.Version << Header.Width << Header.Height << Header.Crc;
+	}
+
+	bool IsValid() const { return Magic == AvatarFileMagic && Version == AvatarFileVersion && Width > 0 && Height > 0 && Width <= 512 && Height <= 512; }
+};
+
+/**
+ * The avatars waiting to be written, drained by at most one worker at a time so two writes of the same file can never race or land out of order.
+ */
+struct FSteamAvatarDiskCache::FWriteQueue
+{
+	struct FPendingWrite
+	{
+		FSteamAvatarFileHeader Header;
+		TArray<uint8> Pixels;
+	};
+
+	FWriteQueue(const FString& InDirectory, int64 InBudgetBytes) : Directory(InDirectory), BudgetBytes(InBudgetBytes) {}
+
+	/** Adds the write, replacing one for the same file that hasn't started yet. Returns whether a worker has to be started to drain the queue. */
+	bool Add(FString&& Path, FPendingWrite&& Write)
+	{
+		FScopeLock ScopeLock(&Lock);
+		Pending.Add(MoveTemp(Path), MoveTemp(Write));
+		const bool bStartWorker = !bDraining;
+		bDraining = true;
+		return bStartWorker;
+	}
+
+	void Drain()
+	{
+		// The directory is only scanned by the worker, the first time it runs and whenever it's estimated to be over budget
+		if (DirectoryBytes < 0)
+		{
+			Prune();
+		}
+
+		for (;;)
+		{
+			FString Path;
+			FPendingWrite Write;
+			{
+				FScopeLock ScopeLock(&Lock);
+				auto It = Pending.CreateIterator();
+				if (!It)
+				{
+					bDraining = false;
+					return;
+				}
+
+				Path = It.Key();
+				Write = MoveTemp(It.Value());
+				It.RemoveCurrent();
+			}
+
+			WriteFile(Path, Write);
+
+			if (BudgetBytes > 0 && DirectoryBytes > BudgetBytes)
+			{
+				Prune();
+			}
+		}
+	}
+
+private:
+	void WriteFile(const FString& Path, const FPendingWrite& Write)
+	{
+		// What's on disk may already match even though it wasn't read this session
+		TArray<uint8> File;
+		if (FFileHelper::LoadFileToArray(File, *Path, FILEREAD_Silent))
+		{
+			FSteamAvatarFileHeader Existing;
+			FMemoryReader Reader(File);
+			Reader << Existing;
+			if (Existing.IsValid() && Existing.Crc == Write.Header.Crc)
+			{
+				return;
+			}
+		}
+
+		int32 CompressedSize = FCompression::CompressMemoryBound(NAME_Zlib, Write.Pixels.Num());
+		TArray<uint8> Compressed;
+		Compressed.SetNumUninitialized(CompressedSize);
+		if (!FCompression::CompressMemory(NAME_Zlib, Compressed.GetData(), CompressedSize, Write.Pixels.GetData(), Write.Pixels.Num()))
+		{
+			return;
+		}
+		Compressed.SetNum(CompressedSize, false);
+
+		const int64 ReplacedBytes = File.Num();
+		File.Reset();
+		FMemoryWriter Writer(File);
+		FSteamAvatarFileHeader Header = Write.Header;
+		Writer << Header << Compressed;
+
+		// Renamed over the old file once complete, so a reader never sees a partially written one
+		const FString TempPath = Path + TEXT(".tmp");
+		if (FFileHelper::SaveArrayToFile(File, *TempPath) && IFileManager::Get().Move(*Path, *TempPath, true, true))
+		{
+			DirectoryBytes += File.Num() - ReplacedBytes;
+		}
+		else
+		{
+			IFileManager::Get().Delete(*TempPath, false, false, true);
+		}
+	}
+
+	/** Deletes the least recently used files (Load touches them) until the directory is well under budget, so it isn't scanned again on the next write. */
+	void Prune()
+	{
+		struct FAvatarFile
+		{
+			FString Path;
+			int64 Bytes;
+			FDateTime ModificationTime;
+		};
+
+		TArray<FAvatarFile> Files;
+		TArray<FString> TempFiles;
+		DirectoryBytes = 0;
+		IFileManager::Get().IterateDirectoryStat(*Directory, [this, &Files, &TempFiles](const TCHAR* Path, const FFileStatData& Stat) {
+			if (!Stat.bIsDirectory)
+			{
+				if (FCString::Strstr(Path, TEXT(".avatar.tmp")) != nullptr)
+				{
+					TempFiles.Add(Path);
+				}
+				else
+				{
+					Files.Add({Path, Stat.FileSize, Stat.ModificationTime});
+					DirectoryBytes += Stat.FileSize;
+				}
+			}
+			return true;
+		});
+
+		// Left behind by writes that were interrupted
+		for (const FString& TempFile : TempFiles)
+		{
+			IFileManager::Get().Delete(*TempFile, false, false, true);
+		}
+
+		if (BudgetBytes <= 0 || DirectoryBytes <= BudgetBytes)
+		{
+			return;
+		}
+
+		Files.Sort([](const FAvatarFile& A, const FAvatarFile& B) { return A.ModificationTime < B.ModificationTime; });
+		for (int32 i = 0; i < Files.Num() && DirectoryBytes > BudgetBytes * 3 / 4; i++)
+		{
+			if (IFileManager::Get().Delete(*Files[i].Path, false, false, true))
+			{
+				DirectoryBytes -= Files[i].Bytes;
+			}
+		}
+	}
+
+	const FString Directory;
+	const int64 BudgetBytes;
+
+	FCriticalSection Lock;
+	/** By file path */
+	TMap<FString, FPendingWrite> Pending;
+	bool bDraining = false;
+
+	/** Size of the directory as of the last scan plus what's been written since, -1 until it's been scanned. Worker only */
+	int64 DirectoryBytes = -1;
+};
+
+FSteamAvatarDiskCache::FSteamAvatarDiskCache(const FString& Directory, int64 BudgetBytes) :
+	m_Directory(Directory),
+	m_WriteQueue(MakeShared<FWriteQueue, ESPMode::ThreadSafe>(Directory, BudgetBytes))
+{
+}
+
+FSteamAvatarDiskCache::~FSteamAvatarDiskCache()
+{
+}
+
+UTexture2D* FSteamAvatarDiskCache::Load(uint64 SteamID, ESteamAvatarSize Size)
+{
+	const FKey Key = {SteamID, Size};
+	if (UTexture2D* const* const Loaded = m_Loaded.Find(Key))
+	{
+		return *Loaded;
+	}
+
+	if (m_Missing.Contains(Key))
+	{
+		return nullptr;
+	}
+
+	STEAMBRIDGE_TRACE_SCOPE(FSteamAvatarDiskCache::Load);
+	TArray<uint8> File;
+	TArray<uint8> Compressed;
+	FSteamAvatarFileHeader Header;
+	if (FFileHelper::LoadFileToArray(File, *GetPath(Key), FILEREAD_Silent))
+	{
+		FMemoryReader Reader(File);
+		Reader << Header << Compressed;
+	}
+
+	if (!Header.IsValid())
+	{
+		m_Missing.Add(Key);
+		return nullptr;
+	}
+
+	// Marks the file as recently used, so it's among the last to be pruned
+	IFileManager::Get().SetTimeStamp(*GetPath(Key), FDateTime::UtcNow());
+
+	UTexture2D* const Texture = UTexture2D::CreateTransient(Header.Width, Header.Height, PF_B8G8R8A8);
+	Texture->PlatformData->SetNumSlices(1);
+	Texture->NeverStream = true;
+
+	void* const MipData = Texture->PlatformData->Mips[0].BulkData.Lock(LOCK_READ_WRITE);
+	const bool bUncompressed = FCompression::UncompressMemory(NAME_Zlib, MipData, Header.Width * Header.Height * 4, Compressed.GetData(), Compressed.Num());
+	Texture->PlatformData->Mips[0].BulkData.Unlock();
+
+	if (!bUncompressed)
+	{
+		m_Missing.Add(Key);
+		return nullptr;
+	}
+
+	Texture->UpdateResource();
+	m_Loaded.Add(Key, Texture);
+	m_StoredCrcs.Add(Key, Header.Crc);
+	return Texture;
+}
+
+void FSteamAvatarDiskCache::Store(uint64 SteamID, ESteamAvatarSize Size, UTexture2D* Texture)
+{
+	const FKey Key = {SteamID, Size};
+	m_Loaded.Remove(Key);
+	m_Missing.Remove(Key);
+
+	STEAMBRIDGE_TRACE_SCOPE(FSteamAvatarDiskCache::Store);
+	FSteamAvatarFileHeader Header;
+	Header.Magic = AvatarFileMagic;
+	Header.Version = AvatarFileVersion;
+	Header.Width = Texture->GetSizeX();
+	Header.Height = Texture->GetSizeY();
+
+	TArray<uint8> Pixels;
+	FByteBulkData& BulkData = Texture->PlatformData->Mips[0].BulkData;
+	const uint8* const MipData = (const uint8*)BulkData.LockReadOnly();
+	if (MipData != nullptr)
+	{
+		Header.Crc = FCrc::MemCrc32(MipData, Header.Width * Header.Height * 4);
+		if (m_StoredCrcs.FindRef(Key) != Header.Crc)
+		{
+			Pixels.Append(MipData, Header.Width * Header.Height * 4);
+		}
+	}
+	BulkData.Unlock();
+
+	if (Pixels.Num() == 0)
+	{
+		return;
+	}
+
+	m_StoredCrcs.Add(Key, Header.Crc);
+
+	if (m_WriteQueue->Add(GetPath(Key), {Header, MoveTemp(Pixels)}))
+	{
+		Async(EAsyncExecution::ThreadPool, [WriteQueue = m_WriteQueue]() { WriteQueue->Drain(); });
+	}
+}
+
+void FSteamAvatarDiskCache::AddReferencedObjects(FReferenceCollector& Collector)
+{
+	for (auto& Loaded : m_Loaded)
+	{
+		Collector.AddReferencedObject(Loaded.Value);
+	}
+}
+
+FString FSteamAvatarDiskCache::GetPath(const FKey& Key) const
+{
+	return FPaths::Combine(m_Directory, FString::Printf(TEXT("%llu_%d.avatar"), Key.SteamID, (int32)Key.Size));
+}
@@ -2,19 +2,31 @@
 
 #include "SteamBridge.h"
 
+#include "Backend/SteamStandInBackend.h"
+#include "Core/SteamFriends.h"
 #include "Developer/Settings/Public/ISettingsContainer.h"
 #include "Developer/Settings/Public/ISettingsModule.h"
 #include "Developer/Settings/Public/ISettingsSection.h"
 #include "HAL/FileManager.h"
 #include "HAL/PlatformProcess.h"
 #include "Interfaces/IPluginManager.h"
+#include "Misc/CommandLine.h"
+#include "Misc/ConfigCacheIni.h"
+#include "Misc/Parse.h"
 #include "Misc/Paths.h"
 #include "Modules/ModuleManager.h"
 #include "Steam.h"
+#include "SteamBackend.h"
 #include "SteamBridgeSettings.h"
+#include "SteamBridgeStats.h"
+#include "SteamCallbackDispatcher.h"
 
 #define LOCTEXT_NAMESPACE "FSteamBridgeModule"
 #define SDK_VER TEXT("Steamv147")
+
+DECLARE_CYCLE_STAT(TEXT("Tick"), STAT_SteamBridge_Tick, STATGROUP_SteamBridge);
+DECLARE_CYCLE_STAT(TEXT("SteamAPI_RunCallbacks"), STAT_SteamBridge_RunCallbacks, STATGROUP_SteamBridge);
+DECLARE_CYCLE_STAT(TEXT("SteamGameServer_RunCallbacks"), STAT_SteamBridge_RunGameServerCallbacks, STATGROUP_SteamBridge);
 void FSteamBridgeModule::StartupModule()
 {
 	RegisterSettings();
@@ -36,10 +48,23 @@ void FSteamBridgeModule::StartupModule()
 	SDKPath = FPaths::Combine(*SteamDir, "libsteam_api.so");
 	m_SteamLibSDKHandle = FPlatformProcess::GetDllHandle(*(SDKPath));
 #endif
+
+	StartBackend();
+	StartCallbackDispatch();
 }
 
 void FSteamBridgeModule::ShutdownModule()
 {
+	// Rich presence changes still waiting for their batch would otherwise never reach Steam
+	if (UObjectInitialized())
+	{
+		USteamFriends::GetSteamFriends()->FlushRichPresence();
+	}
+
+	FSteamCallbackDispatcher::Get().StopManualDispatch();
+	FSteamCallbackDispatcher::Get().CancelCallResults();
+	FSteamBackend::Reset();
+
 	if (UObjectInitialized())
 	{
 		SteamAPI_Shutdown();
@@ -56,12 +81,103 @@ void FSteamBridgeModule::ShutdownModule()
 
 bool FSteamBridgeModule::Tick(float DeltaTime)
 {
-	SteamAPI_RunCallbacks();
-	SteamGameServer_RunCallbacks();
+	SCOPE_CYCLE_COUNTER(STAT_SteamBridge_Tick);
+
+	FSteamCallbackDispatcher& Dispatcher = FSteamCallbackDispatcher::Get();
+	const double Now = FPlatformTime::Seconds();
+
+	// Before pumping, so callbacks for delegates bound since the last tick aren't missed
+	Dispatcher.UpdateLazyCallbacks();
+
+	ISteamBridgeBackend& Backend = FSteamBackend::Get();
+	Backend.Tick(Now);
+
+	if (Dispatcher.IsManualDispatch())
+	{
+		if (!Dispatcher.IsThreaded() && !Backend.IsStandIn())
+		{
+			Dispatcher.PumpPipe(Dispatcher.GetDuePipe(false, Now), false, Now);
+			Dispatcher.PumpPipe(Dispatcher.GetDuePipe(true, Now), true, Now);
+		}
+
+		// The core ticker runs at the start of the frame, so queued callbacks are always replayed before gameplay ticks
+		Dispatcher.DispatchQueued();
+	}
+	else
+	{
+		if (Dispatcher.GetDuePipe(false, Now) != 0)
+		{
+			SCOPE_CYCLE_COUNTER(STAT_SteamBridge_RunCallbacks);
+			Dispatcher.SchedulePump(false, Now);
+			SteamAPI_RunCallbacks();
+		}
+
+		if (Dispatcher.GetDuePipe(true, Now) != 0)
+		{
+			SCOPE_CYCLE_COUNTER(STAT_SteamBridge_RunGameServerCallbacks);
+			Dispatcher.SchedulePump(true, Now);
+			SteamGameServer_RunCallbacks();
+		}
+	}
+
+	Dispatcher.OnPostDispatch().Broadcast();
+	Dispatcher.ReleaseFinishedCallResults();
 
 	return true;
 }
 
+void FSteamBridgeModule::StartBackend()
+{
+	const TCHAR* const Section = TEXT("/Script/SteamBridge.SteamBridgeSettings");
+
+	bool bUseStandInBackend = FParse::Param(FCommandLine::Get(), TEXT("SteamBridgeStandIn"));
+	if (!bUseStandInBackend)
+	{
+		GConfig->GetBool(Section, TEXT("m_bUseStandInBackend"), bUseStandInBackend, GEngineIni);
+	}
+
+	if (bUseStandInBackend)
+	{
+		// The stand-in posts its callbacks straight to the dispatcher, so they're replayed like manually dispatched ones
+		FSteamBackend::Set(MakeUnique<FSteamStandInBackend>(FSteamStandInConfig::FromCommandLine(FCommandLine::Get())));
+		FSteamCallbackDispatcher::Get().StartStandInDispatch();
+	}
+}
+
+void FSteamBridgeModule::StartCallbackDispatch()
+{
+	// We load before CoreUObject so the settings object isn't available yet, read the values straight from the config instead
+	const TCHAR* const Section = TEXT("/Script/SteamBridge.SteamBridgeSettings");
+
+	FString PumpPolicy = TEXT("Both");
+	GConfig->GetString(Section, TEXT("m_CallbackPumpPolicy"), PumpPolicy, GEngineIni);
+
+	float ClientCallbackRateHz = 0.0f;
+	GConfig->GetFloat(Section, TEXT("m_ClientCallbackRateHz"), ClientCallbackRateHz, GEngineIni);
+
+	float ServerCallbackRateHz = 0.0f;
+	GConfig->GetFloat(Section, TEXT("m_ServerCallbackRateHz"), ServerCallbackRateHz, GEngineIni);
+
+	FSteamCallbackDispatcher::Get().SetPumpPolicy(PumpPolicy != TEXT("ServerOnly"), ClientCallbackRateHz, PumpPolicy != TEXT("ClientOnly"), ServerCallbackRateHz);
+
+	bool bUseCallbackThread = false;
+	GConfig->GetBool(Section, TEXT("m_bUseCallbackThread"), bUseCallbackThread, GEngineIni);
+
+	int32 CallbackBudgetMicroseconds = 0;
+	GConfig->GetInt(Section, TEXT("m_CallbackBudgetMicroseconds"), CallbackBudgetMicroseconds, GEngineIni);
+
+	// A budget can only carry callbacks over to the next frame if we own the queue, so it implies manual dispatch even without the thread
+	if (bUseCallbackThread || CallbackBudgetMicroseconds > 0)
+	{
+		int32 CallbackThreadIntervalMs = 10;
+		GConfig->GetInt(Section, TEXT("m_CallbackThreadIntervalMs"), CallbackThreadIntervalMs, GEngineIni);
+
+		FSteamCallbackDispatcher& Dispatcher = FSteamCallbackDispatcher::Get();
+		Dispatcher.SetDispatchBudget(CallbackBudgetMicroseconds);
+		Dispatcher.StartManualDispatch(bUseCallbackThread, CallbackThreadIntervalMs);
+	}
+}
+
 bool FSteamBridgeModule::HandleSettingsSaved()
 {
 #if WITH_EDITOR
@@ -0,0 +1,131 @@
+// Copyright 2020 Russ 'trdwll' Treadwell <trdwll.com>. All Rights Reserved.
+
+#include "CoreMinimal.h"
+
+#if !UE_BUILD_SHIPPING
+
+#include "Core/SteamFriends.h"
+#include "Core/SteamGameServer.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/MemoryBase.h"
+#include "SteamBackend.h"
+#include "SteamImageUtils.h"
+#include "SteamKeys.h"
+
+/**
+ * Allocator calls made so far by the whole process, which every GMalloc counts outside shipping builds.
+ * Nothing is swapped in, so other threads keep allocating safely, but whatever they allocate during a run is counted too.
+ */
+static uint64 GetSteamBenchmarkAllocations()
+{
+	return FMalloc::TotalMallocCalls.Load() + FMalloc::TotalReallocCalls.Load();
+}
+
+/** Keeps the benchmarked results alive so the calls can't be optimized away. */
+static volatile int64 GSteamBenchmarkSink = 0;
+
+/**
+ * Times Iterations calls of Func and counts the allocations they make.
+ *
+ * @param FOutputDevice & Ar
+ * @param const TCHAR * Name
+ * @param int32 Iterations
+ * @param TFunc && Func Returns something that can be added to the sink
+ * @return void
+ */
+template <class TFunc>
+static void RunSteamBenchmark(FOutputDevice& Ar, const TCHAR* Name, int32 Iterations, TFunc&& Func)
+{
+	// Warm up caches (and anything the wrapper lazily initializes) before measuring
+	for (int32 i = 0; i < FMath::Min(Iterations, 1000); i++)
+	{
+		GSteamBenchmarkSink += (int64)Func();
+	}
+
+	const uint64 StartAllocations = GetSteamBenchmarkAllocations();
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	for (int32 i = 0; i < Iterations; i++)
+	{
+		GSteamBenchmarkSink += (int64)Func();
+	}
+	const uint64 Cycles = FPlatformTime::Cycles64() - StartCycles;
+	const uint64 Allocations = GetSteamBenchmarkAllocations() - StartAllocations;
+
+	Ar.Logf(TEXT("  %-48s %10.1f ns/op %8.2f allocs/op"), Name, FPlatformTime::ToSeconds64(Cycles) * 1000000000.0 / Iterations, (double)Allocations / Iterations);
+}
+
+static void RunSteamBenchmarks(const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+{
+	const int32 Iterations = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 100000;
+
+	// The wrappers are measured against the stand-in so the numbers don't include Steam itself. It can't be swapped in here, the wrapper singletons
+	// would keep stand-in state (avatar handles, committed rich presence, cached clans and friends) once the real backend is back
+	if (!FSteamBackend::Get().IsStandIn())
+	{
+		Ar.Log(TEXT("SteamBridge.Benchmark runs against the stand-in backend only, launch with -SteamBridgeStandIn."));
+		return;
+	}
+
+	USteamFriends* const SteamFriends = USteamFriends::GetSteamFriends();
+	USteamGameServer* const SteamGameServer = USteamGameServer::GetSteamGameServer();
+
+	const TArray<ESteamFriendFlags> FriendFlags = {ESteamFriendFlags::Immediate};
+	const FSteamID Friend = SteamFriends->GetFriendByIndex(0, FriendFlags);
+	const FSteamID Clan = SteamFriends->GetClanByIndex(0);
+	const FSteamFriendQueryFields AllQueryFields = ESteamFriendQueryFields::PersonaName | ESteamFriendQueryFields::PersonaState | ESteamFriendQueryFields::Relationship |
+		ESteamFriendQueryFields::GamePlayed | ESteamFriendQueryFields::SteamLevel | ESteamFriendQueryFields::RichPresence;
+	FSteamFriendsQueryResult QueryResult;
+	TArray<FSteamID> FoundFriends;
+	const FString Key = TEXT("gamemode");
+	const FSteamKey KeyHandle = FSteamKeys::Intern(TEXT("gamemode"));
+	const FString Value = TEXT("capture_the_flag");
+	FString Message;
+	ESteamChatEntryType ChatEntryType;
+
+	Ar.Logf(TEXT("SteamBridge wrapper benchmarks, %d iterations:"), Iterations);
+	RunSteamBenchmark(Ar, TEXT("USteamFriends::GetFriendCount (array)"), Iterations, [&]() { return SteamFriends->GetFriendCount(FriendFlags); });
+	RunSteamBenchmark(Ar, TEXT("USteamFriends::GetFriendCount (flags)"), Iterations, [&]() { return SteamFriends->GetFriendCount(ESteamFriendFlags::Immediate); });
+	RunSteamBenchmark(Ar, TEXT("USteamFriends::QueryFriends (all fields)"), FMath::Max(Iterations / 100, 1), [&]() { return SteamFriends->QueryFriends(ESteamFriendFlags::Immediate, AllQueryFields, QueryResult); });
+	RunSteamBenchmark(Ar, TEXT("USteamFriends::GetFriendRichPresenceByKey (cached)"), Iterations, [&]() { return SteamFriends->GetFriendRichPresenceByKey(Friend, KeyHandle).Len(); });
+	RunSteamBenchmark(Ar, TEXT("USteamFriends::FindFriendsWithRichPresenceByKey"), FMath::Max(Iterations / 100, 1), [&]() { SteamFriends->FindFriendsWithRichPresenceByKey(KeyHandle, Value, FoundFriends); return FoundFriends.Num(); });
+	RunSteamBenchmark(Ar, TEXT("USteamFriends::GetFriendAvatar (cached)"), Iterations, [&]() { return SteamFriends->GetFriendAvatar(Friend, ESteamAvatarSize::Large) != nullptr; });
+	RunSteamBenchmark(Ar, TEXT("USteamFriends::GetFriendMessage (no message)"), Iterations, [&]() { return SteamFriends->GetFriendMessage(Friend, 0, Message, ChatEntryType); });
+	RunSteamBenchmark(Ar, TEXT("USteamFriends::GetClanName"), Iterations, [&]() { return SteamFriends->GetClanName(Clan).Len(); });
+	RunSteamBenchmark(Ar, TEXT("USteamFriends::GetClanCache().Find"), Iterations, [&]() { const FSteamClanInfo* const Info = SteamFriends->GetClanCache().Find(Clan); return Info != nullptr ? Info->Name.Len() : 0; });
+	RunSteamBenchmark(Ar, TEXT("USteamFriends::ActivateGameOverlay"), Iterations, [&]() { SteamFriends->ActivateGameOverlay(ESteamGameOverlayTypes::Friends); return 0; });
+	RunSteamBenchmark(Ar, TEXT("USteamFriends::ActivateGameOverlayToUser"), Iterations, [&]() { SteamFriends->ActivateGameOverlayToUser(ESteamGameUserOverlayTypes::SteamID, Friend); return 0; });
+	RunSteamBenchmark(Ar, TEXT("USteamFriends::SetRichPresenceByKey (unchanged)"), Iterations, [&]() { return SteamFriends->SetRichPresenceByKey(KeyHandle, Value); });
+	RunSteamBenchmark(Ar, TEXT("USteamFriends::SetRichPresenceByKey + FlushRichPresence"), Iterations, [&]() {
+		SteamFriends->SetRichPresenceByKey(KeyHandle, (GSteamBenchmarkSink & 1) != 0 ? Key : Value);
+		SteamFriends->FlushRichPresence();
+		return 1;
+	});
+	RunSteamBenchmark(Ar, TEXT("USteamGameServer::SetKeyValue"), Iterations, [&]() { SteamGameServer->SetKeyValue(Key, Value); return 0; });
+	RunSteamBenchmark(Ar, TEXT("USteamGameServer::SetKeyValueByKey"), Iterations, [&]() { SteamGameServer->SetKeyValueByKey(KeyHandle, Value); return 0; });
+
+	// A large avatar, comparing the byte loop GetFriendAvatar used to run against the vectorized kernel
+	TArray<uint8> Pixels;
+	Pixels.SetNumUninitialized(184 * 184 * 4);
+	for (int32 i = 0; i < Pixels.Num(); i++)
+	{
+		Pixels[i] = (uint8)i;
+	}
+
+	RunSteamBenchmark(Ar, TEXT("RGBA to BGRA byte loop (184x184)"), FMath::Max(Iterations / 10, 1), [&]() {
+		for (int32 i = 0; i < Pixels.Num(); i += 4)
+		{
+			const uint8 Temp = Pixels[i + 0];
+			Pixels[i + 0] = Pixels[i + 2];
+			Pixels[i + 2] = Temp;
+		}
+		return Pixels[0];
+	});
+	RunSteamBenchmark(Ar, TEXT("FSteamImageUtils::ConvertRGBAToBGRAScalar (184x184)"), FMath::Max(Iterations / 10, 1), [&]() { FSteamImageUtils::ConvertRGBAToBGRAScalar(Pixels.GetData(), Pixels.GetData(), 184 * 184); return Pixels[0]; });
+	RunSteamBenchmark(Ar, TEXT("FSteamImageUtils::ConvertRGBAToBGRA (184x184)"), FMath::Max(Iterations / 10, 1), [&]() { FSteamImageUtils::ConvertRGBAToBGRA(Pixels.GetData(), Pixels.GetData(), 184 * 184); return Pixels[0]; });
+}
+
+static FAutoConsoleCommandWithWorldArgsAndOutputDevice GSteamBridgeBenchmarkCommand(TEXT("SteamBridge.Benchmark"),
+	TEXT("Measures the per call cost (ns/op and allocs/op) of hot SteamBridge wrappers against the stand-in backend (-SteamBridgeStandIn). allocs/op counts the whole process. Optionally takes the iteration count."),
+	FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateStatic(&RunSteamBenchmarks));
+
+#endif  // !UE_BUILD_SHIPPING
@@ -0,0 +1,66 @@
+// Copyright 2020 Russ 'trdwll' Treadwell <trdwll.com>. All Rights Reserved.
+
+#include "SteamBridgeStats.h"
+
+#include "HAL/IConsoleManager.h"
+
+DEFINE_STAT(STAT_SteamBridge_HandledCallbacks);
+
+int32 FSteamCallbackProfile::GetLatencyBucket(double Seconds)
+{
+	const uint32 Microseconds = (uint32)FMath::Min(Seconds * 1000000.0, (double)MAX_uint32);
+	return Microseconds < 8 ? 0 : FMath::Min((int32)FMath::FloorLog2(Microseconds >> 3) + 1, NumLatencyBuckets - 1);
+}
+
+FSteamCallbackStats& FSteamCallbackStats::Get()
+{
+	static FSteamCallbackStats Stats;
+	return Stats;
+}
+
+void FSteamCallbackStats::Record(int32 CallbackID, const TCHAR* Name, double Seconds)
+{
+	FSteamCallbackProfile& Profile = m_Profiles.FindOrAdd(CallbackID);
+	Profile.Name = Name;
+	Profile.Invocations++;
+	Profile.TotalSeconds += Seconds;
+	Profile.MaxSeconds = FMath::Max(Profile.MaxSeconds, Seconds);
+	Profile.LatencyBuckets[FSteamCallbackProfile::GetLatencyBucket(Seconds)]++;
+}
+
+void FSteamCallbackStats::Dump(FOutputDevice& Ar) const
+{
+	TArray<int32> CallbackIDs;
+	m_Profiles.GetKeys(CallbackIDs);
+	CallbackIDs.Sort([this](int32 A, int32 B) { return m_Profiles[A].TotalSeconds > m_Profiles[B].TotalSeconds; });
+
+	Ar.Logf(TEXT("SteamBridge callback handlers (%d types), sorted by total time:"), CallbackIDs.Num());
+	for (const int32 CallbackID : CallbackIDs)
+	{
+		const FSteamCallbackProfile& Profile = m_Profiles[CallbackID];
+
+		FString Histogram;
+		for (int32 i = 0; i < FSteamCallbackProfile::NumLatencyBuckets; i++)
+		{
+			if (Profile.LatencyBuckets[i] > 0)
+			{
+				const bool bLast = i == FSteamCallbackProfile::NumLatencyBuckets - 1;
+				Histogram += FString::Printf(TEXT(" %s%uus:%u"), bLast ? TEXT(">=") : TEXT("<"), bLast ? 4u << i : 8u << i, Profile.LatencyBuckets[i]);
+			}
+		}
+
+		Ar.Logf(TEXT("  %s (%d): %llu calls, %.3fms total, %.1fus avg, %.1fus max |%s"), Profile.Name, CallbackID, Profile.Invocations, Profile.TotalSeconds * 1000.0,
+			Profile.TotalSeconds * 1000000.0 / FMath::Max<uint64>(Profile.Invocations, 1), Profile.MaxSeconds * 1000000.0, *Histogram);
+	}
+}
+
+static FAutoConsoleCommandWithWorldArgsAndOutputDevice GSteamBridgeCallbackStatsCommand(TEXT("SteamBridge.CallbackStats"),
+	TEXT("Prints invocation counts and latency histograms of the SteamBridge callback handlers. Pass 'reset' to clear them."),
+	FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar) {
+		if (Args.Num() > 0 && Args[0] == TEXT("reset"))
+		{
+			FSteamCallbackStats::Get().Reset();
+			return;
+		}
+		FSteamCallbackStats::Get().Dump(Ar);
+	}));
@@ -0,0 +1,39 @@
+// Copyright 2020 Russ 'trdwll' Treadwell <trdwll.com>. All Rights Reserved.
+
+#include "SteamBridgeTrace.h"
+
+#include "Steam.h"
+
+UE_TRACE_CHANNEL_DEFINE(SteamBridgeChannel);
+
+UE_TRACE_EVENT_BEGIN(SteamBridge, APICallIssued)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint64, APICall)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(SteamBridge, APICallCompleted)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint64, APICall)
+	UE_TRACE_EVENT_FIELD(int32, CallbackID)
+	UE_TRACE_EVENT_FIELD(bool, IOFailure)
+UE_TRACE_EVENT_END()
+
+SteamAPICall_t FSteamBridgeTrace::APICallIssued(SteamAPICall_t APICall)
+{
+	if (APICall != k_uAPICallInvalid)
+	{
+		UE_TRACE_LOG(SteamBridge, APICallIssued, SteamBridgeChannel)
+			<< APICallIssued.Cycle(FPlatformTime::Cycles64())
+			<< APICallIssued.APICall(APICall);
+	}
+	return APICall;
+}
+
+void FSteamBridgeTrace::APICallCompleted(SteamAPICall_t APICall, int32 CallbackID, bool bIOFailure)
+{
+	UE_TRACE_LOG(SteamBridge, APICallCompleted, SteamBridgeChannel)
+		<< APICallCompleted.Cycle(FPlatformTime::Cycles64())
+		<< APICallCompleted.APICall(APICall)
+		<< APICallCompleted.CallbackID(CallbackID)
+		<< APICallCompleted.IOFailure(bIOFailure);
+}
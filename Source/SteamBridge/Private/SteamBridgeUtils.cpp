@@ -3,6 +3,8 @@
 
 #include "SteamBridgeUtils.h"
 
+#include "SteamKeys.h"
+
 void USteamBridgeUtils::ConvertIPStringToUint32(const FString& IP, uint32& OutIP)
 {
 	TArray<FString> ParsedIP;
@@ -23,3 +25,8 @@ FString USteamBridgeUtils::GetSteamIDAsString(const FSteamID& SteamID) const
 {
 	return FString::Printf(TEXT("%llu"), SteamID.Value);
 }
+
+FSteamKey USteamBridgeUtils::MakeSteamKey(const FString& Key)
+{
+	return FSteamKeys::Intern(*Key);
+}
@@ -0,0 +1,443 @@
+// Copyright 2020 Russ 'trdwll' Treadwell <trdwll.com>. All Rights Reserved.
+
+#include "SteamCallbackDispatcher.h"
+
+#include "SteamBridgeStats.h"
+#include "SteamBridgeTrace.h"
+#include "SteamCallResult.h"
+#include "SteamCallbackPump.h"
+
+DEFINE_STAT(STAT_SteamBridge_QueueDepth);
+DEFINE_STAT(STAT_SteamBridge_DispatchedCallbacks);
+DEFINE_STAT(STAT_SteamBridge_DeferredCallbacks);
+
+DECLARE_CYCLE_STAT(TEXT("PumpPipe"), STAT_SteamBridge_PumpPipe, STATGROUP_SteamBridge);
+DECLARE_CYCLE_STAT(TEXT("DispatchQueued"), STAT_SteamBridge_DispatchQueued, STATGROUP_SteamBridge);
+
+FSteamCallbackDispatcher& FSteamCallbackDispatcher::Get()
+{
+	static FSteamCallbackDispatcher Dispatcher;
+	return Dispatcher;
+}
+
+FSteamCallbackDispatcher::FSteamCallbackDispatcher() :
+	m_DispatchBudgetSeconds(0.0),
+	m_TotalDeferredCallbacks(0),
+	m_bManualDispatch(false)
+{
+	FMemory::Memzero(m_CarriedOverCallbacks);
+}
+
+FSteamCallbackDispatcher::~FSteamCallbackDispatcher()
+{
+	StopManualDispatch();
+}
+
+void FSteamCallbackDispatcher::StartManualDispatch(bool bUseThread, int32 PumpIntervalMs)
+{
+	if (m_bManualDispatch)
+	{
+		return;
+	}
+
+	SteamAPI_ManualDispatch_Init();
+	m_bManualDispatch = true;
+
+	if (bUseThread)
+	{
+		m_Pump = MakeUnique<FSteamCallbackPump>(*this, PumpIntervalMs);
+	}
+}
+
+void FSteamCallbackDispatcher::StopManualDispatch()
+{
+	// Joins the pump thread before Steam is shut down underneath it
+	m_Pump.Reset();
+	m_bManualDispatch = false;
+}
+
+void FSteamCallbackDispatcher::StartStandInDispatch()
+{
+	check(!m_bManualDispatch);
+	m_bManualDispatch = true;
+}
+
+void FSteamCallbackDispatcher::PumpPipe(HSteamPipe SteamPipe, bool bGameServer, double Now)
+{
+	if (SteamPipe == 0)
+	{
+		return;
+	}
+
+	// Pumping the pipe again would free the buffers its still queued HTML surface callbacks point into, the other pipe is unaffected
+	FThreadSafeCounter& PendingTransientCallbacks = m_PendingTransientCallbacks[bGameServer ? 1 : 0];
+	if (PendingTransientCallbacks.GetValue() > 0)
+	{
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_SteamBridge_PumpPipe);
+
+	SchedulePump(bGameServer, Now);
+	SteamAPI_ManualDispatch_RunFrame(SteamPipe);
+
+	CallbackMsg_t Message;
+	while (SteamAPI_ManualDispatch_GetNextCallback(SteamPipe, &Message))
+	{
+		FSteamQueuedCallback Queued;
+		Queued.bGameServer = bGameServer;
+
+		if (Message.m_iCallback == SteamAPICallCompleted_t::k_iCallback)
+		{
+			const SteamAPICallCompleted_t* const CallCompleted = (SteamAPICallCompleted_t*)Message.m_pubParam;
+			Queued.CallbackID = CallCompleted->m_iCallback;
+			Queued.APICall = CallCompleted->m_hAsyncCall;
+			Queued.Payload.SetNumZeroed(CallCompleted->m_cubParam);
+
+			bool bFailed = false;
+			if (SteamAPI_ManualDispatch_GetAPICallResult(SteamPipe, CallCompleted->m_hAsyncCall, Queued.Payload.GetData(), Queued.Payload.Num(), CallCompleted->m_iCallback, &bFailed))
+			{
+				Queued.bIOFailure = bFailed;
+				FSteamBridgeTrace::APICallCompleted(Queued.APICall, Queued.CallbackID, bFailed);
+				Enqueue(MoveTemp(Queued));
+			}
+		}
+		else
+		{
+			Queued.CallbackID = Message.m_iCallback;
+			Queued.Payload.Append(Message.m_pubParam, Message.m_cubParam);
+
+			if (HasTransientPayload(Queued.CallbackID))
+			{
+				PendingTransientCallbacks.Increment();
+			}
+
+			Enqueue(MoveTemp(Queued));
+		}
+
+		SteamAPI_ManualDispatch_FreeLastCallback(SteamPipe);
+	}
+}
+
+void FSteamCallbackDispatcher::Post(FSteamQueuedCallback&& Queued)
+{
+	if (Queued.APICall != k_uAPICallInvalid)
+	{
+		FSteamBridgeTrace::APICallCompleted(Queued.APICall, Queued.CallbackID, Queued.bIOFailure);
+	}
+
+	Enqueue(MoveTemp(Queued));
+}
+
+void FSteamCallbackDispatcher::DispatchQueued()
+{
+	check(IsInGameThread());
+	SCOPE_CYCLE_COUNTER(STAT_SteamBridge_DispatchQueued);
+
+	const bool bBudgeted = m_DispatchBudgetSeconds > 0.0;
+	const double Deadline = FPlatformTime::Seconds() + m_DispatchBudgetSeconds;
+
+	int32 NewlyDeferred = 0;
+
+	for (int32 Priority = 0; Priority < (int32)ESteamCallbackPriority::Count; Priority++)
+	{
+		const bool bDeferrable = bBudgeted && Priority != (int32)ESteamCallbackPriority::High;
+
+		int32 Dispatched = 0;
+
+		FSteamQueuedCallback Queued;
+		while (m_Queues[Priority].Dequeue(Queued))
+		{
+			m_QueueDepth[Priority].Decrement();
+			Dispatch(Queued);
+			Dispatched++;
+			INC_DWORD_STAT(STAT_SteamBridge_DispatchedCallbacks);
+
+			if (Queued.APICall == k_uAPICallInvalid && HasTransientPayload(Queued.CallbackID))
+			{
+				m_PendingTransientCallbacks[Queued.bGameServer ? 1 : 0].Decrement();
+			}
+
+			// Checked after dispatching so every priority makes progress each frame, even once the budget is spent.
+			// HTML surface callbacks are never carried over, their payloads don't outlive the frame they arrived in
+			if (bDeferrable && !HasPendingTransientCallbacks() && FPlatformTime::Seconds() >= Deadline)
+			{
+				break;
+			}
+		}
+
+		// The queue is FIFO, so whatever was carried over last frame and is still queued sits at its front and was already counted
+		const int32 Remaining = m_QueueDepth[Priority].GetValue();
+		const int32 StillCarriedOver = FMath::Max(m_CarriedOverCallbacks[Priority] - Dispatched, 0);
+		NewlyDeferred += FMath::Max(Remaining - StillCarriedOver, 0);
+		m_CarriedOverCallbacks[Priority] = Remaining;
+	}
+
+	m_TotalDeferredCallbacks += NewlyDeferred;
+
+	SET_DWORD_STAT(STAT_SteamBridge_QueueDepth, GetQueueDepth());
+	INC_DWORD_STAT_BY(STAT_SteamBridge_DeferredCallbacks, NewlyDeferred);
+}
+
+int32 FSteamCallbackDispatcher::GetQueueDepth() const
+{
+	int32 Depth = 0;
+	for (int32 Priority = 0; Priority < (int32)ESteamCallbackPriority::Count; Priority++)
+	{
+		Depth += m_QueueDepth[Priority].GetValue();
+	}
+	return Depth;
+}
+
+ESteamCallbackPriority FSteamCallbackDispatcher::GetCallbackPriority(int32 CallbackID)
+{
+	switch (CallbackID)
+	{
+	case SteamServersConnected_t::k_iCallback:
+	case SteamServerConnectFailure_t::k_iCallback:
+	case SteamServersDisconnected_t::k_iCallback:
+	case IPCFailure_t::k_iCallback:
+	case ValidateAuthTicketResponse_t::k_iCallback:
+	case GetAuthSessionTicketResponse_t::k_iCallback:
+	case EncryptedAppTicketResponse_t::k_iCallback:
+	case MicroTxnAuthorizationResponse_t::k_iCallback:
+		return ESteamCallbackPriority::High;
+	case PersonaStateChange_t::k_iCallback:
+	case AvatarImageLoaded_t::k_iCallback:
+	case FriendRichPresenceUpdate_t::k_iCallback:
+		return ESteamCallbackPriority::Low;
+	default: break;
+	}
+
+	if ((CallbackID >= k_iSteamGameServerCallbacks && CallbackID < k_iSteamGameServerCallbacks + 100) ||
+		(CallbackID >= k_iSteamGameServerStatsCallbacks && CallbackID < k_iSteamGameServerStatsCallbacks + 100))
+	{
+		return ESteamCallbackPriority::High;
+	}
+
+	if (HasTransientPayload(CallbackID))
+	{
+		return ESteamCallbackPriority::Low;
+	}
+
+	return ESteamCallbackPriority::Normal;
+}
+
+void FSteamCallbackDispatcher::SetPumpPolicy(bool bPumpClient, float ClientRateHz, bool bPumpServer, float ServerRateHz)
+{
+	m_PipeSchedules[0].bEnabled = bPumpClient;
+	m_PipeSchedules[0].IntervalSeconds = ClientRateHz > 0.0f ? 1.0 / ClientRateHz : 0.0;
+	m_PipeSchedules[1].bEnabled = bPumpServer;
+	m_PipeSchedules[1].IntervalSeconds = ServerRateHz > 0.0f ? 1.0 / ServerRateHz : 0.0;
+}
+
+HSteamPipe FSteamCallbackDispatcher::GetDuePipe(bool bGameServer, double Now) const
+{
+	const FSteamPipeSchedule& Schedule = m_PipeSchedules[bGameServer ? 1 : 0];
+	if (!Schedule.bEnabled || Now < Schedule.NextPumpTime)
+	{
+		return 0;
+	}
+
+	return bGameServer ? SteamGameServer_GetHSteamPipe() : SteamAPI_GetHSteamPipe();
+}
+
+void FSteamCallbackDispatcher::SchedulePump(bool bGameServer, double Now)
+{
+	FSteamPipeSchedule& Schedule = m_PipeSchedules[bGameServer ? 1 : 0];
+
+	// Stay on a fixed cadence, but don't try to catch up on pumps missed while stalled
+	Schedule.NextPumpTime += Schedule.IntervalSeconds;
+	if (Schedule.NextPumpTime < Now)
+	{
+		Schedule.NextPumpTime = Now + Schedule.IntervalSeconds;
+	}
+}
+
+double FSteamCallbackDispatcher::GetSecondsUntilNextPump(double Now) const
+{
+	double SecondsUntilNextPump = DBL_MAX;
+	for (int32 i = 0; i < (int32)UE_ARRAY_COUNT(m_PipeSchedules); i++)
+	{
+		// A pipe held back by queued HTML surface callbacks stays due, so don't spin on it until the game thread catches up
+		const FSteamPipeSchedule& Schedule = m_PipeSchedules[i];
+		if (Schedule.bEnabled && Schedule.IntervalSeconds > 0.0 && m_PendingTransientCallbacks[i].GetValue() == 0)
+		{
+			SecondsUntilNextPump = FMath::Min(SecondsUntilNextPump, FMath::Max(Schedule.NextPumpTime - Now, 0.0));
+		}
+	}
+	return SecondsUntilNextPump;
+}
+
+void FSteamCallbackDispatcher::AddCallback(CCallbackBase* Callback, int32 CallbackID, bool bGameServer)
+{
+	(bGameServer ? m_GameServerCallbacks : m_ClientCallbacks).FindOrAdd(CallbackID).AddUnique(Callback);
+}
+
+void FSteamCallbackDispatcher::RemoveCallback(CCallbackBase* Callback, int32 CallbackID, bool bGameServer)
+{
+	TMap<int32, TArray<CCallbackBase*, TInlineAllocator<2>>>& Callbacks = bGameServer ? m_GameServerCallbacks : m_ClientCallbacks;
+	if (TArray<CCallbackBase*, TInlineAllocator<2>>* const Handlers = Callbacks.Find(CallbackID))
+	{
+		Handlers->Remove(Callback);
+		if (Handlers->Num() == 0)
+		{
+			Callbacks.Remove(CallbackID);
+		}
+	}
+}
+
+void FSteamCallbackDispatcher::AddLazyCallback(CCallbackBase* Callback, const FMulticastScriptDelegate& Delegate, TFunction<void(bool)>&& SetRegistered)
+{
+	FLazyCallback& Lazy = m_LazyCallbacks.AddDefaulted_GetRef();
+	Lazy.Callback = Callback;
+	Lazy.Delegates.Add(&Delegate);
+	Lazy.SetRegistered = MoveTemp(SetRegistered);
+	Lazy.RetainCount = 0;
+	Lazy.bRegistered = false;
+}
+
+void FSteamCallbackDispatcher::RemoveLazyCallback(CCallbackBase* Callback)
+{
+	m_LazyCallbacks.RemoveAllSwap([Callback](const FLazyCallback& Lazy) { return Lazy.Callback == Callback; });
+}
+
+void FSteamCallbackDispatcher::AddLazyTrigger(CCallbackBase& Callback, const FMulticastScriptDelegate& Delegate)
+{
+	for (FLazyCallback& Lazy : m_LazyCallbacks)
+	{
+		if (Lazy.Callback == &Callback)
+		{
+			Lazy.Delegates.AddUnique(&Delegate);
+			return;
+		}
+	}
+}
+
+void FSteamCallbackDispatcher::Retain(const CCallbackBase& Callback)
+{
+	for (FLazyCallback& Lazy : m_LazyCallbacks)
+	{
+		if (Lazy.Callback == &Callback)
+		{
+			if (Lazy.RetainCount++ == 0 && !Lazy.bRegistered)
+			{
+				Lazy.SetRegistered(true);
+				Lazy.bRegistered = true;
+			}
+			return;
+		}
+	}
+}
+
+void FSteamCallbackDispatcher::Release(const CCallbackBase& Callback)
+{
+	for (FLazyCallback& Lazy : m_LazyCallbacks)
+	{
+		if (Lazy.Callback == &Callback)
+		{
+			// Unregistered on the next update if nothing is bound either
+			Lazy.RetainCount = FMath::Max(Lazy.RetainCount - 1, 0);
+			return;
+		}
+	}
+}
+
+void FSteamCallbackDispatcher::UpdateLazyCallbacks()
+{
+	check(IsInGameThread());
+
+	for (FLazyCallback& Lazy : m_LazyCallbacks)
+	{
+		bool bWanted = Lazy.RetainCount > 0;
+		for (int32 i = 0; !bWanted && i < Lazy.Delegates.Num(); i++)
+		{
+			bWanted = Lazy.Delegates[i]->IsBound();
+		}
+
+		if (bWanted != Lazy.bRegistered)
+		{
+			Lazy.SetRegistered(bWanted);
+			Lazy.bRegistered = bWanted;
+		}
+	}
+}
+
+void FSteamCallbackDispatcher::AddCallResult(SteamAPICall_t APICall, TUniquePtr<FSteamPendingCallResult>&& Pending)
+{
+	check(IsInGameThread());
+	m_CallResults.Add(APICall, MoveTemp(Pending));
+}
+
+void FSteamCallbackDispatcher::FinishCallResult(SteamAPICall_t APICall)
+{
+	TUniquePtr<FSteamPendingCallResult> Pending;
+	if (m_CallResults.RemoveAndCopyValue(APICall, Pending))
+	{
+		m_FinishedCallResults.Add(MoveTemp(Pending));
+	}
+}
+
+void FSteamCallbackDispatcher::ReleaseFinishedCallResults()
+{
+	m_FinishedCallResults.Reset();
+}
+
+void FSteamCallbackDispatcher::CancelCallResults()
+{
+	TMap<SteamAPICall_t, TUniquePtr<FSteamPendingCallResult>> Pending = MoveTemp(m_CallResults);
+	m_CallResults.Reset();
+
+	for (TPair<SteamAPICall_t, TUniquePtr<FSteamPendingCallResult>>& Pair : Pending)
+	{
+		Pair.Value->Fail();
+	}
+
+	ReleaseFinishedCallResults();
+}
+
+void FSteamCallbackDispatcher::Enqueue(FSteamQueuedCallback&& Queued)
+{
+	const int32 Priority = (int32)GetCallbackPriority(Queued.CallbackID);
+	m_Queues[Priority].Enqueue(MoveTemp(Queued));
+	m_QueueDepth[Priority].Increment();
+}
+
+void FSteamCallbackDispatcher::Dispatch(FSteamQueuedCallback& Queued)
+{
+	if (Queued.APICall != k_uAPICallInvalid)
+	{
+		if (const TUniquePtr<FSteamPendingCallResult>* const Pending = m_CallResults.Find(Queued.APICall))
+		{
+			(*Pending)->Complete(Queued.Payload.GetData(), Queued.bIOFailure);
+		}
+	}
+
+	const TMap<int32, TArray<CCallbackBase*, TInlineAllocator<2>>>& Callbacks = Queued.bGameServer ? m_GameServerCallbacks : m_ClientCallbacks;
+	const TArray<CCallbackBase*, TInlineAllocator<2>>* const Registered = Callbacks.Find(Queued.CallbackID);
+	if (Registered == nullptr)
+	{
+		return;
+	}
+
+	// A handler (or a continuation it fulfils) may Retain or unregister callbacks, which can rehash the map or reallocate the list being dispatched
+	const TArray<CCallbackBase*, TInlineAllocator<4>> Handlers(*Registered);
+	for (CCallbackBase* const Handler : Handlers)
+	{
+		// Unregistered by an earlier handler, it may not even exist anymore
+		const TArray<CCallbackBase*, TInlineAllocator<2>>* const Current = Callbacks.Find(Queued.CallbackID);
+		if (Current == nullptr || !Current->Contains(Handler))
+		{
+			continue;
+		}
+
+		if (Queued.APICall == k_uAPICallInvalid)
+		{
+			Handler->Run(Queued.Payload.GetData());
+		}
+		else
+		{
+			Handler->Run(Queued.Payload.GetData(), Queued.bIOFailure, Queued.APICall);
+		}
+	}
+}
@@ -0,0 +1,45 @@
+// Copyright 2020 Russ 'trdwll' Treadwell <trdwll.com>. All Rights Reserved.
+
+#include "SteamCallbackPump.h"
+
+#include "HAL/PlatformProcess.h"
+#include "HAL/RunnableThread.h"
+#include "SteamCallbackDispatcher.h"
+
+FSteamCallbackPump::FSteamCallbackPump(FSteamCallbackDispatcher& Dispatcher, int32 PumpIntervalMs) :
+	m_Dispatcher(Dispatcher),
+	m_PumpIntervalSeconds(FMath::Max(PumpIntervalMs, 1) / 1000.0f),
+	m_bStopping(false)
+{
+	m_Thread = FRunnableThread::Create(this, TEXT("SteamBridgeCallbackPump"), 0, TPri_AboveNormal);
+}
+
+FSteamCallbackPump::~FSteamCallbackPump()
+{
+	if (m_Thread != nullptr)
+	{
+		m_Thread->Kill(true);
+		delete m_Thread;
+		m_Thread = nullptr;
+	}
+}
+
+uint32 FSteamCallbackPump::Run()
+{
+	while (!m_bStopping)
+	{
+		const double Now = FPlatformTime::Seconds();
+		m_Dispatcher.PumpPipe(m_Dispatcher.GetDuePipe(false, Now), false, Now);
+		m_Dispatcher.PumpPipe(m_Dispatcher.GetDuePipe(true, Now), true, Now);
+
+		// Wake up for the next rate limited pipe, pipes without a rate are pumped every interval
+		FPlatformProcess::Sleep((float)FMath::Min<double>(m_PumpIntervalSeconds, m_Dispatcher.GetSecondsUntilNextPump(FPlatformTime::Seconds())));
+	}
+
+	return 0;
+}
+
+void FSteamCallbackPump::Stop()
+{
+	m_bStopping = true;
+}
@@ -0,0 +1,32 @@
+// Copyright 2020 Russ 'trdwll' Treadwell <trdwll.com>. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include "HAL/ThreadSafeBool.h"
+
+class FRunnableThread;
+class FSteamCallbackDispatcher;
+
+/**
+ * Drains the client and game server Steam pipes on its own thread so callback latency no longer depends on the game thread frame rate.
+ */
+class FSteamCallbackPump final : public FRunnable
+{
+public:
+	FSteamCallbackPump(FSteamCallbackDispatcher& Dispatcher, int32 PumpIntervalMs);
+	virtual ~FSteamCallbackPump();
+
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+
+private:
+	FSteamCallbackDispatcher& m_Dispatcher;
+
+	float m_PumpIntervalSeconds;
+
+	FThreadSafeBool m_bStopping;
+
+	FRunnableThread* m_Thread;
+};
@@ -0,0 +1,64 @@
+// Copyright 2020 Russ 'trdwll' Treadwell <trdwll.com>. All Rights Reserved.
+
+#include "SteamChatHistory.h"
+
+void FSteamChatHistory::Add(uint64 ChatID, int32 MessageID, uint64 Sender, ESteamChatEntryType ChatEntryType, const ANSICHAR* Text)
+{
+	FRing* Ring = m_Chats.Find(ChatID);
+	if (Ring == nullptr)
+	{
+		if (m_Capacity == 0)
+		{
+			return;
+		}
+
+		Ring = &m_Chats.Add(ChatID);
+		Ring->Capacity = m_Capacity;
+	}
+
+	FSteamChatMessage* Message = nullptr;
+	if (Ring->Messages.Num() < Ring->Capacity)
+	{
+		Message = &Ring->Messages.AddDefaulted_GetRef();
+	}
+	else
+	{
+		Message = &Ring->Messages[Ring->Next];
+		Ring->Next = (Ring->Next + 1) % Ring->Messages.Num();
+	}
+
+	Message->MessageID = MessageID;
+	Message->SteamIDSender = Sender;
+	Message->ChatEntryType = ChatEntryType;
+
+	// Overwrites the message keeping its allocation, which a plain assignment doesn't
+	const FUTF8ToTCHAR Converted(Text);
+	Message->Message.Reset(Converted.Length());
+	Message->Message.AppendChars(Converted.Get(), Converted.Length());
+}
+
+const FSteamChatMessage* FSteamChatHistory::Get(uint64 ChatID, int32 Index) const
+{
+	const FRing* const Ring = m_Chats.Find(ChatID);
+	if (Ring == nullptr || !Ring->Messages.IsValidIndex(Index))
+	{
+		return nullptr;
+	}
+
+	return &Ring->Messages[(Ring->Next + Index) % Ring->Messages.Num()];
+}
+
+void FSteamChatHistory::CopyTo(uint64 ChatID, TArray<FSteamChatMessage>& Messages) const
+{
+	Messages.Reset();
+
+	const FRing* const Ring = m_Chats.Find(ChatID);
+	if (Ring == nullptr)
+	{
+		return;
+	}
+
+	Messages.Reserve(Ring->Messages.Num());
+	Messages.Append(Ring->Messages.GetData() + Ring->Next, Ring->Messages.Num() - Ring->Next);
+	Messages.Append(Ring->Messages.GetData(), Ring->Next);
+}
@@ -0,0 +1,125 @@
+// Copyright 2020 Russ 'trdwll' Treadwell <trdwll.com>. All Rights Reserved.
+
+#include "SteamClanCache.h"
+
+#include "Steam.h"
+#include "SteamBackend.h"
+#include "SteamBridgeTrace.h"
+#include "SteamCallResult.h"
+
+void FSteamClanCache::Load()
+{
+	STEAMBRIDGE_TRACE_SCOPE(FSteamClanCache::Load);
+	ISteamBridgeFriends* const Friends = SteamBridgeFriends();
+	const int32 NumClans = FMath::Max(Friends->GetClanCount(), 0);
+
+	m_Clans.SetNum(NumClans);
+	m_Indices.Reset();
+	for (int32 i = 0; i < NumClans; i++)
+	{
+		const CSteamID SteamIDClan = Friends->GetClanByIndex(i);
+		FSteamClanInfo& Clan = m_Clans[i];
+		Clan.SteamID = SteamIDClan.ConvertToUint64();
+		Clan.Name = UTF8_TO_TCHAR(Friends->GetClanName(SteamIDClan));
+		Clan.Tag = UTF8_TO_TCHAR(Friends->GetClanTag(SteamIDClan));
+		Clan.bPublic = Friends->IsClanPublic(SteamIDClan);
+		Clan.bOfficialGameGroup = Friends->IsClanOfficialGameGroup(SteamIDClan);
+		ReadActivityCounts(Clan);
+		m_Indices.Add(Clan.SteamID.Value, i);
+	}
+
+	m_Version++;
+}
+
+void FSteamClanCache::RefreshActivityCounts(int32 BatchSize)
+{
+	if (m_bDownloadingActivityCounts || m_Clans.Num() == 0)
+	{
+		return;
+	}
+
+	m_ActivityQueue.Reset(m_Clans.Num());
+	for (const FSteamClanInfo& Clan : m_Clans)
+	{
+		m_ActivityQueue.Add(Clan.SteamID.Value);
+	}
+
+	m_ActivityBatchSize = FMath::Max(BatchSize, 1);
+	m_bDownloadingActivityCounts = true;
+	DownloadNextActivityBatch();
+}
+
+void FSteamClanCache::ReadOfficers(uint64 SteamIDClan)
+{
+	STEAMBRIDGE_TRACE_SCOPE(FSteamClanCache::ReadOfficers);
+	ISteamBridgeFriends* const Friends = SteamBridgeFriends();
+	const int32 NumOfficers = FMath::Max(Friends->GetClanOfficerCount(SteamIDClan), 0);
+
+	TArray<FSteamID>& Officers = m_Officers.FindOrAdd(SteamIDClan);
+	Officers.Reset(NumOfficers + 1);
+	Officers.Add(Friends->GetClanOwner(SteamIDClan).ConvertToUint64());
+	for (int32 i = 0; i < NumOfficers; i++)
+	{
+		Officers.AddUnique(Friends->GetClanOfficerByIndex(SteamIDClan, i).ConvertToUint64());
+	}
+
+	m_Version++;
+}
+
+void FSteamClanCache::DownloadNextActivityBatch()
+{
+	if (m_ActivityQueue.Num() == 0)
+	{
+		m_bDownloadingActivityCounts = false;
+		return;
+	}
+
+	const int32 BatchSize = FMath::Min(m_ActivityBatchSize, m_ActivityQueue.Num());
+	TArray<uint64> BatchIDs;
+	TArray<CSteamID, TInlineAllocator<32>> Batch;
+	BatchIDs.Reserve(BatchSize);
+	for (int32 i = 0; i < BatchSize; i++)
+	{
+		BatchIDs.Add(m_ActivityQueue.Pop(false));
+		Batch.Emplace(BatchIDs.Last());
+	}
+
+	const SteamAPICall_t APICall = FSteamBridgeTrace::APICallIssued(SteamBridgeFriends()->DownloadClanActivityCounts(Batch.GetData(), Batch.Num()));
+
+	TWeakPtr<FSteamClanCache> WeakCache = AsShared();
+	FSteamCallResults::Await<DownloadClanActivityCountsResult_t>(APICall).Then([WeakCache, BatchIDs = MoveTemp(BatchIDs)](TFuture<TSteamCallResult<DownloadClanActivityCountsResult_t>> Future) {
+		const TSharedPtr<FSteamClanCache> Cache = WeakCache.Pin();
+		if (!Cache.IsValid())
+		{
+			return;
+		}
+
+		const TSteamCallResult<DownloadClanActivityCountsResult_t> Result = Future.Get();
+		if (!Result.bIOFailure && Result.Result.m_bSuccess)
+		{
+			for (const uint64 SteamIDClan : BatchIDs)
+			{
+				const int32* const Index = Cache->m_Indices.Find(SteamIDClan);
+				if (Index != nullptr)
+				{
+					Cache->ReadActivityCounts(Cache->m_Clans[*Index]);
+				}
+			}
+			Cache->m_Version++;
+		}
+
+		// A failed batch doesn't hold up the rest
+		Cache->DownloadNextActivityBatch();
+	});
+}
+
+void FSteamClanCache::ReadActivityCounts(FSteamClanInfo& Clan)
+{
+	int Online = 0;
+	int InGame = 0;
+	int Chatting = 0;
+	Clan.bHasActivityCounts = SteamBridgeFriends()->GetClanActivityCounts(Clan.SteamID.Value, &Online, &InGame, &Chatting);
+	Clan.Online = Online;
+	Clan.InGame = InGame;
+	Clan.Chatting = Chatting;
+}
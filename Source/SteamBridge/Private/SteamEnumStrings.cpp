@@ -0,0 +1,7 @@
+// Copyright 2020 Russ 'trdwll' Treadwell <trdwll.com>. All Rights Reserved.
+
+#include "SteamEnumStrings.h"
+
+// The tables are indexed at runtime, which needs a definition before C++17
+constexpr TSteamEnumString<ESteamGameOverlayTypes> FSteamEnumStrings::GameOverlayDialogs[];
+constexpr TSteamEnumString<ESteamGameUserOverlayTypes> FSteamEnumStrings::GameUserOverlayDialogs[];
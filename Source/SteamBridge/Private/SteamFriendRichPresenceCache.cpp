@@ -0,0 +1,70 @@
+// Copyright 2020 Russ 'trdwll' Treadwell <trdwll.com>. All Rights Reserved.
+
+#include "SteamFriendRichPresenceCache.h"
+
+#include "SteamBackend.h"
+#include "SteamBridgeTrace.h"
+
+const FString* FSteamFriendRichPresenceCache::Find(uint64 SteamID, const ANSICHAR* Key)
+{
+	return Load(SteamID).Find(Key);
+}
+
+const ANSICHAR* FSteamFriendRichPresenceCache::GetKey(uint64 SteamID, int32 Index)
+{
+	const FEntry& Entry = Load(SteamID);
+	return Entry.KeyOffsets.IsValidIndex(Index) ? &Entry.KeyChars[Entry.KeyOffsets[Index]] : "";
+}
+
+void FSteamFriendRichPresenceCache::FindUsers(const ANSICHAR* Key, const FString& Value, TArray<FSteamID>& SteamIDs)
+{
+	STEAMBRIDGE_TRACE_SCOPE(FSteamFriendRichPresenceCache::FindUsers);
+	SteamIDs.Reset();
+	for (auto& User : m_Users)
+	{
+		if (User.Value.bStale)
+		{
+			Reload(User.Key, User.Value);
+		}
+
+		const FString* const Found = User.Value.Find(Key);
+		if (Found != nullptr && Found->Equals(Value, ESearchCase::CaseSensitive))
+		{
+			SteamIDs.Add(User.Key);
+		}
+	}
+}
+
+FSteamFriendRichPresenceCache::FEntry& FSteamFriendRichPresenceCache::Load(uint64 SteamID)
+{
+	FEntry& Entry = m_Users.FindOrAdd(SteamID);
+	if (Entry.bStale)
+	{
+		Reload(SteamID, Entry);
+	}
+	return Entry;
+}
+
+void FSteamFriendRichPresenceCache::Reload(uint64 SteamID, FEntry& Entry)
+{
+	STEAMBRIDGE_TRACE_SCOPE(FSteamFriendRichPresenceCache::Reload);
+	ISteamBridgeFriends* const Friends = SteamBridgeFriends();
+	const int32 NumKeys = FMath::Max(Friends->GetFriendRichPresenceKeyCount(SteamID), 0);
+
+	// Keeps the allocations, the same user's keys and values tend to be about the same length each time
+	Entry.KeyChars.Reset();
+	Entry.KeyOffsets.SetNum(NumKeys, false);
+	Entry.Values.SetNum(NumKeys, false);
+	for (int32 i = 0; i < NumKeys; i++)
+	{
+		const char* const Key = Friends->GetFriendRichPresenceKeyByIndex(SteamID, i);
+		Entry.KeyOffsets[i] = Entry.KeyChars.Num();
+		Entry.KeyChars.Append(Key, FCStringAnsi::Strlen(Key) + 1);
+
+		const FUTF8ToTCHAR Value(Friends->GetFriendRichPresence(SteamID, Key));
+		Entry.Values[i].Reset(Value.Length());
+		Entry.Values[i].AppendChars(Value.Get(), Value.Length());
+	}
+
+	Entry.bStale = false;
+}
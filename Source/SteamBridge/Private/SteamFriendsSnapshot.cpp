@@ -0,0 +1,174 @@
+// Copyright 2020 Russ 'trdwll' Treadwell <trdwll.com>. All Rights Reserved.
+
+#include "SteamFriendsSnapshot.h"
+
+#include "Steam.h"
+#include "SteamBackend.h"
+#include "SteamBridgeTrace.h"
+
+static constexpr uint32 PersonaNameChanges = k_EPersonaChangeName | k_EPersonaChangeNameFirstSet;
+static constexpr uint32 PersonaStateChanges = k_EPersonaChangeStatus | k_EPersonaChangeComeOnline | k_EPersonaChangeGoneOffline;
+static constexpr uint32 GamePlayedChanges = k_EPersonaChangeGamePlayed | k_EPersonaChangeGameServer;
+
+TSharedRef<FSteamFriendsSnapshot> FSteamFriendsSnapshot::Build(FSteamFriendFlags Flags)
+{
+	STEAMBRIDGE_TRACE_SCOPE(FSteamFriendsSnapshot::Build);
+	TSharedRef<FSteamFriendsSnapshot> Snapshot = MakeShared<FSteamFriendsSnapshot>(Flags);
+
+	const int32 Count = SteamBridgeFriends()->GetFriendCount((int32)Flags.GetBits());
+	Snapshot->m_SteamIDs.Reserve(Count);
+	Snapshot->m_PersonaNames.Reserve(Count);
+	Snapshot->m_PersonaStates.Reserve(Count);
+	Snapshot->m_GameIDs.Reserve(Count);
+	Snapshot->m_SteamLevels.Reserve(Count);
+	Snapshot->m_Indices.Reserve(Count);
+
+	for (int32 i = 0; i < Count; i++)
+	{
+		Snapshot->Add(SteamBridgeFriends()->GetFriendByIndex(i, (int32)Flags.GetBits()).ConvertToUint64());
+	}
+
+	return Snapshot;
+}
+
+bool FSteamFriendsSnapshot::IsAffectedBy(uint64 SteamID, uint32 SteamChangeFlags) const
+{
+	return (SteamChangeFlags & k_EPersonaChangeRelationshipChanged) != 0 || m_Indices.Contains(SteamID);
+}
+
+bool FSteamFriendsSnapshot::Patch(uint64 SteamID, uint32 SteamChangeFlags)
+{
+	STEAMBRIDGE_TRACE_SCOPE(FSteamFriendsSnapshot::Patch);
+	const int32 Index = Find(SteamID);
+	bool bChanged = false;
+
+	if ((SteamChangeFlags & k_EPersonaChangeRelationshipChanged) != 0)
+	{
+		const bool bMatches = SteamBridgeFriends()->HasFriend(SteamID, (int32)m_Flags.GetBits());
+		if (bMatches && Index == INDEX_NONE)
+		{
+			Add(SteamID);
+			m_Version++;
+			return true;
+		}
+
+		if (!bMatches && Index != INDEX_NONE)
+		{
+			RemoveAt(Index);
+			m_Version++;
+			return true;
+		}
+	}
+
+	if (Index == INDEX_NONE)
+	{
+		return false;
+	}
+
+	if ((SteamChangeFlags & PersonaNameChanges) != 0)
+	{
+		bChanged |= RefreshPersonaName(Index);
+	}
+
+	if ((SteamChangeFlags & PersonaStateChanges) != 0)
+	{
+		bChanged |= RefreshPersonaState(Index);
+	}
+
+	if ((SteamChangeFlags & GamePlayedChanges) != 0)
+	{
+		bChanged |= RefreshGameID(Index);
+	}
+
+	if ((SteamChangeFlags & k_EPersonaChangeSteamLevel) != 0)
+	{
+		bChanged |= RefreshSteamLevel(Index);
+	}
+
+	if (bChanged)
+	{
+		m_Version++;
+	}
+	return bChanged;
+}
+
+void FSteamFriendsSnapshot::Add(uint64 SteamID)
+{
+	const int32 Index = m_SteamIDs.Add(SteamID);
+	m_PersonaNames.AddDefaulted();
+	m_PersonaStates.Add(ESteamPersonaState::Offline);
+	m_GameIDs.Add(0);
+	m_SteamLevels.Add(0);
+	m_Indices.Add(SteamID, Index);
+
+	RefreshPersonaName(Index);
+	RefreshPersonaState(Index);
+	RefreshGameID(Index);
+	RefreshSteamLevel(Index);
+}
+
+void FSteamFriendsSnapshot::RemoveAt(int32 Index)
+{
+	m_Indices.Remove(m_SteamIDs[Index]);
+
+	// Swap the last friend into the hole so every column stays packed
+	m_SteamIDs.RemoveAtSwap(Index, 1, false);
+	m_PersonaNames.RemoveAtSwap(Index, 1, false);
+	m_PersonaStates.RemoveAtSwap(Index, 1, false);
+	m_GameIDs.RemoveAtSwap(Index, 1, false);
+	m_SteamLevels.RemoveAtSwap(Index, 1, false);
+
+	if (m_SteamIDs.IsValidIndex(Index))
+	{
+		m_Indices[m_SteamIDs[Index]] = Index;
+	}
+}
+
+bool FSteamFriendsSnapshot::RefreshPersonaName(int32 Index)
+{
+	const FString PersonaName = UTF8_TO_TCHAR(SteamBridgeFriends()->GetFriendPersonaName(m_SteamIDs[Index]));
+	if (m_PersonaNames[Index] == PersonaName)
+	{
+		return false;
+	}
+
+	m_PersonaNames[Index] = PersonaName;
+	return true;
+}
+
+bool FSteamFriendsSnapshot::RefreshPersonaState(int32 Index)
+{
+	const ESteamPersonaState PersonaState = (ESteamPersonaState)SteamBridgeFriends()->GetFriendPersonaState(m_SteamIDs[Index]);
+	if (m_PersonaStates[Index] == PersonaState)
+	{
+		return false;
+	}
+
+	m_PersonaStates[Index] = PersonaState;
+	return true;
+}
+
+bool FSteamFriendsSnapshot::RefreshGameID(int32 Index)
+{
+	FriendGameInfo_t GameInfo;
+	const uint64 GameID = SteamBridgeFriends()->GetFriendGamePlayed(m_SteamIDs[Index], &GameInfo) ? GameInfo.m_gameID.ToUint64() : 0;
+	if (m_GameIDs[Index] == GameID)
+	{
+		return false;
+	}
+
+	m_GameIDs[Index] = GameID;
+	return true;
+}
+
+bool FSteamFriendsSnapshot::RefreshSteamLevel(int32 Index)
+{
+	const int32 SteamLevel = SteamBridgeFriends()->GetFriendSteamLevel(m_SteamIDs[Index]);
+	if (m_SteamLevels[Index] == SteamLevel)
+	{
+		return false;
+	}
+
+	m_SteamLevels[Index] = SteamLevel;
+	return true;
+}
@@ -0,0 +1,64 @@
+// Copyright 2020 Russ 'trdwll' Treadwell <trdwll.com>. All Rights Reserved.
+
+#include "SteamImageUtils.h"
+
+#if PLATFORM_CPU_X86_FAMILY
+#include <emmintrin.h>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+#elif PLATFORM_CPU_ARM_FAMILY && PLATFORM_ENABLE_VECTORINTRINSICS_NEON
+#include <arm_neon.h>
+#endif
+
+void FSteamImageUtils::ConvertRGBAToBGRA(const uint8* Src, uint8* Dest, int32 NumPixels)
+{
+	int32 i = 0;
+
+	// Each lane is a pixel, 0xAABBGGRR in memory order on little endian: keep G and A, move R up and B down
+#if PLATFORM_CPU_X86_FAMILY
+#if defined(__AVX2__)
+	const __m256i GreenAlpha256 = _mm256_set1_epi32(0xFF00FF00);
+	const __m256i Low256 = _mm256_set1_epi32(0x000000FF);
+	for (; i + 8 <= NumPixels; i += 8)
+	{
+		const __m256i Pixels = _mm256_loadu_si256((const __m256i*)(Src + i * 4));
+		const __m256i RedBlue = _mm256_or_si256(_mm256_slli_epi32(_mm256_and_si256(Pixels, Low256), 16), _mm256_and_si256(_mm256_srli_epi32(Pixels, 16), Low256));
+		_mm256_storeu_si256((__m256i*)(Dest + i * 4), _mm256_or_si256(_mm256_and_si256(Pixels, GreenAlpha256), RedBlue));
+	}
+#endif
+
+	const __m128i GreenAlpha = _mm_set1_epi32(0xFF00FF00);
+	const __m128i Low = _mm_set1_epi32(0x000000FF);
+	for (; i + 4 <= NumPixels; i += 4)
+	{
+		const __m128i Pixels = _mm_loadu_si128((const __m128i*)(Src + i * 4));
+		const __m128i RedBlue = _mm_or_si128(_mm_slli_epi32(_mm_and_si128(Pixels, Low), 16), _mm_and_si128(_mm_srli_epi32(Pixels, 16), Low));
+		_mm_storeu_si128((__m128i*)(Dest + i * 4), _mm_or_si128(_mm_and_si128(Pixels, GreenAlpha), RedBlue));
+	}
+#elif PLATFORM_CPU_ARM_FAMILY && PLATFORM_ENABLE_VECTORINTRINSICS_NEON
+	// De-interleaving loads split the channels into separate registers, so the swap is just storing them in a different order
+	for (; i + 16 <= NumPixels; i += 16)
+	{
+		uint8x16x4_t Pixels = vld4q_u8(Src + i * 4);
+		const uint8x16_t Red = Pixels.val[0];
+		Pixels.val[0] = Pixels.val[2];
+		Pixels.val[2] = Red;
+		vst4q_u8(Dest + i * 4, Pixels);
+	}
+#endif
+
+	ConvertRGBAToBGRAScalar(Src + i * 4, Dest + i * 4, NumPixels - i);
+}
+
+void FSteamImageUtils::ConvertRGBAToBGRAScalar(const uint8* Src, uint8* Dest, int32 NumPixels)
+{
+	for (int32 i = 0; i < NumPixels; i++, Src += 4, Dest += 4)
+	{
+		const uint8 Red = Src[0];
+		Dest[0] = Src[2];
+		Dest[1] = Src[1];
+		Dest[2] = Red;
+		Dest[3] = Src[3];
+	}
+}
@@ -0,0 +1,37 @@
+// Copyright 2020 Russ 'trdwll' Treadwell <trdwll.com>. All Rights Reserved.
+
+#include "SteamKeys.h"
+
+// From a hash of the UTF-8 bytes to the handles of the keys with that hash, FName would ignore case
+static TMultiMap<uint32, int32> GSteamKeyHandles;
+
+// Indexed by handle - 1. Each string keeps its own allocation so it doesn't move when the table grows
+static TArray<TArray<ANSICHAR>> GSteamKeyStrings;
+
+FSteamKey FSteamKeys::Intern(const TCHAR* Key)
+{
+	check(IsInGameThread());
+
+	const FTCHARToUTF8 Converted(Key);
+	const uint32 Hash = FCrc::MemCrc32(Converted.Get(), Converted.Length());
+	for (TMultiMap<uint32, int32>::TConstKeyIterator It = GSteamKeyHandles.CreateConstKeyIterator(Hash); It; ++It)
+	{
+		const TArray<ANSICHAR>& String = GSteamKeyStrings[It.Value() - 1];
+		if (String.Num() - 1 == Converted.Length() && FMemory::Memcmp(String.GetData(), Converted.Get(), Converted.Length()) == 0)
+		{
+			return It.Value();
+		}
+	}
+
+	TArray<ANSICHAR>& String = GSteamKeyStrings.AddDefaulted_GetRef();
+	String.Append(Converted.Get(), Converted.Length());
+	String.Add('\0');
+
+	GSteamKeyHandles.Add(Hash, GSteamKeyStrings.Num());
+	return GSteamKeyStrings.Num();
+}
+
+const char* FSteamKeys::ToUTF8(FSteamKey Key)
+{
+	return GSteamKeyStrings.IsValidIndex(Key.Value - 1) ? GSteamKeyStrings[Key.Value - 1].GetData() : "";
+}
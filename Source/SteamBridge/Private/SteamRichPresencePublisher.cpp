@@ -0,0 +1,180 @@
+// Copyright 2020 Russ 'trdwll' Treadwell <trdwll.com>. All Rights Reserved.
+
+#include "SteamRichPresencePublisher.h"
+
+#include "SteamBackend.h"
+#include "SteamBridgeTrace.h"
+
+bool FSteamRichPresencePublisher::Set(const ANSICHAR* Key, FSteamKey Handle, const FString& Value)
+{
+	const int32 Index = FindEntry(Key, Handle);
+	FEntry* const Entry = Index != INDEX_NONE ? &m_Entries[Index] : nullptr;
+	if (Entry != nullptr && Handle != 0)
+	{
+		Entry->Handle = Handle;
+	}
+
+	if (Entry != nullptr ? Entry->Committed.Equals(Value, ESearchCase::CaseSensitive) : Value.IsEmpty())
+	{
+		// Back to what Steam already has, whatever was queued in between
+		if (Entry != nullptr)
+		{
+			Entry->bPending = false;
+			Entry->Pending.Reset();
+			if (Entry->Committed.IsEmpty())
+			{
+				m_Entries.RemoveAtSwap(Index);
+			}
+		}
+		return true;
+	}
+
+	if (Entry != nullptr && Entry->bPending && Entry->Pending.Equals(Value, ESearchCase::CaseSensitive))
+	{
+		return true;
+	}
+
+	// Steam's lengths include the terminator
+	const int32 KeyLength = FCStringAnsi::Strlen(Key);
+	if (KeyLength == 0 || KeyLength >= k_cchMaxRichPresenceKeyLength || FTCHARToUTF8(*Value).Length() >= k_cchMaxRichPresenceValueLength)
+	{
+		return false;
+	}
+
+	const bool bAddsKey = !Value.IsEmpty() && (Entry == nullptr || (Entry->Committed.IsEmpty() && (!Entry->bPending || Entry->Pending.IsEmpty())));
+	if (bAddsKey && CountKeysAfterFlush() >= k_cchMaxRichPresenceKeys)
+	{
+		return false;
+	}
+
+	if (Entry != nullptr)
+	{
+		Entry->Pending = Value;
+		Entry->bPending = true;
+	}
+	else
+	{
+		FEntry& Added = m_Entries.AddDefaulted_GetRef();
+		Added.Key.Append(Key, KeyLength + 1);
+		Added.Handle = Handle;
+		Added.Pending = Value;
+		Added.bPending = true;
+	}
+	return true;
+}
+
+void FSteamRichPresencePublisher::Clear()
+{
+	for (int32 i = m_Entries.Num() - 1; i >= 0; i--)
+	{
+		FEntry& Entry = m_Entries[i];
+		if (Entry.Committed.IsEmpty())
+		{
+			m_Entries.RemoveAtSwap(i);
+		}
+		else
+		{
+			Entry.Pending.Reset();
+			Entry.bPending = true;
+		}
+	}
+}
+
+const FString* FSteamRichPresencePublisher::Find(const ANSICHAR* Key, FSteamKey Handle) const
+{
+	const int32 Index = FindEntry(Key, Handle);
+	if (Index == INDEX_NONE)
+	{
+		return nullptr;
+	}
+
+	const FEntry& Entry = m_Entries[Index];
+	const FString& Value = Entry.bPending ? Entry.Pending : Entry.Committed;
+	return !Value.IsEmpty() ? &Value : nullptr;
+}
+
+bool FSteamRichPresencePublisher::HasPendingChanges() const
+{
+	return m_Entries.ContainsByPredicate([](const FEntry& Entry) { return Entry.bPending; });
+}
+
+void FSteamRichPresencePublisher::Flush(double IntervalSeconds)
+{
+	if (!HasPendingChanges())
+	{
+		return;
+	}
+
+	const double Now = FPlatformTime::Seconds();
+	if (Now - m_LastFlushSeconds < IntervalSeconds)
+	{
+		return;
+	}
+
+	STEAMBRIDGE_TRACE_SCOPE(FSteamRichPresencePublisher::Flush);
+	m_LastFlushSeconds = Now;
+
+	// Removing every key is a single call
+	if (CountKeysAfterFlush() == 0)
+	{
+		SteamBridgeFriends()->ClearRichPresence();
+		m_Entries.Reset();
+		return;
+	}
+
+	for (int32 i = m_Entries.Num() - 1; i >= 0; i--)
+	{
+		FEntry& Entry = m_Entries[i];
+		if (!Entry.bPending)
+		{
+			continue;
+		}
+
+		// A change Steam refuses is dropped, Committed only holds what Steam accepted
+		const bool bSet = SteamBridgeFriends()->SetRichPresence(Entry.Key.GetData(), TCHAR_TO_UTF8(*Entry.Pending));
+		if (Entry.Pending.IsEmpty())
+		{
+			Entry.Committed.Reset();
+		}
+		else if (bSet)
+		{
+			Entry.Committed = MoveTemp(Entry.Pending);
+		}
+		Entry.Pending.Reset();
+		Entry.bPending = false;
+
+		if (Entry.Committed.IsEmpty())
+		{
+			m_Entries.RemoveAtSwap(i);
+		}
+	}
+}
+
+int32 FSteamRichPresencePublisher::FindEntry(const ANSICHAR* Key, FSteamKey Handle) const
+{
+	for (int32 i = 0; i < m_Entries.Num(); i++)
+	{
+		const FEntry& Entry = m_Entries[i];
+		if (Handle != 0 && Entry.Handle == Handle)
+		{
+			return i;
+		}
+
+		// Interned keys with different handles are different strings, so only a key without a handle needs the string compare
+		if ((Handle == 0 || Entry.Handle == 0) && FCStringAnsi::Strcmp(Entry.Key.GetData(), Key) == 0)
+		{
+			return i;
+		}
+	}
+	return INDEX_NONE;
+}
+
+int32 FSteamRichPresencePublisher::CountKeysAfterFlush() const
+{
+	int32 Count = 0;
+	for (const FEntry& Entry : m_Entries)
+	{
+		Count += !(Entry.bPending ? Entry.Pending : Entry.Committed).IsEmpty() ? 1 : 0;
+	}
+	return Count;
+}
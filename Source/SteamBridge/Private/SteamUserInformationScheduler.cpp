@@ -0,0 +1,141 @@
+// Copyright 2020 Russ 'trdwll' Treadwell <trdwll.com>. All Rights Reserved.
+
+#include "SteamUserInformationScheduler.h"
+
+#include "SteamBridgeTrace.h"
+
+FSteamUserInformationScheduler::~FSteamUserInformationScheduler()
+{
+	// Nobody is left to complete them
+	for (auto& Request : m_Requests)
+	{
+		for (TPromise<bool>& Waiter : Request.Value.Waiters)
+		{
+			Waiter.SetValue(false);
+		}
+	}
+}
+
+TFuture<bool> FSteamUserInformationScheduler::Request(uint64 SteamID, int32 Priority, bool bRequireNameOnly)
+{
+	FRequest* Request = m_Requests.Find(SteamID);
+	if (Request == nullptr)
+	{
+		Request = &m_Requests.Add(SteamID);
+		Request->bRequireNameOnly = bRequireNameOnly;
+		Enqueue(SteamID, *Request, Priority);
+	}
+	else if (!Request->bInFlight)
+	{
+		// A request for the full information also covers a name only one
+		Request->bRequireNameOnly &= bRequireNameOnly;
+		if (Priority > Request->Priority)
+		{
+			Enqueue(SteamID, *Request, Priority);
+		}
+	}
+
+	return Request->Waiters.AddDefaulted_GetRef().GetFuture();
+}
+
+void FSteamUserInformationScheduler::Cancel(uint64 SteamID)
+{
+	const FRequest* const Request = m_Requests.Find(SteamID);
+	if (Request != nullptr && !Request->bInFlight)
+	{
+		Finish(SteamID, false);
+	}
+}
+
+void FSteamUserInformationScheduler::Complete(uint64 SteamID)
+{
+	// Still queued counts too, someone else's request brought the information in
+	if (m_Requests.Contains(SteamID))
+	{
+		Finish(SteamID, true);
+	}
+}
+
+void FSteamUserInformationScheduler::Pump(int32 MaxInFlight, double TimeoutSeconds, TFunctionRef<bool(uint64, bool)> Issue)
+{
+	if (m_Requests.Num() == 0)
+	{
+		return;
+	}
+
+	STEAMBRIDGE_TRACE_SCOPE(FSteamUserInformationScheduler::Pump);
+	const double Now = FPlatformTime::Seconds();
+
+	// Frees the slots of requests Steam never answered. Collected first, continuations may finish other requests
+	TArray<uint64, TInlineAllocator<16>> TimedOut;
+	for (const uint64 SteamID : m_InFlight)
+	{
+		if (Now - m_Requests.FindChecked(SteamID).IssueTime >= TimeoutSeconds)
+		{
+			TimedOut.Add(SteamID);
+		}
+	}
+
+	for (const uint64 SteamID : TimedOut)
+	{
+		Finish(SteamID, false);
+	}
+
+	while (m_InFlight.Num() < MaxInFlight && m_Queue.Num() > 0)
+	{
+		FQueued Queued;
+		m_Queue.HeapPop(Queued, false);
+
+		FRequest* const Request = m_Requests.Find(Queued.SteamID);
+		if (Request == nullptr || Request->bInFlight || Request->Sequence != Queued.Sequence)
+		{
+			continue;
+		}
+
+		if (Issue(Queued.SteamID, Request->bRequireNameOnly))
+		{
+			Request->bInFlight = true;
+			Request->IssueTime = Now;
+			m_InFlight.Add(Queued.SteamID);
+		}
+		else
+		{
+			Finish(Queued.SteamID, true);
+		}
+	}
+
+	// Only outdated entries are left
+	if (NumQueued() == 0)
+	{
+		m_Queue.Reset();
+	}
+}
+
+void FSteamUserInformationScheduler::Enqueue(uint64 SteamID, FRequest& Request, int32 Priority)
+{
+	Request.Priority = Priority;
+	Request.Sequence = m_NextSequence++;
+	m_Queue.HeapPush({SteamID, Priority, Request.Sequence});
+}
+
+void FSteamUserInformationScheduler::Finish(uint64 SteamID, bool bResult)
+{
+	FRequest* const Request = m_Requests.Find(SteamID);
+	if (Request == nullptr)
+	{
+		return;
+	}
+
+	if (Request->bInFlight)
+	{
+		m_InFlight.RemoveSingleSwap(SteamID, false);
+	}
+
+	// Continuations may queue requests of their own, so the request is out of the map before they run
+	TArray<TPromise<bool>> Waiters = MoveTemp(Request->Waiters);
+	m_Requests.Remove(SteamID);
+	for (TPromise<bool>& Waiter : Waiters)
+	{
+		Waiter.SetValue(bResult);
+	}
+}
@@ -0,0 +1,113 @@
+// Copyright 2020 Russ 'trdwll' Treadwell <trdwll.com>. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "SteamCallbackDispatcher.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	// Outside every Steam callback range, so nothing but the test is registered for it
+	constexpr int32 TestCallbackID = 999900;
+
+	/** Registered with the dispatcher only, so dispatching never involves Steam. */
+	struct FTestHandler final : public CCallbackBase
+	{
+		TFunction<void()> OnRun;
+		int32 Runs = 0;
+
+		virtual void Run(void* pvParam) override
+		{
+			Runs++;
+			if (OnRun)
+			{
+				OnRun();
+			}
+		}
+
+		virtual void Run(void* pvParam, bool bIOFailure, SteamAPICall_t hSteamAPICall) override { Run(pvParam); }
+		virtual int GetCallbackSizeBytes() override { return sizeof(int32); }
+	};
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSteamCallbackDispatcherRegistrationTest, "SteamBridge.CallbackDispatcher.HandlersChangingRegistrations", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FSteamCallbackDispatcherRegistrationTest::RunTest(const FString& Parameters)
+{
+	FSteamCallbackDispatcher& Dispatcher = FSteamCallbackDispatcher::Get();
+
+	// Nothing may be carried over to another frame
+	const double DispatchBudgetSeconds = Dispatcher.m_DispatchBudgetSeconds;
+	Dispatcher.m_DispatchBudgetSeconds = 0.0;
+
+	FTestHandler Retaining;
+	FTestHandler Unregistering;
+	FTestHandler Unregistered;
+	FTestHandler Retained;
+	FTestHandler Others[64];
+
+	// Registered the way a lazy callback is, but without Steam
+	const FMulticastScriptDelegate Unbound;
+	Dispatcher.AddLazyCallback(&Retained, Unbound, [&Dispatcher, &Retained](bool bRegister) {
+		if (bRegister)
+		{
+			Dispatcher.AddCallback(&Retained, TestCallbackID, false);
+		}
+		else
+		{
+			Dispatcher.RemoveCallback(&Retained, TestCallbackID, false);
+		}
+	});
+
+	// Grows the list being dispatched past its inline storage and rehashes the map around it
+	Retaining.OnRun = [&]() {
+		if (Retaining.Runs == 1)
+		{
+			Dispatcher.Retain(Retained);
+			for (int32 i = 0; i < (int32)UE_ARRAY_COUNT(Others); i++)
+			{
+				Dispatcher.AddCallback(&Others[i], i % 2 == 0 ? TestCallbackID : TestCallbackID + 1 + i, false);
+			}
+		}
+	};
+	Unregistering.OnRun = [&]() { Dispatcher.RemoveCallback(&Unregistered, TestCallbackID, false); };
+
+	Dispatcher.AddCallback(&Retaining, TestCallbackID, false);
+	Dispatcher.AddCallback(&Unregistering, TestCallbackID, false);
+	Dispatcher.AddCallback(&Unregistered, TestCallbackID, false);
+
+	auto PostAndDispatch = [&Dispatcher]() {
+		FSteamQueuedCallback Queued;
+		Queued.CallbackID = TestCallbackID;
+		Queued.Payload.SetNumZeroed(sizeof(int32));
+		Dispatcher.Post(MoveTemp(Queued));
+		Dispatcher.DispatchQueued();
+	};
+
+	PostAndDispatch();
+	TestEqual(TEXT("The handler registering callbacks ran"), Retaining.Runs, 1);
+	TestEqual(TEXT("The handler unregistering a callback ran"), Unregistering.Runs, 1);
+	TestEqual(TEXT("A handler unregistered earlier in the same dispatch is skipped"), Unregistered.Runs, 0);
+	TestEqual(TEXT("A callback retained during the dispatch isn't run by it"), Retained.Runs, 0);
+	TestEqual(TEXT("A callback registered during the dispatch isn't run by it"), Others[0].Runs, 0);
+
+	PostAndDispatch();
+	TestEqual(TEXT("The retained callback runs on the next dispatch"), Retained.Runs, 1);
+	TestEqual(TEXT("The registered callback runs on the next dispatch"), Others[0].Runs, 1);
+	TestEqual(TEXT("A callback of another ID isn't run"), Others[1].Runs, 0);
+	TestEqual(TEXT("The unregistered callback stays unregistered"), Unregistered.Runs, 0);
+
+	Dispatcher.RemoveLazyCallback(&Retained);
+	Dispatcher.RemoveCallback(&Retained, TestCallbackID, false);
+	Dispatcher.RemoveCallback(&Retaining, TestCallbackID, false);
+	Dispatcher.RemoveCallback(&Unregistering, TestCallbackID, false);
+	for (int32 i = 0; i < (int32)UE_ARRAY_COUNT(Others); i++)
+	{
+		Dispatcher.RemoveCallback(&Others[i], i % 2 == 0 ? TestCallbackID : TestCallbackID + 1 + i, false);
+	}
+
+	Dispatcher.m_DispatchBudgetSeconds = DispatchBudgetSeconds;
+	return true;
+}
+
+#endif
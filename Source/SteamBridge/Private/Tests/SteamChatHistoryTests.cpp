@@ -0,0 +1,60 @@
+// Copyright 2020 Russ 'trdwll' Treadwell <trdwll.com>. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "SteamChatHistory.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSteamChatHistoryCapacityTest, "SteamBridge.ChatHistory.CapacityChangeAfterWrap", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FSteamChatHistoryCapacityTest::RunTest(const FString& Parameters)
+{
+	const uint64 WrappedChat = 1;
+	const uint64 NewChat = 2;
+
+	FSteamChatHistory History;
+	History.SetCapacity(3);
+	for (int32 MessageID = 1; MessageID <= 5; MessageID++)
+	{
+		History.Add(WrappedChat, MessageID, 0, ESteamChatEntryType::ChatMessage, "");
+	}
+
+	// Raised once the ring has wrapped, the chat keeps the capacity it was added with
+	History.SetCapacity(10);
+	History.Add(WrappedChat, 6, 0, ESteamChatEntryType::ChatMessage, "");
+
+	TestEqual(TEXT("The wrapped chat doesn't grow"), History.Num(WrappedChat), 3);
+	for (int32 Index = 0; Index < 3; Index++)
+	{
+		const FSteamChatMessage* const Message = History.Get(WrappedChat, Index);
+		if (TestNotNull(TEXT("The message exists"), Message))
+		{
+			TestEqual(TEXT("Get returns the messages oldest first"), Message->MessageID, 4 + Index);
+		}
+	}
+
+	TArray<FSteamChatMessage> Messages;
+	History.CopyTo(WrappedChat, Messages);
+	if (TestEqual(TEXT("CopyTo copies every message"), Messages.Num(), 3))
+	{
+		for (int32 Index = 0; Index < 3; Index++)
+		{
+			TestEqual(TEXT("CopyTo copies the messages oldest first"), Messages[Index].MessageID, 4 + Index);
+		}
+	}
+
+	for (int32 MessageID = 1; MessageID <= 5; MessageID++)
+	{
+		History.Add(NewChat, MessageID, 0, ESteamChatEntryType::ChatMessage, "");
+	}
+	TestEqual(TEXT("A chat added after the capacity was raised uses it"), History.Num(NewChat), 5);
+
+	// Lowered, the existing chats keep theirs too
+	History.SetCapacity(1);
+	History.Add(NewChat, 6, 0, ESteamChatEntryType::ChatMessage, "");
+	TestEqual(TEXT("Lowering the capacity doesn't shrink existing chats"), History.Num(NewChat), 6);
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,39 @@
+// Copyright 2020 Russ 'trdwll' Treadwell <trdwll.com>. All Rights Reserved.
+
+#pragma once
+
+#include "Async/SteamAsyncActionBase.h"
+#include "Core/SteamApps.h"
+#include "CoreMinimal.h"
+
+#include "SteamAppsAsyncActions.generated.h"
+
+UCLASS()
+class STEAMBRIDGE_API USteamGetFileDetailsAsyncAction final : public USteamAsyncActionBase
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Asynchronously retrieves metadata details about a specific file in the depot manifest.
+	 *
+	 * @param UObject * WorldContextObject
+	 * @param const FString & FileName
+	 * @return USteamGetFileDetailsAsyncAction *
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|Apps", meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"))
+	static USteamGetFileDetailsAsyncAction* GetFileDetailsAsync(UObject* WorldContextObject, const FString& FileName);
+
+	virtual void Activate() override;
+
+	UPROPERTY(BlueprintAssignable)
+	FOnFileDetailsResultDelegate OnSuccess;
+
+	UPROPERTY(BlueprintAssignable)
+	FOnFileDetailsResultDelegate OnFailure;
+
+private:
+	void OnCompleted(const TSteamCallResult<FileDetailsResult_t>& Result);
+
+	FString m_FileName;
+};
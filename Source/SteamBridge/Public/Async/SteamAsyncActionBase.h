@@ -0,0 +1,40 @@
+// Copyright 2020 Russ 'trdwll' Treadwell <trdwll.com>. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintAsyncActionBase.h"
+#include "SteamCallResult.h"
+
+#include "SteamAsyncActionBase.generated.h"
+
+/**
+ * Base of the latent Blueprint nodes wrapping a single Steam API call. The result is routed to the node that issued the call,
+ * the matching On* delegate is still broadcast as well. OnFailure fires on an IO failure or when the result reports one (e.g. m_eResult isn't OK).
+ */
+UCLASS(Abstract)
+class STEAMBRIDGE_API USteamAsyncActionBase : public UBlueprintAsyncActionBase
+{
+	GENERATED_BODY()
+
+protected:
+	/**
+	 * Calls Callback on the game thread once the API call completes, then releases the node.
+	 *
+	 * @param TFuture<TSteamCallResult<T>> && Future
+	 * @param void (TAction::*Callback)(const TSteamCallResult<T>&)
+	 * @return void
+	 */
+	template <class T, class TAction>
+	void Await(TFuture<TSteamCallResult<T>>&& Future, void (TAction::*Callback)(const TSteamCallResult<T>&))
+	{
+		TWeakObjectPtr<TAction> WeakThis(CastChecked<TAction>(this));
+		Future.Then([WeakThis, Callback](TFuture<TSteamCallResult<T>> Completed) {
+			if (TAction* const Action = WeakThis.Get())
+			{
+				(Action->*Callback)(Completed.Get());
+				Action->SetReadyToDestroy();
+			}
+		});
+	}
+};
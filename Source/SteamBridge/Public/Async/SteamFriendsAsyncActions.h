@@ -0,0 +1,189 @@
+// Copyright 2020 Russ 'trdwll' Treadwell <trdwll.com>. All Rights Reserved.
+
+#pragma once
+
+#include "Async/SteamAsyncActionBase.h"
+#include "Core/SteamFriends.h"
+#include "CoreMinimal.h"
+
+#include "SteamFriendsAsyncActions.generated.h"
+
+UCLASS()
+class STEAMBRIDGE_API USteamDownloadClanActivityCountsAsyncAction final : public USteamAsyncActionBase
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Refreshes the Steam Group activity data or get the data from groups other than one that the current user is a member.
+	 *
+	 * @param UObject * WorldContextObject
+	 * @param const TArray<FSteamID> & SteamClanIDs
+	 * @return USteamDownloadClanActivityCountsAsyncAction *
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|Friends", meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"))
+	static USteamDownloadClanActivityCountsAsyncAction* DownloadClanActivityCountsAsync(UObject* WorldContextObject, const TArray<FSteamID>& SteamClanIDs);
+
+	virtual void Activate() override;
+
+	UPROPERTY(BlueprintAssignable)
+	FOnDownloadClanActivityCountsResultDelegate OnSuccess;
+
+	UPROPERTY(BlueprintAssignable)
+	FOnDownloadClanActivityCountsResultDelegate OnFailure;
+
+private:
+	void OnCompleted(const TSteamCallResult<DownloadClanActivityCountsResult_t>& Result);
+
+	TArray<FSteamID> m_SteamClanIDs;
+};
+
+UCLASS()
+class STEAMBRIDGE_API USteamGetFollowerCountAsyncAction final : public USteamAsyncActionBase
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Gets the number of users following the specified user.
+	 *
+	 * @param UObject * WorldContextObject
+	 * @param FSteamID SteamID
+	 * @return USteamGetFollowerCountAsyncAction *
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|Friends", meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"))
+	static USteamGetFollowerCountAsyncAction* GetFollowerCountAsync(UObject* WorldContextObject, FSteamID SteamID);
+
+	virtual void Activate() override;
+
+	UPROPERTY(BlueprintAssignable)
+	FOnFriendsGetFollowerCountDelegate OnSuccess;
+
+	UPROPERTY(BlueprintAssignable)
+	FOnFriendsGetFollowerCountDelegate OnFailure;
+
+private:
+	void OnCompleted(const TSteamCallResult<FriendsGetFollowerCount_t>& Result);
+
+	FSteamID m_SteamID;
+};
+
+UCLASS()
+class STEAMBRIDGE_API USteamIsFollowingAsyncAction final : public USteamAsyncActionBase
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Checks if the user is following the specified user.
+	 *
+	 * @param UObject * WorldContextObject
+	 * @param FSteamID SteamID
+	 * @return USteamIsFollowingAsyncAction *
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|Friends", meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"))
+	static USteamIsFollowingAsyncAction* IsFollowingAsync(UObject* WorldContextObject, FSteamID SteamID);
+
+	virtual void Activate() override;
+
+	UPROPERTY(BlueprintAssignable)
+	FOnFriendsIsFollowingDelegate OnSuccess;
+
+	UPROPERTY(BlueprintAssignable)
+	FOnFriendsIsFollowingDelegate OnFailure;
+
+private:
+	void OnCompleted(const TSteamCallResult<FriendsIsFollowing_t>& Result);
+
+	FSteamID m_SteamID;
+};
+
+UCLASS()
+class STEAMBRIDGE_API USteamJoinClanChatRoomAsyncAction final : public USteamAsyncActionBase
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Allows the user to join Steam group (clan) chats right within the game.
+	 *
+	 * @param UObject * WorldContextObject
+	 * @param FSteamID SteamIDClan
+	 * @return USteamJoinClanChatRoomAsyncAction *
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|Friends", meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"))
+	static USteamJoinClanChatRoomAsyncAction* JoinClanChatRoomAsync(UObject* WorldContextObject, FSteamID SteamIDClan);
+
+	virtual void Activate() override;
+
+	UPROPERTY(BlueprintAssignable)
+	FOnJoinClanChatRoomCompletionResultDelegate OnSuccess;
+
+	UPROPERTY(BlueprintAssignable)
+	FOnJoinClanChatRoomCompletionResultDelegate OnFailure;
+
+private:
+	void OnCompleted(const TSteamCallResult<JoinClanChatRoomCompletionResult_t>& Result);
+
+	FSteamID m_SteamIDClan;
+};
+
+UCLASS()
+class STEAMBRIDGE_API USteamRequestClanOfficerListAsyncAction final : public USteamAsyncActionBase
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Requests information about a Steam group officers (administrators and moderators).
+	 *
+	 * @param UObject * WorldContextObject
+	 * @param FSteamID SteamIDClan
+	 * @return USteamRequestClanOfficerListAsyncAction *
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|Friends", meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"))
+	static USteamRequestClanOfficerListAsyncAction* RequestClanOfficerListAsync(UObject* WorldContextObject, FSteamID SteamIDClan);
+
+	virtual void Activate() override;
+
+	UPROPERTY(BlueprintAssignable)
+	FOnClanOfficerListResponseDelegate OnSuccess;
+
+	UPROPERTY(BlueprintAssignable)
+	FOnClanOfficerListResponseDelegate OnFailure;
+
+private:
+	void OnCompleted(const TSteamCallResult<ClanOfficerListResponse_t>& Result);
+
+	FSteamID m_SteamIDClan;
+};
+
+UCLASS()
+class STEAMBRIDGE_API USteamSetPersonaNameAsyncAction final : public USteamAsyncActionBase
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Sets the current users persona name, stores it on the server and publishes the changes to all friends who are online.
+	 *
+	 * @param UObject * WorldContextObject
+	 * @param const FString & PersonaName
+	 * @return USteamSetPersonaNameAsyncAction *
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|Friends", meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"))
+	static USteamSetPersonaNameAsyncAction* SetPersonaNameAsync(UObject* WorldContextObject, const FString& PersonaName);
+
+	virtual void Activate() override;
+
+	UPROPERTY(BlueprintAssignable)
+	FOnSetPersonaNameResponseDelegate OnSuccess;
+
+	UPROPERTY(BlueprintAssignable)
+	FOnSetPersonaNameResponseDelegate OnFailure;
+
+private:
+	void OnCompleted(const TSteamCallResult<SetPersonaNameResponse_t>& Result);
+
+	FString m_PersonaName;
+};
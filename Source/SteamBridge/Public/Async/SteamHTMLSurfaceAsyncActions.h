@@ -0,0 +1,41 @@
+// Copyright 2020 Russ 'trdwll' Treadwell <trdwll.com>. All Rights Reserved.
+
+#pragma once
+
+#include "Async/SteamAsyncActionBase.h"
+#include "Core/SteamHTMLSurface.h"
+#include "CoreMinimal.h"
+
+#include "SteamHTMLSurfaceAsyncActions.generated.h"
+
+UCLASS()
+class STEAMBRIDGE_API USteamCreateBrowserAsyncAction final : public USteamAsyncActionBase
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Creates a browser object for displaying of an HTML page and waits until it's ready.
+	 *
+	 * @param UObject * WorldContextObject
+	 * @param const FString & UserAgent
+	 * @param const FString & UserCSS
+	 * @return USteamCreateBrowserAsyncAction *
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|HTMLSurface", meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"))
+	static USteamCreateBrowserAsyncAction* CreateBrowserAsync(UObject* WorldContextObject, const FString& UserAgent, const FString& UserCSS);
+
+	virtual void Activate() override;
+
+	UPROPERTY(BlueprintAssignable)
+	FOnHTMLBrowserReadyDelegate OnSuccess;
+
+	UPROPERTY(BlueprintAssignable)
+	FOnHTMLBrowserReadyDelegate OnFailure;
+
+private:
+	void OnCompleted(const TSteamCallResult<HTML_BrowserReady_t>& Result);
+
+	FString m_UserAgent;
+	FString m_UserCSS;
+};
@@ -3,6 +3,8 @@
 #pragma once
 #include "CoreMinimal.h"
 #include "Steam.h"
+#include "SteamBridgeTrace.h"
+#include "SteamCallResult.h"
 #include "SteamEnums.h"
 #include "SteamStructs.h"
 #include "UObject/NoExportTypes.h"
@@ -50,7 +52,7 @@ public:
 	 * @return bool
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Apps")
-	bool BIsAppInstalled(int32 AppID) const { return SteamApps()->BIsAppInstalled(AppID); }
+	bool BIsAppInstalled(int32 AppID) const { STEAMBRIDGE_TRACE_SCOPE(USteamApps::BIsAppInstalled); return SteamApps()->BIsAppInstalled(AppID); }
 
 	/**
 	 * Checks if the user owns a specific DLC and if the DLC is installed
@@ -59,7 +61,7 @@ public:
 	 * @return bool
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Apps")
-	bool BIsDlcInstalled(int32 AppID) const { return SteamApps()->BIsDlcInstalled(AppID); }
+	bool BIsDlcInstalled(int32 AppID) const { STEAMBRIDGE_TRACE_SCOPE(USteamApps::BIsDlcInstalled); return SteamApps()->BIsDlcInstalled(AppID); }
 
 	/**
 	 * Checks if the license owned by the user provides low violence depots.
@@ -68,7 +70,7 @@ public:
 	 * @return bool
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Apps")
-	bool BIsLowViolence() const { return SteamApps()->BIsLowViolence(); }
+	bool BIsLowViolence() const { STEAMBRIDGE_TRACE_SCOPE(USteamApps::BIsLowViolence); return SteamApps()->BIsLowViolence(); }
 
 	/**
 	 * Checks if the active user is subscribed to the current App ID.
@@ -77,7 +79,7 @@ public:
 	 * @return bool
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Apps")
-	bool BIsSubscribed() const { return SteamApps()->BIsSubscribed(); }
+	bool BIsSubscribed() const { STEAMBRIDGE_TRACE_SCOPE(USteamApps::BIsSubscribed); return SteamApps()->BIsSubscribed(); }
 
 	/**
 	 * Checks if the active user is subscribed to a specified AppId.
@@ -87,7 +89,7 @@ public:
 	 * @return bool
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Apps")
-	bool BIsSubscribedApp(int32 AppID) const { return SteamApps()->BIsSubscribedApp(AppID); }
+	bool BIsSubscribedApp(int32 AppID) const { STEAMBRIDGE_TRACE_SCOPE(USteamApps::BIsSubscribedApp); return SteamApps()->BIsSubscribedApp(AppID); }
 
 	/**
 	 * Checks if the active user is accessing the current appID via a temporary Family Shared license owned by another user.
@@ -96,7 +98,7 @@ public:
 	 * @return bool
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Apps")
-	bool BIsSubscribedFromFamilySharing() const { return SteamApps()->BIsSubscribedFromFamilySharing(); }
+	bool BIsSubscribedFromFamilySharing() const { STEAMBRIDGE_TRACE_SCOPE(USteamApps::BIsSubscribedFromFamilySharing); return SteamApps()->BIsSubscribedFromFamilySharing(); }
 
 	/**
 	 * Checks if the user is subscribed to the current App ID through a free weekend.
@@ -105,7 +107,7 @@ public:
 	 * @return bool
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Apps")
-	bool BIsSubscribedFromFreeWeekend() const { return SteamApps()->BIsSubscribedFromFreeWeekend(); }
+	bool BIsSubscribedFromFreeWeekend() const { STEAMBRIDGE_TRACE_SCOPE(USteamApps::BIsSubscribedFromFreeWeekend); return SteamApps()->BIsSubscribedFromFreeWeekend(); }
 
 	/**
 	 * Checks if the user has a VAC ban on their account
@@ -113,7 +115,7 @@ public:
 	 * @return bool
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Apps")
-	bool BIsVACBanned() const { return SteamApps()->BIsVACBanned(); }
+	bool BIsVACBanned() const { STEAMBRIDGE_TRACE_SCOPE(USteamApps::BIsVACBanned); return SteamApps()->BIsVACBanned(); }
 
 	/**
 	 * Gets the buildid of this app, may change at any time based on backend updates to the game.
@@ -121,7 +123,7 @@ public:
 	 * @return int32
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Apps")
-	int32 GetAppBuildId() const { return SteamApps()->GetAppBuildId(); }
+	int32 GetAppBuildId() const { STEAMBRIDGE_TRACE_SCOPE(USteamApps::GetAppBuildId); return SteamApps()->GetAppBuildId(); }
 
 	/**
 	 * Gets the install folder for a specific AppID.
@@ -140,7 +142,7 @@ public:
 	 * @return FSteamID
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Apps")
-	FSteamID GetAppOwner() const { return SteamApps()->GetAppOwner().ConvertToUint64(); }
+	FSteamID GetAppOwner() const { STEAMBRIDGE_TRACE_SCOPE(USteamApps::GetAppOwner); return SteamApps()->GetAppOwner().ConvertToUint64(); }
 
 	/**
 	 * Gets a comma separated list of the languages the current app supports.
@@ -148,7 +150,7 @@ public:
 	 * @return FString
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Apps")
-	FString GetAvailableGameLanguages() const { return SteamApps()->GetAvailableGameLanguages(); }
+	FString GetAvailableGameLanguages() const { STEAMBRIDGE_TRACE_SCOPE(USteamApps::GetAvailableGameLanguages); return SteamApps()->GetAvailableGameLanguages(); }
 
 	/**
 	 * Checks if the user is running from a beta branch, and gets the name of the branch if they are.
@@ -166,7 +168,7 @@ public:
 	 * @return FString
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Apps")
-	FString GetCurrentGameLanguage() const { return SteamApps()->GetCurrentGameLanguage(); }
+	FString GetCurrentGameLanguage() const { STEAMBRIDGE_TRACE_SCOPE(USteamApps::GetCurrentGameLanguage); return SteamApps()->GetCurrentGameLanguage(); }
 
 	/**
 	 * Gets the number of DLC pieces for the current app.
@@ -175,7 +177,7 @@ public:
 	 * @return int32
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Apps")
-	int32 GetDLCCount() const { return SteamApps()->GetDLCCount(); }
+	int32 GetDLCCount() const { STEAMBRIDGE_TRACE_SCOPE(USteamApps::GetDLCCount); return SteamApps()->GetDLCCount(); }
 
 	/**
 	 * Gets the download progress for optional DLC.
@@ -196,7 +198,7 @@ public:
 	 * @return int32
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Apps")
-	int32 GetEarliestPurchaseUnixTime(int32 AppID) const { return SteamApps()->GetEarliestPurchaseUnixTime(AppID); }
+	int32 GetEarliestPurchaseUnixTime(int32 AppID) const { STEAMBRIDGE_TRACE_SCOPE(USteamApps::GetEarliestPurchaseUnixTime); return SteamApps()->GetEarliestPurchaseUnixTime(AppID); }
 
 	/**
 	 * Asynchronously retrieves metadata details about a specific file in the depot manifest.
@@ -205,7 +207,10 @@ public:
 	 * @return FSteamAPICall
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Apps")
-	FSteamAPICall GetFileDetails(const FString& FileName) const { return SteamApps()->GetFileDetails(TCHAR_TO_ANSI(*FileName)); }
+	FSteamAPICall GetFileDetails(const FString& FileName) const { STEAMBRIDGE_TRACE_SCOPE(USteamApps::GetFileDetails); return FSteamBridgeTrace::APICallIssued(SteamApps()->GetFileDetails(TCHAR_TO_ANSI(*FileName))); }
+
+	/** C++ only, delivers the result to the returned future. m_OnFileDetailsResult is still broadcast as well. */
+	TFuture<TSteamCallResult<FileDetailsResult_t>> GetFileDetailsAsync(const FString& FileName) const { return FSteamCallResults::Await<FileDetailsResult_t>(GetFileDetails(FileName)); }
 
 	/**
 	 * Gets a list of all installed depots for a given App ID in mount order.
@@ -216,7 +221,7 @@ public:
 	 * @return int32
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Apps")
-	int32 GetInstalledDepots(int32 AppID, TArray<int32>& Depots, int32 MaxDepots = 1) { return SteamApps()->GetInstalledDepots(AppID, (DepotId_t*)Depots.GetData(), MaxDepots); }
+	int32 GetInstalledDepots(int32 AppID, TArray<int32>& Depots, int32 MaxDepots = 1) { STEAMBRIDGE_TRACE_SCOPE(USteamApps::GetInstalledDepots); return SteamApps()->GetInstalledDepots(AppID, (DepotId_t*)Depots.GetData(), MaxDepots); }
 
 	/**
 	 * Gets the command line if the game was launched via Steam URL, e.g. steam://run/<appid>//<command line>/. This method is preferable to launching with a command line via the operating system, -
@@ -238,7 +243,7 @@ public:
 	 * @return FString
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Apps")
-	FString GetLaunchQueryParam(const FString& Key) const { return SteamApps()->GetLaunchQueryParam(TCHAR_TO_UTF8(*Key)); }
+	FString GetLaunchQueryParam(const FString& Key) const { STEAMBRIDGE_TRACE_SCOPE(USteamApps::GetLaunchQueryParam); return SteamApps()->GetLaunchQueryParam(TCHAR_TO_UTF8(*Key)); }
 
 	/**
 	 * Allows you to install an optional DLC.
@@ -247,7 +252,7 @@ public:
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|Apps")
-	void InstallDLC(int32 AppID) { SteamApps()->InstallDLC(AppID); }
+	void InstallDLC(int32 AppID) { STEAMBRIDGE_TRACE_SCOPE(USteamApps::InstallDLC); SteamApps()->InstallDLC(AppID); }
 
 	/**
 	 * Allows you to force verify game content on next launch.
@@ -257,7 +262,7 @@ public:
 	 * @return bool
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Apps")
-	bool MarkContentCorrupt(bool bMissingFilesOnly) const { return SteamApps()->MarkContentCorrupt(bMissingFilesOnly); }
+	bool MarkContentCorrupt(bool bMissingFilesOnly) const { STEAMBRIDGE_TRACE_SCOPE(USteamApps::MarkContentCorrupt); return SteamApps()->MarkContentCorrupt(bMissingFilesOnly); }
 
 	/**
 	 * Allows you to uninstall an optional DLC.
@@ -266,7 +271,7 @@ public:
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|Apps")
-	void UninstallDLC(int32 AppID) { SteamApps()->UninstallDLC(AppID); }
+	void UninstallDLC(int32 AppID) { STEAMBRIDGE_TRACE_SCOPE(USteamApps::UninstallDLC); SteamApps()->UninstallDLC(AppID); }
 
 	/** Delegates */
 
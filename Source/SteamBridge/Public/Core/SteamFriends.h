@@ -4,8 +4,24 @@
 
 #include "CoreMinimal.h"
 #include "Steam.h"
+#include "SteamAvatarAtlas.h"
+#include "SteamAvatarCache.h"
+#include "SteamAvatarDiskCache.h"
+#include "SteamChatHistory.h"
+#include "SteamClanCache.h"
+#include "SteamFriendRichPresenceCache.h"
+#include "SteamRichPresencePublisher.h"
+#include "SteamUserInformationScheduler.h"
+#include "SteamBackend.h"
+#include "SteamBridgeTrace.h"
+#include "SteamCallResult.h"
 #include "SteamEnums.h"
+#include "SteamFlags.h"
+#include "SteamFriendsSnapshot.h"
+#include "SteamKeys.h"
+#include "SteamRequestDeduplicator.h"
 #include "SteamStructs.h"
+#include "Styling/SlateBrush.h"
 #include "UObject/NoExportTypes.h"
 
 #include "SteamFriends.generated.h"
@@ -27,6 +43,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnGameRichPresenceJoinRequestedDel
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnGameServerChangeRequestedDelegate, FString, IP, FString, Password);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnJoinClanChatRoomCompletionResultDelegate, FSteamID, SteamIDClanChat, ESteamChatRoomEnterResponse, Response);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnPersonaStateChangeDelegate, FSteamID, SteamID, ESteamPersonaChange, PersonaStateChange);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnPersonaStateChangeFlagsDelegate, FSteamID, SteamID, int32, ChangeFlags);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnSetPersonaNameResponseDelegate, bool, bSuccess, bool, bLocalSuccess, ESteamResult, Result);
 
 class UTexture2D;
@@ -63,7 +80,7 @@ public:
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|Friends")
-	void ActivateGameOverlayInviteDialog(FSteamID SteamIDLobby) { SteamFriends()->ActivateGameOverlayInviteDialog(SteamIDLobby.Value); }
+	void ActivateGameOverlayInviteDialog(FSteamID SteamIDLobby) { STEAMBRIDGE_TRACE_SCOPE(USteamFriends::ActivateGameOverlayInviteDialog); SteamBridgeFriends()->ActivateGameOverlayInviteDialog(SteamIDLobby.Value); }
 
 	/**
 	 * Activates the Steam Overlay to the Steam store page for the provided app.
@@ -74,7 +91,7 @@ public:
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|Friends")
-	void ActivateGameOverlayToStore(int32 AppID, ESteamOverlayToStoreFlag eFlag) { SteamFriends()->ActivateGameOverlayToStore(AppID, (EOverlayToStoreFlag)eFlag); }
+	void ActivateGameOverlayToStore(int32 AppID, ESteamOverlayToStoreFlag eFlag) { STEAMBRIDGE_TRACE_SCOPE(USteamFriends::ActivateGameOverlayToStore); SteamBridgeFriends()->ActivateGameOverlayToStore(AppID, (EOverlayToStoreFlag)eFlag); }
 
 	/**
 	 * Activates Steam Overlay to a specific dialog.
@@ -94,15 +111,16 @@ public:
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|Friends")
-	void ActivateGameOverlayToWebPage(const FString& URL, bool bShowModal = false) const { SteamFriends()->ActivateGameOverlayToWebPage(TCHAR_TO_ANSI(*URL), bShowModal ? k_EActivateGameOverlayToWebPageMode_Modal : k_EActivateGameOverlayToWebPageMode_Default); }
+	void ActivateGameOverlayToWebPage(const FString& URL, bool bShowModal = false) const { STEAMBRIDGE_TRACE_SCOPE(USteamFriends::ActivateGameOverlayToWebPage); SteamBridgeFriends()->ActivateGameOverlayToWebPage(TCHAR_TO_ANSI(*URL), bShowModal ? k_EActivateGameOverlayToWebPageMode_Modal : k_EActivateGameOverlayToWebPageMode_Default); }
 
 	/**
 	 * Clears all of the current user's Rich Presence key/values.
+	 * Like SetRichPresence this is published with the next batch, keys set again before then with the value they had aren't touched.
 	 *
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|Friends")
-	void ClearRichPresence() { SteamFriends()->ClearRichPresence(); }
+	void ClearRichPresence() { STEAMBRIDGE_TRACE_SCOPE(USteamFriends::ClearRichPresence); m_RichPresence.Clear(); }
 
 	/**
 	 * Closes the specified Steam group chat room in the Steam UI.
@@ -111,22 +129,41 @@ public:
 	 * @return bool
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
-	bool CloseClanChatWindowInSteam(FSteamID SteamIDClanChat) const { return SteamFriends()->CloseClanChatWindowInSteam(SteamIDClanChat.Value); }
+	bool CloseClanChatWindowInSteam(FSteamID SteamIDClanChat) const { STEAMBRIDGE_TRACE_SCOPE(USteamFriends::CloseClanChatWindowInSteam); return SteamBridgeFriends()->CloseClanChatWindowInSteam(SteamIDClanChat.Value); }
 
 	/**
 	 * Refresh the Steam Group activity data or get the data from groups other than one that the current user is a member.
 	 * After receiving the callback you can then use GetClanActivityCounts to get the up to date user counts.
+	 * See RefreshClanActivityCounts to refresh every group the current user is in.
+	 *
+	 * @param const TArray<FSteamID> & SteamClanIDs The groups to refresh
+	 * @return FSteamAPICall
+	 */
+	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
+	FSteamAPICall DownloadClanActivityCountsForClans(const TArray<FSteamID>& SteamClanIDs) const;
+
+	/**
+	 * Deprecated, use DownloadClanActivityCountsForClans. Refreshes the first ClansToRequest groups of SteamClanIDs.
 	 *
 	 * @param TArray<FSteamID> & SteamClanIDs
 	 * @param int32 ClansToRequest
 	 * @return FSteamAPICall
 	 */
-	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
+	UE_DEPRECATED(4.25, "Use DownloadClanActivityCountsForClans, which takes the groups to refresh as a const array.")
+	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends", meta = (DeprecatedFunction, DeprecationMessage = "Use DownloadClanActivityCountsForClans"))
 	FSteamAPICall DownloadClanActivityCounts(TArray<FSteamID>& SteamClanIDs, int32 ClansToRequest = 1) const;
 
+	/**
+	 * C++ only, requests the activity counts of the given clans and delivers the result to the returned future. m_OnDownloadClanActivityCountsResult is still broadcast as well.
+	 *
+	 * @param const TArray<FSteamID> & SteamClanIDs
+	 * @return TFuture<TSteamCallResult<DownloadClanActivityCountsResult_t>>
+	 */
+	TFuture<TSteamCallResult<DownloadClanActivityCountsResult_t>> DownloadClanActivityCountsAsync(const TArray<FSteamID>& SteamClanIDs) const;
+
 	#if 0
 UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
-	FSteamAPICall EnumerateFollowingList() const { return SteamFriends()->EnumerateFollowingList(0); }
+	FSteamAPICall EnumerateFollowingList() const { STEAMBRIDGE_TRACE_SCOPE(USteamFriends::EnumerateFollowingList); return FSteamBridgeTrace::APICallIssued(SteamBridgeFriends()->EnumerateFollowingList(0)); }
 #endif // 0
 
 	/**
@@ -138,11 +175,11 @@ UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
 	 * @return FSteamID
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
-	FSteamID GetChatMemberByIndex(FSteamID SteamIDClan, int32 UserIndex) const { return SteamFriends()->GetChatMemberByIndex(SteamIDClan.Value, UserIndex).ConvertToUint64(); }
+	FSteamID GetChatMemberByIndex(FSteamID SteamIDClan, int32 UserIndex) const { STEAMBRIDGE_TRACE_SCOPE(USteamFriends::GetChatMemberByIndex); return SteamBridgeFriends()->GetChatMemberByIndex(SteamIDClan.Value, UserIndex).ConvertToUint64(); }
 
 	/**
 	 * Gets the most recent information we have about what the users in a Steam Group are doing.
-	 * This can only retrieve data that the local client knows about. To refresh the data or get data from a group other than one that the current user is a member of you must call DownloadClanActivityCounts.
+	 * This can only retrieve data that the local client knows about. To refresh the data or get data from a group other than one that the current user is a member of you must call DownloadClanActivityCountsForClans.
 	 *
 	 * @param FSteamID SteamIDClan
 	 * @param int32 & Online
@@ -151,7 +188,7 @@ UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
 	 * @return bool
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
-	bool GetClanActivityCounts(FSteamID SteamIDClan, int32& Online, int32& InGame, int32& Chatting) { return SteamFriends()->GetClanActivityCounts(SteamIDClan.Value, &Online, &InGame, &Chatting); }
+	bool GetClanActivityCounts(FSteamID SteamIDClan, int32& Online, int32& InGame, int32& Chatting) { STEAMBRIDGE_TRACE_SCOPE(USteamFriends::GetClanActivityCounts); return SteamBridgeFriends()->GetClanActivityCounts(SteamIDClan.Value, &Online, &InGame, &Chatting); }
 
 	/**
 	 * Gets the Steam group's Steam ID at the given index.
@@ -160,7 +197,7 @@ UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
 	 * @return FSteamID
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
-	FSteamID GetClanByIndex(int32 ClanIndex) const { return SteamFriends()->GetClanByIndex(ClanIndex).ConvertToUint64(); }
+	FSteamID GetClanByIndex(int32 ClanIndex) const { STEAMBRIDGE_TRACE_SCOPE(USteamFriends::GetClanByIndex); return SteamBridgeFriends()->GetClanByIndex(ClanIndex).ConvertToUint64(); }
 
 	/**
 	 * Get the number of users in a Steam group chat.
@@ -172,7 +209,7 @@ UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
 	 * @return int32
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
-	int32 GetClanChatMemberCount(FSteamID SteamIDClan) const { return SteamFriends()->GetClanChatMemberCount(SteamIDClan.Value); }
+	int32 GetClanChatMemberCount(FSteamID SteamIDClan) const { STEAMBRIDGE_TRACE_SCOPE(USteamFriends::GetClanChatMemberCount); return SteamBridgeFriends()->GetClanChatMemberCount(SteamIDClan.Value); }
 
 	/**
 	 * Gets the data from a Steam group chat room message.
@@ -195,7 +232,7 @@ UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
 	 * @return int32
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
-	int32 GetClanCount() const { return SteamFriends()->GetClanCount(); }
+	int32 GetClanCount() const { STEAMBRIDGE_TRACE_SCOPE(USteamFriends::GetClanCount); return SteamBridgeFriends()->GetClanCount(); }
 
 	/**
 	 * Gets the display name for the specified Steam group; if the local client knows about it.
@@ -204,7 +241,7 @@ UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
 	 * @return FString
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
-	FString GetClanName(FSteamID SteamIDClan) const { return SteamFriends()->GetClanName(SteamIDClan.Value); }
+	FString GetClanName(FSteamID SteamIDClan) const { STEAMBRIDGE_TRACE_SCOPE(USteamFriends::GetClanName); return SteamBridgeFriends()->GetClanName(SteamIDClan.Value); }
 
 	/**
 	 * Gets the Steam ID of the officer at the given index in a Steam group.
@@ -215,7 +252,7 @@ UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
 	 * @return FSteamID
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
-	FSteamID GetClanOfficerByIndex(FSteamID SteamIDClan, int32 OfficerIndex) const { return SteamFriends()->GetClanOfficerByIndex(SteamIDClan.Value, OfficerIndex).ConvertToUint64(); }
+	FSteamID GetClanOfficerByIndex(FSteamID SteamIDClan, int32 OfficerIndex) const { STEAMBRIDGE_TRACE_SCOPE(USteamFriends::GetClanOfficerByIndex); return SteamBridgeFriends()->GetClanOfficerByIndex(SteamIDClan.Value, OfficerIndex).ConvertToUint64(); }
 
 	/**
 	 * Gets the number of officers (administrators and moderators) in a specified Steam group.
@@ -227,7 +264,7 @@ UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
 	 * @return int32
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
-	int32 GetClanOfficerCount(FSteamID SteamIDClan) const { return SteamFriends()->GetClanOfficerCount(SteamIDClan.Value); }
+	int32 GetClanOfficerCount(FSteamID SteamIDClan) const { STEAMBRIDGE_TRACE_SCOPE(USteamFriends::GetClanOfficerCount); return SteamBridgeFriends()->GetClanOfficerCount(SteamIDClan.Value); }
 
 	/**
 	 * Gets the owner of a Steam Group.
@@ -237,7 +274,7 @@ UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
 	 * @return FSteamID
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
-	FSteamID GetClanOwner(FSteamID SteamIDClan) const { return SteamFriends()->GetClanOwner(SteamIDClan.Value).ConvertToUint64(); }
+	FSteamID GetClanOwner(FSteamID SteamIDClan) const { STEAMBRIDGE_TRACE_SCOPE(USteamFriends::GetClanOwner); return SteamBridgeFriends()->GetClanOwner(SteamIDClan.Value).ConvertToUint64(); }
 
 	/**
 	 * Gets the unique tag (abbreviation) for the specified Steam group; If the local client knows about it.
@@ -247,7 +284,77 @@ UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
 	 * @return FString
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
-	FString GetClanTag(FSteamID SteamIDClan) const { return SteamFriends()->GetClanTag(SteamIDClan.Value); }
+	FString GetClanTag(FSteamID SteamIDClan) const { STEAMBRIDGE_TRACE_SCOPE(USteamFriends::GetClanTag); return SteamBridgeFriends()->GetClanTag(SteamIDClan.Value); }
+
+	/**
+	 * C++ only, gets the clan cache: every Steam group the current user is in with its name, tag, flags and activity counts, read from Steam in one pass on first use.
+	 * Call RefreshClanCache when the user's groups may have changed, and RefreshClanActivityCounts to download up to date activity counts.
+	 *
+	 * @return const FSteamClanCache&
+	 */
+	const FSteamClanCache& GetClanCache() const;
+
+	/**
+	 * Copies every Steam group the current user is in from the clan cache, without calling into Steam after the first use. Pass the same array each time to reuse it.
+	 *
+	 * @param TArray<FSteamClanInfo> & Clans
+	 * @return void
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|Friends")
+	void GetCachedClans(UPARAM(ref) TArray<FSteamClanInfo>& Clans) const { STEAMBRIDGE_TRACE_SCOPE(USteamFriends::GetCachedClans); Clans = GetClanCache().GetClans(); }
+
+	/**
+	 * Gets a Steam group the current user is in from the clan cache.
+	 *
+	 * @param FSteamID SteamIDClan
+	 * @param FSteamClanInfo & Clan
+	 * @return bool false if the user isn't in the group
+	 */
+	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
+	bool GetCachedClan(FSteamID SteamIDClan, FSteamClanInfo& Clan) const;
+
+	/**
+	 * Gets a number that changes whenever the clan cache does, so a widget can skip refreshing while it's the same.
+	 *
+	 * @return int32
+	 */
+	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
+	int32 GetClanCacheVersion() const { return (int32)GetClanCache().GetVersion(); }
+
+	/**
+	 * Reads the Steam groups the current user is in again.
+	 *
+	 * @return void
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|Friends")
+	void RefreshClanCache();
+
+	/**
+	 * Downloads the activity counts of every Steam group in the clan cache, a batch of groups per DownloadClanActivityCounts call and one call at a time.
+	 * Each batch updates the cache (and its version) as it arrives. Does nothing while a previous refresh is still going.
+	 *
+	 * @return void
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|Friends")
+	void RefreshClanActivityCounts();
+
+	/**
+	 * Gets the officers of a Steam group (owner first) from the clan cache, once GetClanOfficersAsync or RequestClanOfficerList has completed for it.
+	 *
+	 * @param FSteamID SteamIDClan
+	 * @param TArray<FSteamID> & Officers
+	 * @return bool false if the officers haven't been read yet
+	 */
+	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
+	bool GetCachedClanOfficers(FSteamID SteamIDClan, TArray<FSteamID>& Officers) const;
+
+	/**
+	 * C++ only, requests the officer list of a Steam group and reads it into the clan cache.
+	 *
+	 * @param FSteamID SteamIDClan
+	 * @return TFuture<TArray<FSteamID>> The officers (owner first), empty if the request failed
+	 */
+	TFuture<TArray<FSteamID>> GetClanOfficersAsync(FSteamID SteamIDClan) const;
 
 	/**
 	 * Gets the Steam ID of the recently played with user at the given index.
@@ -257,7 +364,7 @@ UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
 	 * @return FSteamID
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
-	FSteamID GetCoplayFriend(int32 CoplayFriendIndex) const { return SteamFriends()->GetCoplayFriend(CoplayFriendIndex).ConvertToUint64(); }
+	FSteamID GetCoplayFriend(int32 CoplayFriendIndex) const { STEAMBRIDGE_TRACE_SCOPE(USteamFriends::GetCoplayFriend); return SteamBridgeFriends()->GetCoplayFriend(CoplayFriendIndex).ConvertToUint64(); }
 
 	/**
 	 * Gets the number of players that the current users has recently played with, across all games.
@@ -267,16 +374,20 @@ UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
 	 * @return int32
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
-	int32 GetCoplayFriendCount() const { return SteamFriends()->GetCoplayFriendCount(); }
+	int32 GetCoplayFriendCount() const { STEAMBRIDGE_TRACE_SCOPE(USteamFriends::GetCoplayFriendCount); return SteamBridgeFriends()->GetCoplayFriendCount(); }
 
 	/**
 	 * Gets the number of users following the specified user.
+	 * While a request for the same user is in flight its call is shared instead of issuing another one.
 	 *
 	 * @param FSteamID SteamID
 	 * @return int32
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
-	int32 GetFollowerCount(FSteamID SteamID) const { return SteamFriends()->GetFollowerCount(SteamID.Value); }
+	int32 GetFollowerCount(FSteamID SteamID) const;
+
+	/** C++ only, delivers the result to the returned future. m_OnFriendsGetFollowerCount is still broadcast as well. Served from the request memo when it's fresh. */
+	TFuture<TSteamCallResult<FriendsGetFollowerCount_t>> GetFollowerCountAsync(FSteamID SteamID) const;
 
 	/**
 	 * Gets the Steam ID of the user at the given index.
@@ -289,6 +400,19 @@ UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
 	FSteamID GetFriendByIndex(int32 FriendIndex, const TArray<ESteamFriendFlags>& FriendFlags) const;
 
+	/** C++ only, takes the flags already combined, e.g. ESteamFriendFlags::Immediate | ESteamFriendFlags::ClanMember. */
+	FSteamID GetFriendByIndex(int32 FriendIndex, FSteamFriendFlags FriendFlags) const { STEAMBRIDGE_TRACE_SCOPE(USteamFriends::GetFriendByIndex); return SteamBridgeFriends()->GetFriendByIndex(FriendIndex, (int32)FriendFlags.GetBits()).ConvertToUint64(); }
+
+	/**
+	 * Same as GetFriendByIndex but takes the flags as a bitmask, which doesn't have to be rebuilt on every call.
+	 *
+	 * @param int32 FriendIndex
+	 * @param int32 FriendFlags
+	 * @return FSteamID
+	 */
+	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends", meta = (DisplayName = "Get Friend By Index (Bitmask)"))
+	FSteamID GetFriendByIndexWithBitmask(int32 FriendIndex, UPARAM(meta = (Bitmask, BitmaskEnum = ESteamFriendFlags)) int32 FriendFlags) const { return GetFriendByIndex(FriendIndex, FSteamFriendFlags::FromBitmask(FriendFlags)); }
+
 	/**
 	 * Gets the app ID of the game that user played with someone on their recently-played-with list.
 	 *
@@ -296,7 +420,7 @@ UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
 	 * @return int32
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
-	int32 GetFriendCoplayGame(FSteamID SteamIDFriend) const { return SteamFriends()->GetFriendCoplayGame(SteamIDFriend.Value); }
+	int32 GetFriendCoplayGame(FSteamID SteamIDFriend) const { STEAMBRIDGE_TRACE_SCOPE(USteamFriends::GetFriendCoplayGame); return SteamBridgeFriends()->GetFriendCoplayGame(SteamIDFriend.Value); }
 
 	/**
 	 * Gets the number of users the client knows about who meet a specified criteria. (Friends, blocked, users on the same server, etc)
@@ -308,6 +432,81 @@ UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
 	int32 GetFriendCount(const TArray<ESteamFriendFlags>& FriendFlags) const;
 
+	/** C++ only, takes the flags already combined, e.g. ESteamFriendFlags::Immediate | ESteamFriendFlags::ClanMember. */
+	int32 GetFriendCount(FSteamFriendFlags FriendFlags) const { STEAMBRIDGE_TRACE_SCOPE(USteamFriends::GetFriendCount); return SteamBridgeFriends()->GetFriendCount((int32)FriendFlags.GetBits()); }
+
+	/**
+	 * Same as GetFriendCount but takes the flags as a bitmask, which doesn't have to be rebuilt on every call.
+	 *
+	 * @param int32 FriendFlags
+	 * @return int32
+	 */
+	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends", meta = (DisplayName = "Get Friend Count (Bitmask)"))
+	int32 GetFriendCountWithBitmask(UPARAM(meta = (Bitmask, BitmaskEnum = ESteamFriendFlags)) int32 FriendFlags) const { return GetFriendCount(FSteamFriendFlags::FromBitmask(FriendFlags)); }
+
+	/**
+	 * C++ only, gets the immediate friends with their persona name, state, game and Steam level, without calling into Steam.
+	 * The first call builds the snapshot, after that it's kept up to date from PersonaStateChange and FriendRichPresenceUpdate.
+	 * The returned snapshot never changes, call this again (or compare GetFriendsSnapshotVersion) to pick up changes. Changes are published once per frame,
+	 * after that frame's callbacks have been dispatched.
+	 *
+	 * @return TSharedRef<const FSteamFriendsSnapshot>
+	 */
+	TSharedRef<const FSteamFriendsSnapshot> GetFriendsSnapshot() const;
+
+	/**
+	 * Changes whenever the friends snapshot does, so a friend list only needs to refresh when it differs from last time.
+	 *
+	 * @return int32
+	 */
+	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
+	int32 GetFriendsSnapshotVersion() const { return (int32)GetFriendsSnapshot()->GetVersion(); }
+
+	/**
+	 * Gets the number of friends in the friends snapshot.
+	 *
+	 * @return int32
+	 */
+	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
+	int32 GetFriendsSnapshotCount() const { return GetFriendsSnapshot()->Num(); }
+
+	/**
+	 * Gets a friend from the friends snapshot, see GetFriendsSnapshotCount.
+	 *
+	 * @param int32 Index
+	 * @param FSteamID & SteamID
+	 * @param FString & PersonaName
+	 * @param ESteamPersonaState & PersonaState
+	 * @param FSteamID & GameID 0 when they aren't in a game
+	 * @param int32 & SteamLevel
+	 * @return bool false if the index is out of range
+	 */
+	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
+	bool GetFriendsSnapshotEntry(int32 Index, FSteamID& SteamID, FString& PersonaName, ESteamPersonaState& PersonaState, FSteamID& GameID, int32& SteamLevel) const;
+
+	/**
+	 * C++ only, gets every friend matching FriendFlags with the requested fields in one pass, into arrays that are reused between calls.
+	 * Rich presence is only available for friends playing the same game unless RequestFriendRichPresence was called for them.
+	 *
+	 * @param FSteamFriendFlags FriendFlags
+	 * @param FSteamFriendQueryFields Fields
+	 * @param FSteamFriendsQueryResult & Result
+	 * @return int32 The number of friends
+	 */
+	int32 QueryFriends(FSteamFriendFlags FriendFlags, FSteamFriendQueryFields Fields, FSteamFriendsQueryResult& Result) const;
+
+	/**
+	 * Gets every friend matching FriendFlags with the requested fields in one call. Keep the result around and pass it again to reuse its arrays.
+	 * Rich presence is only available for friends playing the same game unless RequestFriendRichPresence was called for them.
+	 *
+	 * @param int32 FriendFlags
+	 * @param int32 Fields
+	 * @param FSteamFriendsQueryResult & Result
+	 * @return int32 The number of friends
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|Friends")
+	int32 QueryFriendsWithBitmask(UPARAM(meta = (Bitmask, BitmaskEnum = ESteamFriendFlags)) int32 FriendFlags, UPARAM(meta = (Bitmask, BitmaskEnum = ESteamFriendQueryFields)) int32 Fields, UPARAM(ref) FSteamFriendsQueryResult& Result) const { return QueryFriends(FSteamFriendFlags::FromBitmask(FriendFlags), FSteamFriendQueryFields::FromBitmask(Fields), Result); }
+
 	/**
 	 * Get the number of users in a source (Steam group, chat room, lobby, or game server).
 	 * Large Steam groups cannot be iterated by the local user.
@@ -318,7 +517,7 @@ UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
 	 * @return int32
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
-	int32 GetFriendCountFromSource(FSteamID SteamIDSource) const { return SteamFriends()->GetFriendCountFromSource(SteamIDSource.Value); }
+	int32 GetFriendCountFromSource(FSteamID SteamIDSource) const { STEAMBRIDGE_TRACE_SCOPE(USteamFriends::GetFriendCountFromSource); return SteamBridgeFriends()->GetFriendCountFromSource(SteamIDSource.Value); }
 
 	/**
 	 * Gets the Steam ID at the given index from a source (Steam group, chat room, lobby, or game server).
@@ -329,7 +528,7 @@ UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
 	 * @return FSteamID
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
-	FSteamID GetFriendFromSourceByIndex(FSteamID SteamIDSource, int32 FriendIndex) const { return SteamFriends()->GetFriendFromSourceByIndex(SteamIDSource.Value, FriendIndex).ConvertToUint64(); }
+	FSteamID GetFriendFromSourceByIndex(FSteamID SteamIDSource, int32 FriendIndex) const { STEAMBRIDGE_TRACE_SCOPE(USteamFriends::GetFriendFromSourceByIndex); return SteamBridgeFriends()->GetFriendFromSourceByIndex(SteamIDSource.Value, FriendIndex).ConvertToUint64(); }
 
 	/**
 	 * Checks if the specified friend is in a game, and gets info about the game if they are.
@@ -358,6 +557,49 @@ UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
 	int32 GetFriendMessage(FSteamID SteamIDFriend, int32 MessageIndex, FString& Message, ESteamChatEntryType& ChatEntryType);
 
+	/**
+	 * Gets how many messages the chat history has for a clan chat or friend (see Chat History Length).
+	 * Clan chats are kept once joined with JoinClanChatRoom, friends while SetListenForFriendsMessages is enabled.
+	 *
+	 * @param FSteamID SteamIDChat The clan chat or friend
+	 * @return int32
+	 */
+	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
+	int32 GetChatHistoryCount(FSteamID SteamIDChat) const { return m_ChatHistory.Num(SteamIDChat.Value); }
+
+	/**
+	 * Gets a message from the chat history without calling into Steam, oldest first.
+	 *
+	 * @param FSteamID SteamIDChat The clan chat or friend
+	 * @param int32 Index From 0 to GetChatHistoryCount - 1
+	 * @param FSteamChatMessage & Message
+	 * @return bool Whether the index was in range
+	 */
+	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
+	bool GetChatHistoryMessage(FSteamID SteamIDChat, int32 Index, FSteamChatMessage& Message) const;
+
+	/**
+	 * Copies every message the chat history has for a clan chat or friend, oldest first. Pass the same array each time to reuse it.
+	 *
+	 * @param FSteamID SteamIDChat The clan chat or friend
+	 * @param TArray<FSteamChatMessage> & Messages
+	 * @return void
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|Friends")
+	void CopyChatHistory(FSteamID SteamIDChat, UPARAM(ref) TArray<FSteamChatMessage>& Messages) const { m_ChatHistory.CopyTo(SteamIDChat.Value, Messages); }
+
+	/**
+	 * Forgets the chat history for a clan chat or friend.
+	 *
+	 * @param FSteamID SteamIDChat The clan chat or friend
+	 * @return void
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|Friends")
+	void ClearChatHistory(FSteamID SteamIDChat) { m_ChatHistory.Remove(SteamIDChat.Value); }
+
+	/** C++ only, reads the chat history without copying the messages. */
+	const FSteamChatHistory& GetChatHistory() const { return m_ChatHistory; }
+
 	/**
 	 * Gets the specified user's persona (display) name.
 	 * This will only be known to the current user if the other user is in their friends list, on the same game server, in a chat room or lobby, or in a small Steam group with the local user.
@@ -368,7 +610,7 @@ UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
 	 * @return FString
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
-	FString GetFriendPersonaName(FSteamID SteamIDFriend) const { return SteamFriends()->GetFriendPersonaName(SteamIDFriend.Value); }
+	FString GetFriendPersonaName(FSteamID SteamIDFriend) const { STEAMBRIDGE_TRACE_SCOPE(USteamFriends::GetFriendPersonaName); return SteamBridgeFriends()->GetFriendPersonaName(SteamIDFriend.Value); }
 
 	/**
 	 * Gets one of the previous display names for the specified user.
@@ -379,7 +621,7 @@ UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
 	 * @return FString
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
-	FString GetFriendPersonaNameHistory(FSteamID SteamIDFriend, int32 NameHistoryIndex = 0) const { return SteamFriends()->GetFriendPersonaNameHistory(SteamIDFriend.Value, NameHistoryIndex); }
+	FString GetFriendPersonaNameHistory(FSteamID SteamIDFriend, int32 NameHistoryIndex = 0) const { STEAMBRIDGE_TRACE_SCOPE(USteamFriends::GetFriendPersonaNameHistory); return SteamBridgeFriends()->GetFriendPersonaNameHistory(SteamIDFriend.Value, NameHistoryIndex); }
 
 	/**
 	 * Gets the current status of the specified user.
@@ -390,7 +632,7 @@ UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
 	 * @return ESteamPersonaState
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
-	ESteamPersonaState GetFriendPersonaState(FSteamID SteamIDFriend) const { return (ESteamPersonaState)SteamFriends()->GetFriendPersonaState(SteamIDFriend.Value); }
+	ESteamPersonaState GetFriendPersonaState(FSteamID SteamIDFriend) const { STEAMBRIDGE_TRACE_SCOPE(USteamFriends::GetFriendPersonaState); return (ESteamPersonaState)SteamBridgeFriends()->GetFriendPersonaState(SteamIDFriend.Value); }
 
 	/**
 	 * Gets a relationship to a specified user.
@@ -399,17 +641,28 @@ UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
 	 * @return ESteamFriendRelationship
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
-	ESteamFriendRelationship GetFriendRelationship(FSteamID SteamIDFriend) const { return (ESteamFriendRelationship)SteamFriends()->GetFriendRelationship(SteamIDFriend.Value); }
+	ESteamFriendRelationship GetFriendRelationship(FSteamID SteamIDFriend) const { STEAMBRIDGE_TRACE_SCOPE(USteamFriends::GetFriendRelationship); return (ESteamFriendRelationship)SteamBridgeFriends()->GetFriendRelationship(SteamIDFriend.Value); }
 
 	/**
 	 * Get a Rich Presence value from a specified friend.
+	 * Every key of the friend is cached on the first read and kept until FriendRichPresenceUpdate reports a change for them, so later reads don't call into Steam.
 	 *
 	 * @param FSteamID SteamIDFriend
 	 * @param const FString & Key
 	 * @return FString
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
-	FString GetFriendRichPresence(FSteamID SteamIDFriend, const FString& Key) const { return SteamFriends()->GetFriendRichPresence(SteamIDFriend.Value, TCHAR_TO_ANSI(*Key)); }
+	FString GetFriendRichPresence(FSteamID SteamIDFriend, const FString& Key) const;
+
+	/**
+	 * Same as GetFriendRichPresence but takes an interned key, see FSteamKeys.
+	 *
+	 * @param FSteamID SteamIDFriend
+	 * @param FSteamKey Key
+	 * @return FString
+	 */
+	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
+	FString GetFriendRichPresenceByKey(FSteamID SteamIDFriend, FSteamKey Key) const;
 
 	/**
 	 * Get a Rich Presence value from a specified friend by index.
@@ -419,7 +672,7 @@ UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
 	 * @return FString
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
-	FString GetFriendRichPresenceKeyByIndex(FSteamID SteamIDFriend, int32 KeyIndex) const { return SteamFriends()->GetFriendRichPresenceKeyByIndex(SteamIDFriend.Value, KeyIndex); }
+	FString GetFriendRichPresenceKeyByIndex(FSteamID SteamIDFriend, int32 KeyIndex) const { STEAMBRIDGE_TRACE_SCOPE(USteamFriends::GetFriendRichPresenceKeyByIndex); return UTF8_TO_TCHAR(GetFriendRichPresenceCache().GetKey(SteamIDFriend.Value, KeyIndex)); }
 
 	/**
 	 * Gets the number of Rich Presence keys that are set on the specified user.
@@ -430,7 +683,30 @@ UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
 	 * @return int32
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
-	int32 GetFriendRichPresenceKeyCount(FSteamID SteamIDFriend) const { return SteamFriends()->GetFriendRichPresenceKeyCount(SteamIDFriend.Value); }
+	int32 GetFriendRichPresenceKeyCount(FSteamID SteamIDFriend) const { STEAMBRIDGE_TRACE_SCOPE(USteamFriends::GetFriendRichPresenceKeyCount); return GetFriendRichPresenceCache().NumKeys(SteamIDFriend.Value); }
+
+	/**
+	 * Finds every friend whose rich presence key has the value, e.g. everyone whose "status" is "In match".
+	 * Covers the immediate friends and anyone RequestFriendRichPresence was called for, from the rich presence cache: only friends whose rich presence changed since the last read call into Steam.
+	 *
+	 * @param const FString & Key
+	 * @param const FString & Value Compared case sensitively
+	 * @param TArray<FSteamID> & SteamIDs
+	 * @return void
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|Friends")
+	void FindFriendsWithRichPresence(const FString& Key, const FString& Value, UPARAM(ref) TArray<FSteamID>& SteamIDs) const { STEAMBRIDGE_TRACE_SCOPE(USteamFriends::FindFriendsWithRichPresence); GetFriendRichPresenceCache().FindUsers(TCHAR_TO_UTF8(*Key), Value, SteamIDs); }
+
+	/**
+	 * Same as FindFriendsWithRichPresence but takes an interned key, see FSteamKeys.
+	 *
+	 * @param FSteamKey Key
+	 * @param const FString & Value
+	 * @param TArray<FSteamID> & SteamIDs
+	 * @return void
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|Friends")
+	void FindFriendsWithRichPresenceByKey(FSteamKey Key, const FString& Value, UPARAM(ref) TArray<FSteamID>& SteamIDs) const { STEAMBRIDGE_TRACE_SCOPE(USteamFriends::FindFriendsWithRichPresenceByKey); GetFriendRichPresenceCache().FindUsers(FSteamKeys::ToUTF8(Key), Value, SteamIDs); }
 
 	/**
 	 * Gets the number of friends groups (tags) the user has created.
@@ -440,7 +716,7 @@ UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
 	 * @return int32
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
-	int32 GetFriendsGroupCount() const { return SteamFriends()->GetFriendsGroupCount(); }
+	int32 GetFriendsGroupCount() const { STEAMBRIDGE_TRACE_SCOPE(USteamFriends::GetFriendsGroupCount); return SteamBridgeFriends()->GetFriendsGroupCount(); }
 
 	/**
 	 * Gets the friends group ID for the given index.
@@ -450,7 +726,7 @@ UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
 	 * @return FSteamFriendsGroupID
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
-	FSteamFriendsGroupID GetFriendsGroupIDByIndex(int32 GroupIndex = 0) const { return SteamFriends()->GetFriendsGroupIDByIndex(GroupIndex); }
+	FSteamFriendsGroupID GetFriendsGroupIDByIndex(int32 GroupIndex = 0) const { STEAMBRIDGE_TRACE_SCOPE(USteamFriends::GetFriendsGroupIDByIndex); return SteamBridgeFriends()->GetFriendsGroupIDByIndex(GroupIndex); }
 
 	/**
 	 * Gets the number of friends in a given friends group.
@@ -460,7 +736,7 @@ UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
 	 * @return int32
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
-	int32 GetFriendsGroupMembersCount(FSteamFriendsGroupID FriendsGroupID) const { return SteamFriends()->GetFriendsGroupMembersCount(FriendsGroupID.Value); }
+	int32 GetFriendsGroupMembersCount(FSteamFriendsGroupID FriendsGroupID) const { STEAMBRIDGE_TRACE_SCOPE(USteamFriends::GetFriendsGroupMembersCount); return SteamBridgeFriends()->GetFriendsGroupMembersCount(FriendsGroupID.Value); }
 
 	/**
 	 * Gets the number of friends in the given friends group.
@@ -481,7 +757,7 @@ UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
 	 * @return FString
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
-	FString GetFriendsGroupName(FSteamFriendsGroupID FriendsGroupID) const { return SteamFriends()->GetFriendsGroupName(FriendsGroupID.Value); }
+	FString GetFriendsGroupName(FSteamFriendsGroupID FriendsGroupID) const { STEAMBRIDGE_TRACE_SCOPE(USteamFriends::GetFriendsGroupName); return SteamBridgeFriends()->GetFriendsGroupName(FriendsGroupID.Value); }
 
 	/**
 	 * Gets the Steam level of the specified user.
@@ -491,10 +767,12 @@ UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
 	 * @return int32
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
-	int32 GetFriendSteamLevel(FSteamID SteamIDFriend) const { return SteamFriends()->GetFriendSteamLevel(SteamIDFriend.Value); }
+	int32 GetFriendSteamLevel(FSteamID SteamIDFriend) const { STEAMBRIDGE_TRACE_SCOPE(USteamFriends::GetFriendSteamLevel); return SteamBridgeFriends()->GetFriendSteamLevel(SteamIDFriend.Value); }
 
 	/**
 	 * Gets a handle to the avatar for the specified user.
+	 * The texture is cached (see Avatar Cache Budget) and reused until Steam reloads the image, don't modify it.
+	 * If the avatar is still loading this returns the one stored last session (see Use Avatar Disk Cache) or nullptr, and Steam's texture is ready to be fetched once OnAvatarImageLoaded fires.
 	 * You can pass in ISteamUser::GetSteamID to get the current users avatar.
 	 * This only works for users that the local user knows about. They will automatically know about their friends, people on leaderboards they've requested, or people in the same source as them -
 	 * (Steam group, chat room, lobby, or game server). If they don't know about them then you must call RequestUserInformation to cache the avatar locally.
@@ -506,6 +784,30 @@ UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
 	UTexture2D* GetFriendAvatar(FSteamID SteamIDFriend, ESteamAvatarSize AvatarSize) const;
 
+	/**
+	 * Gets the avatar for the specified user as a rect of a texture page shared with other avatars of the same size, for lists showing many avatars at once.
+	 * The slot may be given to another avatar once it hasn't been asked for in a while (see Avatar Atlas Max Pages), so ask again rather than keeping it.
+	 * If the avatar is still loading this returns false, and the slot is ready to be fetched once OnAvatarImageLoaded fires.
+	 *
+	 * @param FSteamID SteamIDFriend
+	 * @param ESteamAvatarSize AvatarSize
+	 * @param UTexture2D * & Page
+	 * @param FBox2D & UV
+	 * @return bool
+	 */
+	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
+	bool GetFriendAvatarAtlasSlot(FSteamID SteamIDFriend, ESteamAvatarSize AvatarSize, UTexture2D*& Page, FBox2D& UV) const;
+
+	/**
+	 * Same as GetFriendAvatarAtlasSlot but as a brush for UMG and Slate. The brush has no resource if the avatar isn't available.
+	 *
+	 * @param FSteamID SteamIDFriend
+	 * @param ESteamAvatarSize AvatarSize
+	 * @return FSlateBrush
+	 */
+	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
+	FSlateBrush MakeFriendAvatarBrush(FSteamID SteamIDFriend, ESteamAvatarSize AvatarSize) const;
+
 	/**
 	 * Gets the current users persona (display) name.
 	 * This is the same name that is displayed the users community profile page.
@@ -514,7 +816,7 @@ UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
 	 * @return FString
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
-	FString GetPersonaName() const { return SteamFriends()->GetPersonaName(); }
+	FString GetPersonaName() const { STEAMBRIDGE_TRACE_SCOPE(USteamFriends::GetPersonaName); return SteamBridgeFriends()->GetPersonaName(); }
 
 	/**
 	 * Gets the friend status of the current user.
@@ -523,7 +825,7 @@ UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
 	 * @return ESteamPersonaState
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
-	ESteamPersonaState GetPersonaState() const { return (ESteamPersonaState)SteamFriends()->GetPersonaState(); }
+	ESteamPersonaState GetPersonaState() const { STEAMBRIDGE_TRACE_SCOPE(USteamFriends::GetPersonaState); return (ESteamPersonaState)SteamBridgeFriends()->GetPersonaState(); }
 
 	/**
 	 * Gets the nickname that the current user has set for the specified user.
@@ -532,7 +834,7 @@ UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
 	 * @return FString
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
-	FString GetPlayerNickname(FSteamID SteamIDPlayer) const { return SteamFriends()->GetPlayerNickname(SteamIDPlayer.Value); }
+	FString GetPlayerNickname(FSteamID SteamIDPlayer) const { STEAMBRIDGE_TRACE_SCOPE(USteamFriends::GetPlayerNickname); return SteamBridgeFriends()->GetPlayerNickname(SteamIDPlayer.Value); }
 
 	/**
 	 * Checks if the user meets the specified criteria. (Friends, blocked, users on the same server, etc)
@@ -542,6 +844,17 @@ UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
 	TArray<ESteamUserRestrictions> GetUserRestrictions() const;
 
+	/** C++ only, gets the restrictions as flags rather than an array. */
+	FSteamUserRestrictions GetUserRestrictionFlags() const { STEAMBRIDGE_TRACE_SCOPE(USteamFriends::GetUserRestrictionFlags); return FSteamUserRestrictions::FromBits(SteamBridgeFriends()->GetUserRestrictions()); }
+
+	/**
+	 * Same as GetUserRestrictions but returns a bitmask of ESteamUserRestrictions, bit (1 << Restriction) is set for each.
+	 *
+	 * @return int32
+	 */
+	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends", meta = (DisplayName = "Get User Restrictions (Bitmask)"))
+	int32 GetUserRestrictionsBitmask() const { return (int32)GetUserRestrictionFlags().GetBits(); }
+
 	/**
 	 * Checks if the user meets the specified criteria. (Friends, blocked, users on the same server, etc)
 	 *
@@ -552,6 +865,19 @@ UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
 	bool HasFriend(FSteamID SteamIDFriend, const TArray<ESteamFriendFlags>& FriendFlags);
 
+	/** C++ only, takes the flags already combined, e.g. ESteamFriendFlags::Immediate | ESteamFriendFlags::ClanMember. */
+	bool HasFriend(FSteamID SteamIDFriend, FSteamFriendFlags FriendFlags) const { STEAMBRIDGE_TRACE_SCOPE(USteamFriends::HasFriend); return SteamBridgeFriends()->HasFriend(SteamIDFriend.Value, (int32)FriendFlags.GetBits()); }
+
+	/**
+	 * Same as HasFriend but takes the flags as a bitmask, which doesn't have to be rebuilt on every call.
+	 *
+	 * @param FSteamID SteamIDFriend
+	 * @param int32 FriendFlags
+	 * @return bool
+	 */
+	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends", meta = (DisplayName = "Has Friend (Bitmask)"))
+	bool HasFriendWithBitmask(FSteamID SteamIDFriend, UPARAM(meta = (Bitmask, BitmaskEnum = ESteamFriendFlags)) int32 FriendFlags) const { return HasFriend(SteamIDFriend, FSteamFriendFlags::FromBitmask(FriendFlags)); }
+
 	/**
 	 * Invites a friend or clan member to the current game using a special invite string.
 	 * If the target user accepts the invite then the pchConnectString gets added to the command-line when launching the game.
@@ -562,7 +888,7 @@ UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
 	 * @return bool
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
-	bool InviteUserToGame(FSteamID SteamIDFriend, const FString& ConnectString) const { return SteamFriends()->InviteUserToGame(SteamIDFriend.Value, TCHAR_TO_UTF8(*ConnectString)); }
+	bool InviteUserToGame(FSteamID SteamIDFriend, const FString& ConnectString) const { STEAMBRIDGE_TRACE_SCOPE(USteamFriends::InviteUserToGame); return SteamBridgeFriends()->InviteUserToGame(SteamIDFriend.Value, TCHAR_TO_UTF8(*ConnectString)); }
 
 	/**
 	 * Checks if a user in the Steam group chat room is an admin.
@@ -572,7 +898,7 @@ UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
 	 * @return bool
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
-	bool IsClanChatAdmin(FSteamID SteamIDClanChat, FSteamID SteamIDUser) const { return SteamFriends()->IsClanChatAdmin(SteamIDClanChat.Value, SteamIDUser.Value); }
+	bool IsClanChatAdmin(FSteamID SteamIDClanChat, FSteamID SteamIDUser) const { STEAMBRIDGE_TRACE_SCOPE(USteamFriends::IsClanChatAdmin); return SteamBridgeFriends()->IsClanChatAdmin(SteamIDClanChat.Value, SteamIDUser.Value); }
 
 	/**
 	 * Checks if the Steam group is public.
@@ -581,7 +907,7 @@ UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
 	 * @return bool
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
-	bool IsClanPublic(FSteamID SteamIDClan) const { return SteamFriends()->IsClanPublic(SteamIDClan.Value); }
+	bool IsClanPublic(FSteamID SteamIDClan) const { STEAMBRIDGE_TRACE_SCOPE(USteamFriends::IsClanPublic); return SteamBridgeFriends()->IsClanPublic(SteamIDClan.Value); }
 
 	/**
 	 * Checks if the Steam group is an official game group/community hub.
@@ -590,7 +916,7 @@ UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
 	 * @return bool
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
-	bool IsClanOfficialGameGroup(FSteamID SteamIDClan) const { return SteamFriends()->IsClanOfficialGameGroup(SteamIDClan.Value); }
+	bool IsClanOfficialGameGroup(FSteamID SteamIDClan) const { STEAMBRIDGE_TRACE_SCOPE(USteamFriends::IsClanOfficialGameGroup); return SteamBridgeFriends()->IsClanOfficialGameGroup(SteamIDClan.Value); }
 
 	/**
 	 * Checks if the Steam Group chat room is open in the Steam UI.
@@ -599,7 +925,7 @@ UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
 	 * @return bool
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
-	bool IsClanChatWindowOpenInSteam(FSteamID SteamIDClanChat) const { return SteamFriends()->IsClanChatWindowOpenInSteam(SteamIDClanChat.Value); }
+	bool IsClanChatWindowOpenInSteam(FSteamID SteamIDClanChat) const { STEAMBRIDGE_TRACE_SCOPE(USteamFriends::IsClanChatWindowOpenInSteam); return SteamBridgeFriends()->IsClanChatWindowOpenInSteam(SteamIDClanChat.Value); }
 
 	/**
 	 * Checks if the current user is following the specified user.
@@ -608,7 +934,10 @@ UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
 	 * @return FSteamAPICall
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
-	FSteamAPICall IsFollowing(FSteamID SteamID) const { return SteamFriends()->IsFollowing(SteamID.Value); }
+	FSteamAPICall IsFollowing(FSteamID SteamID) const { STEAMBRIDGE_TRACE_SCOPE(USteamFriends::IsFollowing); return FSteamBridgeTrace::APICallIssued(SteamBridgeFriends()->IsFollowing(SteamID.Value)); }
+
+	/** C++ only, delivers the result to the returned future. m_OnFriendsIsFollowing is still broadcast as well. */
+	TFuture<TSteamCallResult<FriendsIsFollowing_t>> IsFollowingAsync(FSteamID SteamID) const { return FSteamCallResults::Await<FriendsIsFollowing_t>(IsFollowing(SteamID)); }
 
 	/**
 	 * Checks if a specified user is in a source (Steam group, chat room, lobby, or game server).
@@ -618,7 +947,7 @@ UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
 	 * @return bool
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
-	bool IsUserInSource(FSteamID SteamIDUser, FSteamID SteamIDSource) const { return SteamFriends()->IsUserInSource(SteamIDUser.Value, SteamIDSource.Value); }
+	bool IsUserInSource(FSteamID SteamIDUser, FSteamID SteamIDSource) const { STEAMBRIDGE_TRACE_SCOPE(USteamFriends::IsUserInSource); return SteamBridgeFriends()->IsUserInSource(SteamIDUser.Value, SteamIDSource.Value); }
 
 	/**
 	 * Allows the user to join Steam group (clan) chats right within the game.
@@ -628,12 +957,16 @@ UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
 	 *  GameConnectedClanChatMsg_t
 	 *  GameConnectedChatJoin_t
 	 *  GameConnectedChatLeave_t
+	 * The chat's messages are also kept in the chat history (see GetChatHistoryMessage).
 	 *
 	 * @param FSteamID SteamIDClan
 	 * @return FSteamAPICall
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
-	FSteamAPICall JoinClanChatRoom(FSteamID SteamIDClan) const { return SteamFriends()->JoinClanChatRoom(SteamIDClan.Value); }
+	FSteamAPICall JoinClanChatRoom(FSteamID SteamIDClan) const;
+
+	/** C++ only, delivers the result to the returned future. m_OnJoinClanChatRoomCompletionResult is still broadcast as well. */
+	TFuture<TSteamCallResult<JoinClanChatRoomCompletionResult_t>> JoinClanChatRoomAsync(FSteamID SteamIDClan) const { return FSteamCallResults::Await<JoinClanChatRoomCompletionResult_t>(JoinClanChatRoom(SteamIDClan)); }
 
 	/**
 	 * Leaves a Steam group chat that the user has previously entered with JoinClanChatRoom.
@@ -642,7 +975,7 @@ UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
 	 * @return bool
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
-	bool LeaveClanChatRoom(FSteamID SteamIDClan) const { return SteamFriends()->LeaveClanChatRoom(SteamIDClan.Value); }
+	bool LeaveClanChatRoom(FSteamID SteamIDClan) const { STEAMBRIDGE_TRACE_SCOPE(USteamFriends::LeaveClanChatRoom); return SteamBridgeFriends()->LeaveClanChatRoom(SteamIDClan.Value); }
 
 	/**
 	 * Opens the specified Steam group chat room in the Steam UI.
@@ -651,7 +984,7 @@ UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
 	 * @return bool
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
-	bool OpenClanChatWindowInSteam(FSteamID SteamIDClanChat) const { return SteamFriends()->OpenClanChatWindowInSteam(SteamIDClanChat.Value); }
+	bool OpenClanChatWindowInSteam(FSteamID SteamIDClanChat) const { STEAMBRIDGE_TRACE_SCOPE(USteamFriends::OpenClanChatWindowInSteam); return SteamBridgeFriends()->OpenClanChatWindowInSteam(SteamIDClanChat.Value); }
 
 	/**
 	 * Sends a message to a Steam friend.
@@ -661,40 +994,78 @@ UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
 	 * @return bool
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
-	bool ReplyToFriendMessage(FSteamID SteamIDFriend, const FString& MsgToSend) const { return SteamFriends()->ReplyToFriendMessage(SteamIDFriend.Value, TCHAR_TO_UTF8(*MsgToSend)); }
+	bool ReplyToFriendMessage(FSteamID SteamIDFriend, const FString& MsgToSend) const { STEAMBRIDGE_TRACE_SCOPE(USteamFriends::ReplyToFriendMessage); return SteamBridgeFriends()->ReplyToFriendMessage(SteamIDFriend.Value, TCHAR_TO_UTF8(*MsgToSend)); }
 
 	/**
 	 * Requests information about a Steam group officers (administrators and moderators).
 	 * You can only ask about Steam groups that a user is a member of.
 	 * This won't download avatars for the officers automatically. If no avatar image is available for an officer, then call RequestUserInformation to download the avatar.
+	 * While a request for the same group is in flight its call is shared instead of issuing another one.
 	 *
 	 * @param FSteamID SteamIDClan
 	 * @return FSteamAPICall
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
-	FSteamAPICall RequestClanOfficerList(FSteamID SteamIDClan) const { return SteamFriends()->RequestClanOfficerList(SteamIDClan.Value); }
+	FSteamAPICall RequestClanOfficerList(FSteamID SteamIDClan) const;
+
+	/** C++ only, delivers the result to the returned future. m_OnClanOfficerListResponse is still broadcast as well. Served from the request memo when it's fresh. */
+	TFuture<TSteamCallResult<ClanOfficerListResponse_t>> RequestClanOfficerListAsync(FSteamID SteamIDClan) const;
 
 	/**
 	 * Requests Rich Presence data from a specific user.
 	 * This is used to get the Rich Presence information from a user that is not a friend of the current user, like someone in the same lobby or game server.
 	 * This function is rate limited, if you call this too frequently for a particular user then it will just immediately post a callback without requesting new data from the server.
+	 * The user is added to the rich presence cache, so FindFriendsWithRichPresence includes them.
 	 *
 	 * @param FSteamID SteamIDFriend
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|Friends")
-	void RequestFriendRichPresence(FSteamID SteamIDFriend) { SteamFriends()->RequestFriendRichPresence(SteamIDFriend.Value); }
+	void RequestFriendRichPresence(FSteamID SteamIDFriend) { STEAMBRIDGE_TRACE_SCOPE(USteamFriends::RequestFriendRichPresence); GetFriendRichPresenceCache().Invalidate(SteamIDFriend.Value); SteamBridgeFriends()->RequestFriendRichPresence(SteamIDFriend.Value); }
 
 	/**
 	 * Requests the persona name and optionally the avatar of a specified user.
 	 * It's a lot slower to download avatars and churns the local cache, so if you don't need avatars, don't request them.
+	 * Repeated requests for a user whose information is still on its way (or arrived within the request memo TTL) don't reach Steam.
 	 *
 	 * @param FSteamID SteamIDUser
 	 * @param bool bRequireNameOnly
 	 * @return bool
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
-	bool RequestUserInformation(FSteamID SteamIDUser, bool bRequireNameOnly) const { return SteamFriends()->RequestUserInformation(SteamIDUser.Value, bRequireNameOnly); }
+	bool RequestUserInformation(FSteamID SteamIDUser, bool bRequireNameOnly) const;
+
+	/**
+	 * Queues RequestUserInformation for each user, sent highest priority first with at most Max User Information Requests In Flight waiting on Steam.
+	 * Each user is reported through OnPersonaStateChange as usual. Call CancelUserInformationPrefetch for users that are no longer shown.
+	 *
+	 * @param const TArray<FSteamID> & SteamIDs
+	 * @param int32 Priority Higher is sent first, e.g. the rows on screen above the ones just past it
+	 * @param bool bRequireNameOnly
+	 * @return void
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|Friends")
+	void PrefetchUserInformation(const TArray<FSteamID>& SteamIDs, int32 Priority, bool bRequireNameOnly = true) const { PrefetchUserInformation(MakeArrayView(SteamIDs), Priority, bRequireNameOnly, nullptr); }
+
+	/**
+	 * C++ only, same as PrefetchUserInformation with a future per user.
+	 *
+	 * @param TArrayView<const FSteamID> SteamIDs
+	 * @param int32 Priority
+	 * @param bool bRequireNameOnly
+	 * @param TArray<TFuture<bool>> * Futures If set, gets a future per user (in the same order) set to true once their information is available, false if cancelled or timed out
+	 * @return void
+	 */
+	void PrefetchUserInformation(TArrayView<const FSteamID> SteamIDs, int32 Priority, bool bRequireNameOnly, TArray<TFuture<bool>>* Futures) const;
+
+	/**
+	 * Cancels the queued PrefetchUserInformation requests for the users, requests already sent to Steam still complete.
+	 *
+	 * @param const TArray<FSteamID> & SteamIDs
+	 * @return void
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|Friends")
+	void CancelUserInformationPrefetch(const TArray<FSteamID>& SteamIDs) const;
 
 	/**
 	 * Sends a message to a Steam group chat room.
@@ -704,7 +1075,7 @@ UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
 	 * @return bool
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
-	bool SendClanChatMessage(FSteamID SteamIDClanChat, const FString& Text) const { return SteamFriends()->SendClanChatMessage(SteamIDClanChat.Value, TCHAR_TO_UTF8(*Text)); }
+	bool SendClanChatMessage(FSteamID SteamIDClanChat, const FString& Text) const { STEAMBRIDGE_TRACE_SCOPE(USteamFriends::SendClanChatMessage); return SteamBridgeFriends()->SendClanChatMessage(SteamIDClanChat.Value, TCHAR_TO_UTF8(*Text)); }
 
 	/**
 	 * Let Steam know that the user is currently using voice chat in game.
@@ -715,18 +1086,19 @@ UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|Friends")
-	void SetInGameVoiceSpeaking(FSteamID SteamIDUser, bool bSpeaking) { SteamFriends()->SetInGameVoiceSpeaking(SteamIDUser.Value, bSpeaking); }
+	void SetInGameVoiceSpeaking(FSteamID SteamIDUser, bool bSpeaking) { STEAMBRIDGE_TRACE_SCOPE(USteamFriends::SetInGameVoiceSpeaking); SteamBridgeFriends()->SetInGameVoiceSpeaking(SteamIDUser.Value, bSpeaking); }
 
 	/**
 	 * Listens for Steam friends chat messages.
 	 * You can then show these chats inline in the game. For example with a Blizzard style chat message system or the chat system in Dota 2.
 	 * After enabling this you will receive GameConnectedFriendChatMsg_t callbacks when ever the user receives a chat message. You can get the actual message data from this callback with GetFriendMessage. You can send messages with ReplyToFriendMessage.
+	 * The messages are also kept in the chat history (see GetChatHistoryMessage).
 	 *
 	 * @param bool bInterceptEnabled
 	 * @return bool
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
-	bool SetListenForFriendsMessages(bool bInterceptEnabled) const { return SteamFriends()->SetListenForFriendsMessages(bInterceptEnabled); }
+	bool SetListenForFriendsMessages(bool bInterceptEnabled) const;
 
 	/**
 	 * Sets the current users persona name, stores it on the server and publishes the changes to all friends who are online.
@@ -737,7 +1109,10 @@ UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
 	 * @return FSteamAPICall
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
-	FSteamAPICall SetPersonaName(const FString& PersonaName) const { return SteamFriends()->SetPersonaName(TCHAR_TO_UTF8(*PersonaName)); }
+	FSteamAPICall SetPersonaName(const FString& PersonaName) const { STEAMBRIDGE_TRACE_SCOPE(USteamFriends::SetPersonaName); return FSteamBridgeTrace::APICallIssued(SteamBridgeFriends()->SetPersonaName(TCHAR_TO_UTF8(*PersonaName))); }
+
+	/** C++ only, delivers the result to the returned future. m_OnSetPersonaNameResponse is still broadcast as well. */
+	TFuture<TSteamCallResult<SetPersonaNameResponse_t>> SetPersonaNameAsync(const FString& PersonaName) const { return FSteamCallResults::Await<SetPersonaNameResponse_t>(SetPersonaName(PersonaName)); }
 
 	/**
 	 * Mark a target user as 'played with'.
@@ -747,17 +1122,49 @@ UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|Friends")
-	void SetPlayedWith(FSteamID SteamIDUserPlayedWith) { SteamFriends()->SetPlayedWith(SteamIDUserPlayedWith.Value); }
+	void SetPlayedWith(FSteamID SteamIDUserPlayedWith) { STEAMBRIDGE_TRACE_SCOPE(USteamFriends::SetPlayedWith); SteamBridgeFriends()->SetPlayedWith(SteamIDUserPlayedWith.Value); }
 
 	/**
-	 * Sets a Rich Presence key/value for the current user that is automatically shared to all friends playing the same game.
+	 * Sets a Rich Presence key/value for the current user that is automatically shared to all friends playing the same game. An empty value removes the key.
+	 * Setting the value a key already has does nothing, other changes are batched and published at most once per Rich Presence Interval (see FlushRichPresence).
 	 *
 	 * @param const FString & Key
 	 * @param const FString & Value
+	 * @return bool false if the key or value is too long, or the current user already has the most keys Steam allows
+	 */
+	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
+	bool SetRichPresence(const FString& Key, const FString& Value) const { STEAMBRIDGE_TRACE_SCOPE(USteamFriends::SetRichPresence); return m_RichPresence.Set(Key, Value); }
+
+	/**
+	 * Same as SetRichPresence but takes an interned key, see FSteamKeys.
+	 *
+	 * @param FSteamKey Key
+	 * @param const FString & Value
 	 * @return bool
 	 */
+	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|Friends")
+	bool SetRichPresenceByKey(FSteamKey Key, const FString& Value) const { STEAMBRIDGE_TRACE_SCOPE(USteamFriends::SetRichPresenceByKey); return m_RichPresence.Set(Key, Value); }
+
+	/**
+	 * Publishes the rich presence changes made since the last batch now, instead of waiting for the Rich Presence Interval.
+	 *
+	 * @return void
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|Friends")
+	void FlushRichPresence() { STEAMBRIDGE_TRACE_SCOPE(USteamFriends::FlushRichPresence); m_RichPresence.Flush(0.0); }
+
+	/**
+	 * Gets the value the current user's rich presence key has, or will have once the pending batch is published.
+	 *
+	 * @param const FString & Key
+	 * @return FString Empty if the key isn't set
+	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
-	bool SetRichPresence(const FString& Key, const FString& Value) const { return SteamFriends()->SetRichPresence(TCHAR_TO_UTF8(*Key), TCHAR_TO_UTF8(*Value)); }
+	FString GetRichPresence(const FString& Key) const
+	{
+		const FString* const Value = m_RichPresence.Find(Key);
+		return Value != nullptr ? *Value : FString();
+	}
 
 	/** Delegates */
 	UPROPERTY(BlueprintAssignable, Category = "SteamBridgeCore|Friends", meta = (DisplayName = "OnAvatarImageLoaded"))
@@ -811,10 +1218,88 @@ UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Friends")
 	UPROPERTY(BlueprintAssignable, Category = "SteamBridgeCore|Friends", meta = (DisplayName = "OnPersonaStateChange"))
 	FOnPersonaStateChangeDelegate m_OnPersonaStateChange;
 
+	/** Same as OnPersonaStateChange but carries every change, ChangeFlags has bit (1 << ESteamPersonaChange) set for each. Fires once per user per coalesce window. */
+	UPROPERTY(BlueprintAssignable, Category = "SteamBridgeCore|Friends", meta = (DisplayName = "OnPersonaStateChangeFlags"))
+	FOnPersonaStateChangeFlagsDelegate m_OnPersonaStateChangeFlags;
+
 	UPROPERTY(BlueprintAssignable, Category = "SteamBridgeCore|Friends", meta = (DisplayName = "OnSetPersonaNameResponse"))
 	FOnSetPersonaNameResponseDelegate m_OnSetPersonaNameResponse;
 
 private:
+	void BroadcastPersonaStateChange(uint64 SteamID, uint32 SteamChangeFlags);
+	void FlushPersonaStateChanges();
+	void PublishRichPresence();
+	void PatchFriendsSnapshot(uint64 SteamID, uint32 SteamChangeFlags);
+	void PublishFriendsSnapshot();
+
+	/** What GetFriendsSnapshot hands out, replaced at most once per frame */
+	mutable TSharedPtr<FSteamFriendsSnapshot> m_FriendsSnapshot;
+	/** Patched from the callbacks as they arrive and published after they've all been dispatched */
+	mutable TUniquePtr<FSteamFriendsSnapshot> m_PatchedFriendsSnapshot;
+	bool m_bFriendsSnapshotPatched = false;
+
+	mutable FSteamAvatarCache m_AvatarCache;
+	/** SteamID -> bit (1 << ESteamAvatarSize) for each size that was asked for while still loading, cached as soon as it arrives */
+	mutable TMap<uint64, uint8> m_PendingAvatars;
+	mutable bool m_bAvatarImageLoadedRetained = false;
+
+	/** Created on first use, unless disabled in the settings */
+	mutable TUniquePtr<FSteamAvatarDiskCache> m_AvatarDiskCache;
+
+	int32 GetFriendAvatarImage(FSteamID SteamIDFriend, ESteamAvatarSize AvatarSize) const;
+	void RetainAvatarImageLoaded() const;
+	FSteamAvatarDiskCache* GetAvatarDiskCache() const;
+	UTexture2D* CacheFriendAvatar(uint64 SteamID, int32 Avatar, ESteamAvatarSize AvatarSize, int64 BudgetBytes) const;
+
+	mutable FSteamRichPresencePublisher m_RichPresence;
+
+	/** Created and loaded on first use */
+	mutable TSharedPtr<FSteamClanCache> m_ClanCache;
+	FSteamClanCache& GetClanCacheMutable() const;
+
+	mutable FSteamFriendRichPresenceCache m_FriendRichPresence;
+	mutable bool m_bFriendRichPresenceCached = false;
+
+	/** Seeds the cache with the immediate friends on first use. */
+	FSteamFriendRichPresenceCache& GetFriendRichPresenceCache() const;
+
+	mutable FSteamChatHistory m_ChatHistory;
+	mutable bool m_bClanChatMsgRetained = false;
+	mutable bool m_bFriendChatMsgRetained = false;
+
+	/** Sizes the chat history from the settings, returning whether it keeps anything. */
+	bool InitChatHistory() const;
+
+	/** One per ESteamAvatarSize, created on first use */
+	mutable TUniquePtr<FSteamAvatarAtlas> m_AvatarAtlases[3];
+	/** Same as m_PendingAvatars, for the atlas */
+	mutable TMap<uint64, uint8> m_PendingAtlasAvatars;
+
+	/** SteamID -> EPersonaChange flags OR-ed together since the coalesce window opened */
+	TMap<uint64, uint32> m_PendingPersonaChanges;
+	double m_PersonaCoalesceWindowStart = 0.0;
+
+	struct FUserInformationRequest
+	{
+		double RequestTime = 0.0;
+		double CompletedTime = 0.0;
+		bool bRequireNameOnly = false;
+		bool bPending = false;
+	};
+
+	void CompleteUserInformationRequest(uint64 SteamID) const;
+	void PumpUserInformationPrefetch() const;
+
+	/** Expires user information requests Steam never answered and drops stale request memos, bound to OnPostDispatch. */
+	void ExpireRequests();
+	double m_NextRequestExpiryTime = 0.0;
+
+	mutable TMap<uint64, FUserInformationRequest> m_UserInformationRequests;
+	mutable int32 m_PendingUserInformationRequests = 0;
+	mutable FSteamUserInformationScheduler m_UserInformationPrefetch;
+	mutable TSteamRequestDeduplicator<ClanOfficerListResponse_t> m_ClanOfficerListRequests;
+	mutable TSteamRequestDeduplicator<FriendsGetFollowerCount_t> m_FollowerCountRequests;
+
 	STEAM_CALLBACK_MANUAL(USteamFriends, OnAvatarImageLoaded, AvatarImageLoaded_t, OnAvatarImageLoadedCallback);
 	STEAM_CALLBACK_MANUAL(USteamFriends, OnClanOfficerListResponse, ClanOfficerListResponse_t, OnClanOfficerListResponseCallback);
 	STEAM_CALLBACK_MANUAL(USteamFriends, OnDownloadClanActivityCountsResult, DownloadClanActivityCountsResult_t, OnDownloadClanActivityCountsResultCallback);
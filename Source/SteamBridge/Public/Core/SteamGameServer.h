@@ -4,7 +4,10 @@
 
 #include "CoreMinimal.h"
 #include "Steam.h"
+#include "SteamBackend.h"
+#include "SteamBridgeTrace.h"
 #include "SteamEnums.h"
+#include "SteamKeys.h"
 #include "SteamStructs.h"
 #include "UObject/NoExportTypes.h"
 
@@ -42,7 +45,7 @@ public:
 	 * @return FSteamAPICall
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|GameServer")
-	FSteamAPICall AssociateWithClan(FSteamID SteamIDClan) const { return SteamGameServer()->AssociateWithClan(SteamIDClan.Value); }
+	FSteamAPICall AssociateWithClan(FSteamID SteamIDClan) const { STEAMBRIDGE_TRACE_SCOPE(USteamGameServer::AssociateWithClan); return FSteamBridgeTrace::APICallIssued(SteamBridgeGameServer()->AssociateWithClan(SteamIDClan.Value)); }
 
 	/**
 	 * Authenticate the ticket from the entity Steam ID to be sure it is valid and isn't reused.
@@ -63,7 +66,7 @@ public:
 	 * @return bool
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|GameServer")
-	bool BLoggedOn() const { return SteamGameServer()->BLoggedOn(); }
+	bool BLoggedOn() const { STEAMBRIDGE_TRACE_SCOPE(USteamGameServer::BLoggedOn); return SteamBridgeGameServer()->BLoggedOn(); }
 
 	/**
 	 * Checks whether the game server is in "Secure" mode.
@@ -71,7 +74,7 @@ public:
 	 * @return bool
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|GameServer")
-	bool BSecure() const { return SteamGameServer()->BSecure(); }
+	bool BSecure() const { STEAMBRIDGE_TRACE_SCOPE(USteamGameServer::BSecure); return SteamBridgeGameServer()->BSecure(); }
 
 	/**
 	 * Cancels an auth ticket received from ISteamUser::GetAuthSessionTicket. This should be called when no longer playing with the specified entity.
@@ -80,7 +83,7 @@ public:
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|GameServer")
-	void CancelAuthTicket(FHAuthTicket AuthTicketHandle) { SteamGameServer()->CancelAuthTicket(AuthTicketHandle.Value); }
+	void CancelAuthTicket(FHAuthTicket AuthTicketHandle) { STEAMBRIDGE_TRACE_SCOPE(USteamGameServer::CancelAuthTicket); SteamBridgeGameServer()->CancelAuthTicket(AuthTicketHandle.Value); }
 
 	/**
 	 * Clears the whole list of key/values that are sent in rules queries.
@@ -88,7 +91,7 @@ public:
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|GameServer")
-	void ClearAllKeyValues() { SteamGameServer()->ClearAllKeyValues(); }
+	void ClearAllKeyValues() { STEAMBRIDGE_TRACE_SCOPE(USteamGameServer::ClearAllKeyValues); SteamBridgeGameServer()->ClearAllKeyValues(); }
 
 	// TODO: ComputeNewPlayerCompatibility
 
@@ -100,7 +103,7 @@ public:
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|GameServer")
-	void EnableHeartbeats(bool bActive) { SteamGameServer()->EnableHeartbeats(bActive); }
+	void EnableHeartbeats(bool bActive) { STEAMBRIDGE_TRACE_SCOPE(USteamGameServer::EnableHeartbeats); SteamBridgeGameServer()->EnableHeartbeats(bActive); }
 
 	/**
 	 * Ends an auth session that was started with BeginAuthSession. This should be called when no longer playing with the specified entity.
@@ -109,7 +112,7 @@ public:
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|GameServer")
-	void EndAuthSession(FSteamID SteamID) { SteamGameServer()->EndAuthSession(SteamID.Value); }
+	void EndAuthSession(FSteamID SteamID) { STEAMBRIDGE_TRACE_SCOPE(USteamGameServer::EndAuthSession); SteamBridgeGameServer()->EndAuthSession(SteamID.Value); }
 
 	/**
 	 * Force a heartbeat to the Steam master servers at the next opportunity.
@@ -118,7 +121,7 @@ public:
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|GameServer")
-	void ForceHeartbeat() { SteamGameServer()->ForceHeartbeat(); }
+	void ForceHeartbeat() { STEAMBRIDGE_TRACE_SCOPE(USteamGameServer::ForceHeartbeat); SteamBridgeGameServer()->ForceHeartbeat(); }
 
 	/**
 	 * Retrieve a authentication ticket to be sent to the entity who wishes to authenticate you.
@@ -142,7 +145,7 @@ public:
 	 * @return FSteamID
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|GameServer")
-	FSteamID GetSteamID() const { return SteamGameServer()->GetSteamID().ConvertToUint64(); }
+	FSteamID GetSteamID() const { STEAMBRIDGE_TRACE_SCOPE(USteamGameServer::GetSteamID); return SteamBridgeGameServer()->GetSteamID().ConvertToUint64(); }
 
 	// TODO: HandleIncomingPacket
 	// TODO: InitGameServer
@@ -153,7 +156,7 @@ public:
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|GameServer")
-	void LogOff() { SteamGameServer()->LogOff(); }
+	void LogOff() { STEAMBRIDGE_TRACE_SCOPE(USteamGameServer::LogOff); SteamBridgeGameServer()->LogOff(); }
 
 	/**
 	 * Begin process to login to a persistent game server account.
@@ -162,7 +165,7 @@ public:
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|GameServer")
-	void LogOn(const FString& Token) { SteamGameServer()->LogOn(TCHAR_TO_UTF8(*Token)); }
+	void LogOn(const FString& Token) { STEAMBRIDGE_TRACE_SCOPE(USteamGameServer::LogOn); SteamBridgeGameServer()->LogOn(TCHAR_TO_UTF8(*Token)); }
 
 	/**
 	 * Login to a generic, anonymous account.
@@ -170,7 +173,7 @@ public:
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|GameServer")
-	void LogOnAnonymous() { SteamGameServer()->LogOnAnonymous(); }
+	void LogOnAnonymous() { STEAMBRIDGE_TRACE_SCOPE(USteamGameServer::LogOnAnonymous); SteamBridgeGameServer()->LogOnAnonymous(); }
 
 	/**
 	 * Checks if a user is in the specified Steam group.
@@ -180,7 +183,7 @@ public:
 	 * @return bool
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|GameServer")
-	bool RequestUserGroupStatus(FSteamID SteamIDUser, FSteamID SteamIDGroup) const { return SteamGameServer()->RequestUserGroupStatus(SteamIDUser.Value, SteamIDGroup.Value); }
+	bool RequestUserGroupStatus(FSteamID SteamIDUser, FSteamID SteamIDGroup) const { STEAMBRIDGE_TRACE_SCOPE(USteamGameServer::RequestUserGroupStatus); return SteamBridgeGameServer()->RequestUserGroupStatus(SteamIDUser.Value, SteamIDGroup.Value); }
 
 	/**
 	 * Sets the number of bot/AI players on the game server. The default value is 0.
@@ -189,7 +192,7 @@ public:
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|GameServer")
-	void SetBotPlayerCount(int32 BotPlayers) { SteamGameServer()->SetBotPlayerCount(BotPlayers); }
+	void SetBotPlayerCount(int32 BotPlayers) { STEAMBRIDGE_TRACE_SCOPE(USteamGameServer::SetBotPlayerCount); SteamBridgeGameServer()->SetBotPlayerCount(BotPlayers); }
 
 	/**
 	 * Sets the whether this is a dedicated server or a listen server. The default is listen server.
@@ -199,7 +202,7 @@ public:
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|GameServer")
-	void SetDedicatedServer(bool bDedicated) { SteamGameServer()->SetDedicatedServer(bDedicated); }
+	void SetDedicatedServer(bool bDedicated) { STEAMBRIDGE_TRACE_SCOPE(USteamGameServer::SetDedicatedServer); SteamBridgeGameServer()->SetDedicatedServer(bDedicated); }
 
 	/**
 	 * Sets a string defining the "gamedata" for this server, this is optional, but if set it allows users to filter in the matchmaking/server-browser interfaces based on the value.
@@ -210,7 +213,7 @@ public:
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|GameServer")
-	void SetGameData(const FString& GameData) { SteamGameServer()->SetGameData(TCHAR_TO_UTF8(*GameData)); }
+	void SetGameData(const FString& GameData) { STEAMBRIDGE_TRACE_SCOPE(USteamGameServer::SetGameData); SteamBridgeGameServer()->SetGameData(TCHAR_TO_UTF8(*GameData)); }
 
 	/**
 	 * Sets the game description. Setting this to the full name of your game is recommended.
@@ -220,7 +223,7 @@ public:
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|GameServer")
-	void SetGameDescription(const FString GameDescription) { SteamGameServer()->SetGameDescription(TCHAR_TO_UTF8(*GameDescription)); }
+	void SetGameDescription(const FString GameDescription) { STEAMBRIDGE_TRACE_SCOPE(USteamGameServer::SetGameDescription); SteamBridgeGameServer()->SetGameDescription(TCHAR_TO_UTF8(*GameDescription)); }
 
 	/**
 	 * Sets a string defining the "gametags" for this server, this is optional, but if set it allows users to filter in the matchmaking/server-browser interfaces based on the value.
@@ -231,7 +234,7 @@ public:
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|GameServer")
-	void SetGameTags(const FString& GameTags) { SteamGameServer()->SetGameTags(TCHAR_TO_UTF8(*GameTags)); }
+	void SetGameTags(const FString& GameTags) { STEAMBRIDGE_TRACE_SCOPE(USteamGameServer::SetGameTags); SteamBridgeGameServer()->SetGameTags(TCHAR_TO_UTF8(*GameTags)); }
 
 	/**
 	 * Changes how often heartbeats are sent to the Steam master servers.
@@ -241,7 +244,7 @@ public:
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|GameServer")
-	void SetHeartbeatInterval(int32 HeartbeatInterval) { SteamGameServer()->SetHeartbeatInterval(HeartbeatInterval); }
+	void SetHeartbeatInterval(int32 HeartbeatInterval) { STEAMBRIDGE_TRACE_SCOPE(USteamGameServer::SetHeartbeatInterval); SteamBridgeGameServer()->SetHeartbeatInterval(HeartbeatInterval); }
 
 	/**
 	 * Add/update a rules key/value pair.
@@ -251,7 +254,17 @@ public:
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|GameServer")
-	void SetKeyValue(const FString& Key, const FString& Value) { SteamGameServer()->SetKeyValue(TCHAR_TO_UTF8(*Key), TCHAR_TO_UTF8(*Value)); }
+	void SetKeyValue(const FString& Key, const FString& Value) { STEAMBRIDGE_TRACE_SCOPE(USteamGameServer::SetKeyValue); SteamBridgeGameServer()->SetKeyValue(TCHAR_TO_UTF8(*Key), TCHAR_TO_UTF8(*Value)); }
+
+	/**
+	 * Same as SetKeyValue but takes an interned key, see FSteamKeys.
+	 *
+	 * @param FSteamKey Key
+	 * @param const FString & Value
+	 * @return void
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|GameServer")
+	void SetKeyValueByKey(FSteamKey Key, const FString& Value) { STEAMBRIDGE_TRACE_SCOPE(USteamGameServer::SetKeyValueByKey); SteamBridgeGameServer()->SetKeyValue(FSteamKeys::ToUTF8(Key), TCHAR_TO_UTF8(*Value)); }
 
 	/**
 	 * Sets the name of map to report in the server browser.
@@ -260,7 +273,7 @@ public:
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|GameServer")
-	void SetMapName(const FString& MapName) { SteamGameServer()->SetMapName(TCHAR_TO_UTF8(*MapName)); }
+	void SetMapName(const FString& MapName) { STEAMBRIDGE_TRACE_SCOPE(USteamGameServer::SetMapName); SteamBridgeGameServer()->SetMapName(TCHAR_TO_UTF8(*MapName)); }
 
 	/**
 	 * Sets the maximum number of players allowed on the server at once.
@@ -270,7 +283,7 @@ public:
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|GameServer")
-	void SetMaxPlayerCount(int32 PlayersMax) { SteamGameServer()->SetMaxPlayerCount(PlayersMax); }
+	void SetMaxPlayerCount(int32 PlayersMax) { STEAMBRIDGE_TRACE_SCOPE(USteamGameServer::SetMaxPlayerCount); SteamBridgeGameServer()->SetMaxPlayerCount(PlayersMax); }
 
 	/**
 	 * Sets the game directory.
@@ -281,7 +294,7 @@ public:
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|GameServer")
-	void SetModDir(const FString& ModDir) { SteamGameServer()->SetModDir(TCHAR_TO_UTF8(*ModDir)); }
+	void SetModDir(const FString& ModDir) { STEAMBRIDGE_TRACE_SCOPE(USteamGameServer::SetModDir); SteamBridgeGameServer()->SetModDir(TCHAR_TO_UTF8(*ModDir)); }
 
 	/**
 	 * Set whether the game server will require a password once when the user tries to join.
@@ -290,7 +303,7 @@ public:
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|GameServer")
-	void SetPasswordProtected(bool bPasswordProtected) { SteamGameServer()->SetPasswordProtected(bPasswordProtected); }
+	void SetPasswordProtected(bool bPasswordProtected) { STEAMBRIDGE_TRACE_SCOPE(USteamGameServer::SetPasswordProtected); SteamBridgeGameServer()->SetPasswordProtected(bPasswordProtected); }
 
 	/**
 	 * Sets the game product identifier. This is currently used by the master server for version checking purposes.
@@ -301,7 +314,7 @@ public:
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|GameServer")
-	void SetProduct(const FString& Product) { SteamGameServer()->SetProduct(TCHAR_TO_UTF8(*Product)); }
+	void SetProduct(const FString& Product) { STEAMBRIDGE_TRACE_SCOPE(USteamGameServer::SetProduct); SteamBridgeGameServer()->SetProduct(TCHAR_TO_UTF8(*Product)); }
 
 	/**
 	 * Region identifier. This is an optional field, the default value is an empty string, meaning the "world" region.
@@ -310,7 +323,7 @@ public:
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|GameServer")
-	void SetRegion(const FString& Region) { SteamGameServer()->SetRegion(TCHAR_TO_UTF8(*Region)); }
+	void SetRegion(const FString& Region) { STEAMBRIDGE_TRACE_SCOPE(USteamGameServer::SetRegion); SteamBridgeGameServer()->SetRegion(TCHAR_TO_UTF8(*Region)); }
 
 	/**
 	 * Sets the name of server as it will appear in the server browser.
@@ -319,7 +332,7 @@ public:
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|GameServer")
-	void SetServerName(const FString& ServerName) { SteamGameServer()->SetServerName(TCHAR_TO_UTF8(*ServerName)); }
+	void SetServerName(const FString& ServerName) { STEAMBRIDGE_TRACE_SCOPE(USteamGameServer::SetServerName); SteamBridgeGameServer()->SetServerName(TCHAR_TO_UTF8(*ServerName)); }
 
 	/**
 	 * Set whether the game server allows spectators, and what port they should connect on. The default value is 0, meaning the service is not used.
@@ -328,7 +341,7 @@ public:
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|GameServer")
-	void SetSpectatorPort(int32 SpectatorPort) { SteamGameServer()->SetSpectatorPort(FMath::Clamp<uint16>(SpectatorPort, 0, 65535)); }
+	void SetSpectatorPort(int32 SpectatorPort) { STEAMBRIDGE_TRACE_SCOPE(USteamGameServer::SetSpectatorPort); SteamBridgeGameServer()->SetSpectatorPort(FMath::Clamp<uint16>(SpectatorPort, 0, 65535)); }
 
 	/**
 	 * Sets the name of the spectator server. This is only used if spectator port is nonzero.
@@ -337,7 +350,7 @@ public:
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|GameServer")
-	void SetSpectatorServerName(const FString& SpectatorServerName) { SteamGameServer()->SetSpectatorServerName(TCHAR_TO_UTF8(*SpectatorServerName)); }
+	void SetSpectatorServerName(const FString& SpectatorServerName) { STEAMBRIDGE_TRACE_SCOPE(USteamGameServer::SetSpectatorServerName); SteamBridgeGameServer()->SetSpectatorServerName(TCHAR_TO_UTF8(*SpectatorServerName)); }
 
 	/**
 	 * Checks if the user owns a specific piece of Downloadable Content (DLC).
@@ -348,7 +361,7 @@ public:
 	 * @return ESteamUserHasLicenseForAppResult
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|GameServer")
-	ESteamUserHasLicenseForAppResult UserHasLicenseForApp(FSteamID SteamID, int32 AppID) { return (ESteamUserHasLicenseForAppResult)SteamGameServer()->UserHasLicenseForApp(SteamID.Value, AppID); }
+	ESteamUserHasLicenseForAppResult UserHasLicenseForApp(FSteamID SteamID, int32 AppID) { STEAMBRIDGE_TRACE_SCOPE(USteamGameServer::UserHasLicenseForApp); return (ESteamUserHasLicenseForAppResult)SteamBridgeGameServer()->UserHasLicenseForApp(SteamID.Value, AppID); }
 
 	/**
 	 * Checks if the master server has alerted us that we are out of date.
@@ -357,7 +370,7 @@ public:
 	 * @return bool
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|GameServer")
-	bool WasRestartRequested() const { return SteamGameServer()->WasRestartRequested(); }
+	bool WasRestartRequested() const { STEAMBRIDGE_TRACE_SCOPE(USteamGameServer::WasRestartRequested); return SteamBridgeGameServer()->WasRestartRequested(); }
 
 	/** Delegates */
 	UPROPERTY(BlueprintAssignable, Category = "SteamBridgeCore|GameServer", meta = (DisplayName = "OnAssociateWithClanResult"))
@@ -4,7 +4,9 @@
 
 #include "CoreMinimal.h"
 #include "Steam.h"
+#include "SteamBridgeTrace.h"
 #include "SteamEnums.h"
+#include "SteamKeys.h"
 #include "SteamStructs.h"
 #include "UObject/NoExportTypes.h"
 
@@ -43,7 +45,7 @@ public:
 	 * @return bool
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|GameServerStats")
-	bool ClearUserAchievement(FSteamID SteamIDUser, const FString& Name) const { return SteamGameServerStats()->ClearUserAchievement(SteamIDUser.Value, TCHAR_TO_UTF8(*Name)); }
+	bool ClearUserAchievement(FSteamID SteamIDUser, const FString& Name) const { STEAMBRIDGE_TRACE_SCOPE(USteamGameServerStats::ClearUserAchievement); return SteamGameServerStats()->ClearUserAchievement(SteamIDUser.Value, TCHAR_TO_UTF8(*Name)); }
 
 	/**
 	 * Gets the unlock status of the Achievement.
@@ -54,7 +56,7 @@ public:
 	 * @return bool
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|GameServerStats")
-	bool GetUserAchievement(FSteamID SteamIDUser, const FString& Name, bool& bAchieved) { return SteamGameServerStats()->GetUserAchievement(SteamIDUser.Value, TCHAR_TO_UTF8(*Name), &bAchieved); }
+	bool GetUserAchievement(FSteamID SteamIDUser, const FString& Name, bool& bAchieved) { STEAMBRIDGE_TRACE_SCOPE(USteamGameServerStats::GetUserAchievement); return SteamGameServerStats()->GetUserAchievement(SteamIDUser.Value, TCHAR_TO_UTF8(*Name), &bAchieved); }
 
 	/**
 	 * Gets the current value of the a stat for the specified user.
@@ -66,7 +68,18 @@ public:
 	 * @return bool
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|GameServerStats")
-	bool GetUserStatInt(FSteamID SteamIDUser, const FString& Name, int32& Data) { return SteamGameServerStats()->GetUserStat(SteamIDUser.Value, TCHAR_TO_UTF8(*Name), &Data); }
+	bool GetUserStatInt(FSteamID SteamIDUser, const FString& Name, int32& Data) { STEAMBRIDGE_TRACE_SCOPE(USteamGameServerStats::GetUserStatInt); return SteamGameServerStats()->GetUserStat(SteamIDUser.Value, TCHAR_TO_UTF8(*Name), &Data); }
+
+	/**
+	 * Same as GetUserStatInt but takes an interned key, see FSteamKeys.
+	 *
+	 * @param FSteamID SteamIDUser
+	 * @param FSteamKey Name
+	 * @param int32 & Data
+	 * @return bool
+	 */
+	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|GameServerStats")
+	bool GetUserStatIntByKey(FSteamID SteamIDUser, FSteamKey Name, int32& Data) { STEAMBRIDGE_TRACE_SCOPE(USteamGameServerStats::GetUserStatIntByKey); return SteamGameServerStats()->GetUserStat(SteamIDUser.Value, FSteamKeys::ToUTF8(Name), &Data); }
 
 	/**
 	 * Gets the current value of the a stat for the specified user.
@@ -78,7 +91,18 @@ public:
 	 * @return bool
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|GameServerStats")
-	bool GetUserStatFloat(FSteamID SteamIDUser, const FString& Name, float& Data) { return SteamGameServerStats()->GetUserStat(SteamIDUser.Value, TCHAR_TO_UTF8(*Name), &Data); }
+	bool GetUserStatFloat(FSteamID SteamIDUser, const FString& Name, float& Data) { STEAMBRIDGE_TRACE_SCOPE(USteamGameServerStats::GetUserStatFloat); return SteamGameServerStats()->GetUserStat(SteamIDUser.Value, TCHAR_TO_UTF8(*Name), &Data); }
+
+	/**
+	 * Same as GetUserStatFloat but takes an interned key, see FSteamKeys.
+	 *
+	 * @param FSteamID SteamIDUser
+	 * @param FSteamKey Name
+	 * @param float & Data
+	 * @return bool
+	 */
+	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|GameServerStats")
+	bool GetUserStatFloatByKey(FSteamID SteamIDUser, FSteamKey Name, float& Data) { STEAMBRIDGE_TRACE_SCOPE(USteamGameServerStats::GetUserStatFloatByKey); return SteamGameServerStats()->GetUserStat(SteamIDUser.Value, FSteamKeys::ToUTF8(Name), &Data); }
 
 	// TODO: RequestUserStats
 
@@ -94,7 +118,7 @@ public:
 	 * @return bool
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|GameServerStats")
-	bool SetUserAchievement(FSteamID SteamIDUser, const FString& Name) const { return SteamGameServerStats()->SetUserAchievement(SteamIDUser.Value, TCHAR_TO_UTF8(*Name)); }
+	bool SetUserAchievement(FSteamID SteamIDUser, const FString& Name) const { STEAMBRIDGE_TRACE_SCOPE(USteamGameServerStats::SetUserAchievement); return SteamGameServerStats()->SetUserAchievement(SteamIDUser.Value, TCHAR_TO_UTF8(*Name)); }
 
 	/**
 	 * Sets / updates the value of a given stat for the specified user.
@@ -109,7 +133,18 @@ public:
 	 * @return bool
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|GameServerStats")
-	bool SetUserStatInt(FSteamID SteamIDUser, const FString& Name, int32 Data) { return SteamGameServerStats()->SetUserStat(SteamIDUser.Value, TCHAR_TO_UTF8(*Name), Data); }
+	bool SetUserStatInt(FSteamID SteamIDUser, const FString& Name, int32 Data) { STEAMBRIDGE_TRACE_SCOPE(USteamGameServerStats::SetUserStatInt); return SteamGameServerStats()->SetUserStat(SteamIDUser.Value, TCHAR_TO_UTF8(*Name), Data); }
+
+	/**
+	 * Same as SetUserStatInt but takes an interned key, see FSteamKeys.
+	 *
+	 * @param FSteamID SteamIDUser
+	 * @param FSteamKey Name
+	 * @param int32 Data
+	 * @return bool
+	 */
+	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|GameServerStats")
+	bool SetUserStatIntByKey(FSteamID SteamIDUser, FSteamKey Name, int32 Data) { STEAMBRIDGE_TRACE_SCOPE(USteamGameServerStats::SetUserStatIntByKey); return SteamGameServerStats()->SetUserStat(SteamIDUser.Value, FSteamKeys::ToUTF8(Name), Data); }
 
 	/**
 	 * Sets / updates the value of a given stat for the specified user.
@@ -124,7 +159,18 @@ public:
 	 * @return bool
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|GameServerStats")
-	bool SetUserStatFloat(FSteamID SteamIDUser, const FString& Name, float Data) { return SteamGameServerStats()->SetUserStat(SteamIDUser.Value, TCHAR_TO_UTF8(*Name), Data); }
+	bool SetUserStatFloat(FSteamID SteamIDUser, const FString& Name, float Data) { STEAMBRIDGE_TRACE_SCOPE(USteamGameServerStats::SetUserStatFloat); return SteamGameServerStats()->SetUserStat(SteamIDUser.Value, TCHAR_TO_UTF8(*Name), Data); }
+
+	/**
+	 * Same as SetUserStatFloat but takes an interned key, see FSteamKeys.
+	 *
+	 * @param FSteamID SteamIDUser
+	 * @param FSteamKey Name
+	 * @param float Data
+	 * @return bool
+	 */
+	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|GameServerStats")
+	bool SetUserStatFloatByKey(FSteamID SteamIDUser, FSteamKey Name, float Data) { STEAMBRIDGE_TRACE_SCOPE(USteamGameServerStats::SetUserStatFloatByKey); return SteamGameServerStats()->SetUserStat(SteamIDUser.Value, FSteamKeys::ToUTF8(Name), Data); }
 
 	// TODO: StoreUserStats
 
@@ -144,6 +190,18 @@ public:
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|GameServerStats")
 	bool UpdateUserAvgRateStat(FSteamID SteamIDUser, const FString& Name, float CountThisSession, float SessionLength) const;
 
+	/**
+	 * Same as UpdateUserAvgRateStat but takes an interned key, see FSteamKeys.
+	 *
+	 * @param FSteamID SteamIDUser
+	 * @param FSteamKey Name
+	 * @param float CountThisSession
+	 * @param float SessionLength
+	 * @return bool
+	 */
+	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|GameServerStats")
+	bool UpdateUserAvgRateStatByKey(FSteamID SteamIDUser, FSteamKey Name, float CountThisSession, float SessionLength) const { STEAMBRIDGE_TRACE_SCOPE(USteamGameServerStats::UpdateUserAvgRateStatByKey); return SteamGameServerStats()->UpdateUserAvgRateStat(SteamIDUser.Value, FSteamKeys::ToUTF8(Name), CountThisSession, SessionLength); }
+
 	/** Delegates */
 	UPROPERTY(BlueprintAssignable, Category = "SteamBridgeCore|GameServerStats", meta = (DisplayName = "OnGSStatsReceived"))
 	FOnGSStatsReceivedDelegate m_OnGSStatsReceived;
@@ -4,6 +4,8 @@
 
 #include "CoreMinimal.h"
 #include "Steam.h"
+#include "SteamBridgeTrace.h"
+#include "SteamCallResult.h"
 #include "SteamEnums.h"
 #include "SteamStructs.h"
 #include "UObject/NoExportTypes.h"
@@ -60,7 +62,7 @@ public:
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|HTMLSurface")
-	void AddHeader(FHHTMLBrowser BrowserHandle, const FString& Key, const FString& Value) { SteamHTMLSurface()->AddHeader(BrowserHandle, TCHAR_TO_UTF8(*Key), TCHAR_TO_UTF8(*Value)); }
+	void AddHeader(FHHTMLBrowser BrowserHandle, const FString& Key, const FString& Value) { STEAMBRIDGE_TRACE_SCOPE(USteamHTMLSurface::AddHeader); SteamHTMLSurface()->AddHeader(BrowserHandle, TCHAR_TO_UTF8(*Key), TCHAR_TO_UTF8(*Value)); }
 
 	/**
 	 * Sets whether a pending load is allowed or if it should be canceled.
@@ -72,7 +74,7 @@ public:
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|HTMLSurface")
-	void AllowStartRequest(FHHTMLBrowser BrowserHandle, bool bAllowed) { SteamHTMLSurface()->AllowStartRequest(BrowserHandle, bAllowed); }
+	void AllowStartRequest(FHHTMLBrowser BrowserHandle, bool bAllowed) { STEAMBRIDGE_TRACE_SCOPE(USteamHTMLSurface::AllowStartRequest); SteamHTMLSurface()->AllowStartRequest(BrowserHandle, bAllowed); }
 
 	/**
 	 * Copy the currently selected text from the current page in an HTML surface into the local clipboard.
@@ -81,7 +83,7 @@ public:
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|HTMLSurface")
-	void CopyToClipboard(FHHTMLBrowser BrowserHandle) { SteamHTMLSurface()->CopyToClipboard(BrowserHandle); }
+	void CopyToClipboard(FHHTMLBrowser BrowserHandle) { STEAMBRIDGE_TRACE_SCOPE(USteamHTMLSurface::CopyToClipboard); SteamHTMLSurface()->CopyToClipboard(BrowserHandle); }
 
 	/**
 	 * Create a browser object for displaying of an HTML page.
@@ -95,7 +97,10 @@ public:
 	 * @return FSteamAPICall
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|HTMLSurface")
-	FSteamAPICall CreateBrowser(const FString& UserAgent, const FString& UserCSS) const { return SteamHTMLSurface()->CreateBrowser(TCHAR_TO_UTF8(*UserAgent), TCHAR_TO_UTF8(*UserCSS)); }
+	FSteamAPICall CreateBrowser(const FString& UserAgent, const FString& UserCSS) const { STEAMBRIDGE_TRACE_SCOPE(USteamHTMLSurface::CreateBrowser); return FSteamBridgeTrace::APICallIssued(SteamHTMLSurface()->CreateBrowser(TCHAR_TO_UTF8(*UserAgent), TCHAR_TO_UTF8(*UserCSS))); }
+
+	/** C++ only, delivers the new browser to the returned future. m_OnHTMLBrowserReady is still broadcast as well. */
+	TFuture<TSteamCallResult<HTML_BrowserReady_t>> CreateBrowserAsync(const FString& UserAgent, const FString& UserCSS) const { return FSteamCallResults::Await<HTML_BrowserReady_t>(CreateBrowser(UserAgent, UserCSS)); }
 
 	// TODO: FileLoadDialogResponse
 
@@ -111,7 +116,7 @@ public:
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|HTMLSurface")
-	void Find(FHHTMLBrowser BrowserHandle, const FString& SearchStr, bool bCurrentlyInFind, bool bReverse) { SteamHTMLSurface()->Find(BrowserHandle, TCHAR_TO_UTF8(*SearchStr), bCurrentlyInFind, bReverse); }
+	void Find(FHHTMLBrowser BrowserHandle, const FString& SearchStr, bool bCurrentlyInFind, bool bReverse) { STEAMBRIDGE_TRACE_SCOPE(USteamHTMLSurface::Find); SteamHTMLSurface()->Find(BrowserHandle, TCHAR_TO_UTF8(*SearchStr), bCurrentlyInFind, bReverse); }
 
 	/**
 	 * Retrieves details about a link at a specific position on the current page in an HTML surface.
@@ -122,7 +127,7 @@ public:
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|HTMLSurface")
-	void GetLinkAtPosition(FHHTMLBrowser BrowserHandle, int32 x, int32 y) { SteamHTMLSurface()->GetLinkAtPosition(BrowserHandle, x, y); }
+	void GetLinkAtPosition(FHHTMLBrowser BrowserHandle, int32 x, int32 y) { STEAMBRIDGE_TRACE_SCOPE(USteamHTMLSurface::GetLinkAtPosition); SteamHTMLSurface()->GetLinkAtPosition(BrowserHandle, x, y); }
 
 	/**
 	 * Navigate back in the page history.
@@ -131,7 +136,7 @@ public:
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|HTMLSurface")
-	void GoBack(FHHTMLBrowser BrowserHandle) { SteamHTMLSurface()->GoBack(BrowserHandle); }
+	void GoBack(FHHTMLBrowser BrowserHandle) { STEAMBRIDGE_TRACE_SCOPE(USteamHTMLSurface::GoBack); SteamHTMLSurface()->GoBack(BrowserHandle); }
 
 	/**
 	 * Navigate forward in the page history
@@ -140,7 +145,7 @@ public:
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|HTMLSurface")
-	void GoForward(FHHTMLBrowser BrowserHandle) { SteamHTMLSurface()->GoForward(BrowserHandle); }
+	void GoForward(FHHTMLBrowser BrowserHandle) { STEAMBRIDGE_TRACE_SCOPE(USteamHTMLSurface::GoForward); SteamHTMLSurface()->GoForward(BrowserHandle); }
 
 	/**
 	 * Initializes the HTML Surface API.
@@ -150,7 +155,7 @@ public:
 	 * @return bool
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|HTMLSurface")
-	bool Init() { return SteamHTMLSurface()->Init(); }
+	bool Init() { STEAMBRIDGE_TRACE_SCOPE(USteamHTMLSurface::Init); return SteamHTMLSurface()->Init(); }
 
 	/**
 	 * Allows you to react to a page wanting to open a javascript modal dialog notification.
@@ -161,7 +166,7 @@ public:
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|HTMLSurface")
-	void JSDialogResponse(FHHTMLBrowser BrowserHandle, bool bResult) { SteamHTMLSurface()->JSDialogResponse(BrowserHandle, bResult); }
+	void JSDialogResponse(FHHTMLBrowser BrowserHandle, bool bResult) { STEAMBRIDGE_TRACE_SCOPE(USteamHTMLSurface::JSDialogResponse); SteamHTMLSurface()->JSDialogResponse(BrowserHandle, bResult); }
 
 	/**
 	 * UnicodeChar is the unicode character point for this keypress (and potentially multiple chars per press)
@@ -172,7 +177,7 @@ public:
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|HTMLSurface")
-	void KeyChar(FHHTMLBrowser BrowserHandle, int32 UnicodeChar, ESteamHTMLKeyModifiers HTMLKeyModifiers) { SteamHTMLSurface()->KeyChar(BrowserHandle, UnicodeChar, (ISteamHTMLSurface::EHTMLKeyModifiers)HTMLKeyModifiers); }
+	void KeyChar(FHHTMLBrowser BrowserHandle, int32 UnicodeChar, ESteamHTMLKeyModifiers HTMLKeyModifiers) { STEAMBRIDGE_TRACE_SCOPE(USteamHTMLSurface::KeyChar); SteamHTMLSurface()->KeyChar(BrowserHandle, UnicodeChar, (ISteamHTMLSurface::EHTMLKeyModifiers)HTMLKeyModifiers); }
 
 	/**
 	 * keyboard interactions, native keycode is the virtual key code value from your OS
@@ -183,7 +188,7 @@ public:
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|HTMLSurface")
-	void KeyDown(FHHTMLBrowser BrowserHandle, int32 NativeKeyCode, ESteamHTMLKeyModifiers HTMLKeyModifiers) { SteamHTMLSurface()->KeyDown(BrowserHandle, NativeKeyCode, (ISteamHTMLSurface::EHTMLKeyModifiers)HTMLKeyModifiers); }
+	void KeyDown(FHHTMLBrowser BrowserHandle, int32 NativeKeyCode, ESteamHTMLKeyModifiers HTMLKeyModifiers) { STEAMBRIDGE_TRACE_SCOPE(USteamHTMLSurface::KeyDown); SteamHTMLSurface()->KeyDown(BrowserHandle, NativeKeyCode, (ISteamHTMLSurface::EHTMLKeyModifiers)HTMLKeyModifiers); }
 
 	/**
 	 * Navigate to a specified URL.
@@ -196,7 +201,7 @@ public:
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|HTMLSurface")
-	void LoadURL(FHHTMLBrowser BrowserHandle, const FString& URL, const FString& PostData) { SteamHTMLSurface()->LoadURL(BrowserHandle, TCHAR_TO_UTF8(*URL), TCHAR_TO_UTF8(*PostData)); }
+	void LoadURL(FHHTMLBrowser BrowserHandle, const FString& URL, const FString& PostData) { STEAMBRIDGE_TRACE_SCOPE(USteamHTMLSurface::LoadURL); SteamHTMLSurface()->LoadURL(BrowserHandle, TCHAR_TO_UTF8(*URL), TCHAR_TO_UTF8(*PostData)); }
 
 	/**
 	 * Tells an HTML surface that a mouse button has been double clicked.
@@ -207,7 +212,7 @@ public:
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|HTMLSurface")
-	void MouseDoubleClick(FHHTMLBrowser BrowserHandle, ESteamHTMLMouseButton MouseButton) { SteamHTMLSurface()->MouseDoubleClick(BrowserHandle, (ISteamHTMLSurface::EHTMLMouseButton)MouseButton); }
+	void MouseDoubleClick(FHHTMLBrowser BrowserHandle, ESteamHTMLMouseButton MouseButton) { STEAMBRIDGE_TRACE_SCOPE(USteamHTMLSurface::MouseDoubleClick); SteamHTMLSurface()->MouseDoubleClick(BrowserHandle, (ISteamHTMLSurface::EHTMLMouseButton)MouseButton); }
 
 	/**
 	 * Tells an HTML surface that a mouse button has been pressed.
@@ -218,7 +223,7 @@ public:
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|HTMLSurface")
-	void MouseDown(FHHTMLBrowser BrowserHandle, ESteamHTMLMouseButton MouseButton) { SteamHTMLSurface()->MouseDown(BrowserHandle, (ISteamHTMLSurface::EHTMLMouseButton)MouseButton); }
+	void MouseDown(FHHTMLBrowser BrowserHandle, ESteamHTMLMouseButton MouseButton) { STEAMBRIDGE_TRACE_SCOPE(USteamHTMLSurface::MouseDown); SteamHTMLSurface()->MouseDown(BrowserHandle, (ISteamHTMLSurface::EHTMLMouseButton)MouseButton); }
 
 	/**
 	 * Tells an HTML surface where the mouse is.
@@ -229,7 +234,7 @@ public:
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|HTMLSurface")
-	void MouseMove(FHHTMLBrowser BrowserHandle, int32 x, int32 y) { SteamHTMLSurface()->MouseMove(BrowserHandle, x, y); }
+	void MouseMove(FHHTMLBrowser BrowserHandle, int32 x, int32 y) { STEAMBRIDGE_TRACE_SCOPE(USteamHTMLSurface::MouseMove); SteamHTMLSurface()->MouseMove(BrowserHandle, x, y); }
 
 	/**
 	 * Tells an HTML surface that a mouse button has been released.
@@ -240,7 +245,7 @@ public:
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|HTMLSurface")
-	void MouseUp(FHHTMLBrowser BrowserHandle, ESteamHTMLMouseButton MouseButton) { SteamHTMLSurface()->MouseUp(BrowserHandle, (ISteamHTMLSurface::EHTMLMouseButton)MouseButton); }
+	void MouseUp(FHHTMLBrowser BrowserHandle, ESteamHTMLMouseButton MouseButton) { STEAMBRIDGE_TRACE_SCOPE(USteamHTMLSurface::MouseUp); SteamHTMLSurface()->MouseUp(BrowserHandle, (ISteamHTMLSurface::EHTMLMouseButton)MouseButton); }
 
 	/**
 	 * Tells an HTML surface that the mouse wheel has moved.
@@ -250,7 +255,7 @@ public:
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|HTMLSurface")
-	void MouseWheel(FHHTMLBrowser BrowserHandle, int32 Delta) { SteamHTMLSurface()->MouseWheel(BrowserHandle, Delta); }
+	void MouseWheel(FHHTMLBrowser BrowserHandle, int32 Delta) { STEAMBRIDGE_TRACE_SCOPE(USteamHTMLSurface::MouseWheel); SteamHTMLSurface()->MouseWheel(BrowserHandle, Delta); }
 
 	/**
 	 * Paste from the local clipboard to the current page in an HTML surface.
@@ -259,7 +264,7 @@ public:
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|HTMLSurface")
-	void PasteFromClipboard(FHHTMLBrowser BrowserHandle) { SteamHTMLSurface()->PasteFromClipboard(BrowserHandle); }
+	void PasteFromClipboard(FHHTMLBrowser BrowserHandle) { STEAMBRIDGE_TRACE_SCOPE(USteamHTMLSurface::PasteFromClipboard); SteamHTMLSurface()->PasteFromClipboard(BrowserHandle); }
 
 	/**
 	 * Refreshes the current page.
@@ -269,7 +274,7 @@ public:
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|HTMLSurface")
-	void Reload(FHHTMLBrowser BrowserHandle) { SteamHTMLSurface()->Reload(BrowserHandle); }
+	void Reload(FHHTMLBrowser BrowserHandle) { STEAMBRIDGE_TRACE_SCOPE(USteamHTMLSurface::Reload); SteamHTMLSurface()->Reload(BrowserHandle); }
 
 	/**
 	 * You MUST call this when you are done with an HTML surface, freeing the resources associated with it.
@@ -279,7 +284,7 @@ public:
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|HTMLSurface")
-	void RemoveBrowser(FHHTMLBrowser BrowserHandle) { SteamHTMLSurface()->RemoveBrowser(BrowserHandle); }
+	void RemoveBrowser(FHHTMLBrowser BrowserHandle) { STEAMBRIDGE_TRACE_SCOPE(USteamHTMLSurface::RemoveBrowser); SteamHTMLSurface()->RemoveBrowser(BrowserHandle); }
 
 	/**
 	 * Enable/disable low-resource background mode, where javascript and repaint timers are throttled, resources are more aggressively purged from memory, and audio/video elements are paused.
@@ -291,7 +296,7 @@ public:
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|HTMLSurface")
-	void SetBackgroundMode(FHHTMLBrowser BrowserHandle, bool bBackgroundMode) { SteamHTMLSurface()->SetBackgroundMode(BrowserHandle, bBackgroundMode); }
+	void SetBackgroundMode(FHHTMLBrowser BrowserHandle, bool bBackgroundMode) { STEAMBRIDGE_TRACE_SCOPE(USteamHTMLSurface::SetBackgroundMode); SteamHTMLSurface()->SetBackgroundMode(BrowserHandle, bBackgroundMode); }
 
 	/**
 	 * Set a webcookie for a specific hostname.
@@ -316,7 +321,7 @@ public:
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|HTMLSurface")
-	void SetHorizontalScroll(FHHTMLBrowser BrowserHandle, int32 AbsolutePixelScroll) { SteamHTMLSurface()->SetHorizontalScroll(BrowserHandle, AbsolutePixelScroll); }
+	void SetHorizontalScroll(FHHTMLBrowser BrowserHandle, int32 AbsolutePixelScroll) { STEAMBRIDGE_TRACE_SCOPE(USteamHTMLSurface::SetHorizontalScroll); SteamHTMLSurface()->SetHorizontalScroll(BrowserHandle, AbsolutePixelScroll); }
 
 	/**
 	 * Tell a HTML surface if it has key focus currently, controls showing the I-beam cursor in text controls amongst other things.
@@ -326,7 +331,7 @@ public:
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|HTMLSurface")
-	void SetKeyFocus(FHHTMLBrowser BrowserHandle, bool bHasKeyFocus) { SteamHTMLSurface()->SetKeyFocus(BrowserHandle, bHasKeyFocus); }
+	void SetKeyFocus(FHHTMLBrowser BrowserHandle, bool bHasKeyFocus) { STEAMBRIDGE_TRACE_SCOPE(USteamHTMLSurface::SetKeyFocus); SteamHTMLSurface()->SetKeyFocus(BrowserHandle, bHasKeyFocus); }
 
 	/**
 	 * Zoom the current page in an HTML surface.
@@ -339,7 +344,7 @@ public:
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|HTMLSurface")
-	void SetPageScaleFactor(FHHTMLBrowser BrowserHandle, float Zoom, int32 PointX, int32 PointY) { SteamHTMLSurface()->SetPageScaleFactor(BrowserHandle, Zoom, PointX, PointY); }
+	void SetPageScaleFactor(FHHTMLBrowser BrowserHandle, float Zoom, int32 PointX, int32 PointY) { STEAMBRIDGE_TRACE_SCOPE(USteamHTMLSurface::SetPageScaleFactor); SteamHTMLSurface()->SetPageScaleFactor(BrowserHandle, Zoom, PointX, PointY); }
 
 	/**
 	 * Sets the display size of a surface in pixels.
@@ -350,7 +355,7 @@ public:
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|HTMLSurface")
-	void SetSize(FHHTMLBrowser BrowserHandle, int32 Width, int32 Height) { SteamHTMLSurface()->SetSize(BrowserHandle, Width, Height); }
+	void SetSize(FHHTMLBrowser BrowserHandle, int32 Width, int32 Height) { STEAMBRIDGE_TRACE_SCOPE(USteamHTMLSurface::SetSize); SteamHTMLSurface()->SetSize(BrowserHandle, Width, Height); }
 
 	/**
 	 * Scroll the current page vertically.
@@ -360,7 +365,7 @@ public:
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|HTMLSurface")
-	void SetVerticalScroll(FHHTMLBrowser BrowserHandle, int32 AbsolutePixelScroll) { SteamHTMLSurface()->SetVerticalScroll(BrowserHandle, AbsolutePixelScroll); }
+	void SetVerticalScroll(FHHTMLBrowser BrowserHandle, int32 AbsolutePixelScroll) { STEAMBRIDGE_TRACE_SCOPE(USteamHTMLSurface::SetVerticalScroll); SteamHTMLSurface()->SetVerticalScroll(BrowserHandle, AbsolutePixelScroll); }
 
 	/**
 	 * Shutdown the ISteamHTMLSurface interface, releasing the memory and handles.
@@ -369,7 +374,7 @@ public:
 	 * @return bool
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|HTMLSurface")
-	bool Shutdown() { return SteamHTMLSurface()->Shutdown(); }
+	bool Shutdown() { STEAMBRIDGE_TRACE_SCOPE(USteamHTMLSurface::Shutdown); return SteamHTMLSurface()->Shutdown(); }
 
 	/**
 	 * Cancel a currently running find.
@@ -378,7 +383,7 @@ public:
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|HTMLSurface")
-	void StopFind(FHHTMLBrowser BrowserHandle) { SteamHTMLSurface()->StopFind(BrowserHandle); }
+	void StopFind(FHHTMLBrowser BrowserHandle) { STEAMBRIDGE_TRACE_SCOPE(USteamHTMLSurface::StopFind); SteamHTMLSurface()->StopFind(BrowserHandle); }
 
 	/**
 	 * Stop the load of the current HTML page.
@@ -387,7 +392,7 @@ public:
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|HTMLSurface")
-	void StopLoad(FHHTMLBrowser BrowserHandle) { SteamHTMLSurface()->StopLoad(BrowserHandle); }
+	void StopLoad(FHHTMLBrowser BrowserHandle) { STEAMBRIDGE_TRACE_SCOPE(USteamHTMLSurface::StopLoad); SteamHTMLSurface()->StopLoad(BrowserHandle); }
 
 	/**
 	 * Open the current pages HTML source code in default local text editor, used for debugging.
@@ -396,7 +401,7 @@ public:
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|HTMLSurface")
-	void ViewSource(FHHTMLBrowser BrowserHandle) { SteamHTMLSurface()->ViewSource(BrowserHandle); }
+	void ViewSource(FHHTMLBrowser BrowserHandle) { STEAMBRIDGE_TRACE_SCOPE(USteamHTMLSurface::ViewSource); SteamHTMLSurface()->ViewSource(BrowserHandle); }
 
 	/** Delegates */
 	UPROPERTY(BlueprintAssignable, Category = "SteamBridgeCore|Friends", meta = (DisplayName = "OnHTMLBrowserReady"))
@@ -4,6 +4,8 @@
 
 #include "CoreMinimal.h"
 #include "Steam.h"
+#include "SteamBackend.h"
+#include "SteamBridgeTrace.h"
 #include "SteamEnums.h"
 #include "SteamStructs.h"
 #include "UObject/NoExportTypes.h"
@@ -42,7 +44,7 @@ public:
 	 * @return FHTTPCookieContainerHandle
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|HTTP")
-	FHTTPCookieContainerHandle CreateCookieContainer(bool bAllowResponsesToModify) { return SteamHTTP()->CreateCookieContainer(bAllowResponsesToModify); }
+	FHTTPCookieContainerHandle CreateCookieContainer(bool bAllowResponsesToModify) { STEAMBRIDGE_TRACE_SCOPE(USteamHTTP::CreateCookieContainer); return SteamBridgeHTTP()->CreateCookieContainer(bAllowResponsesToModify); }
 
 	/**
 	 * Initializes a new HTTP request.
@@ -55,7 +57,7 @@ public:
 	 * @return FHTTPRequestHandle
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|HTTP")
-	FHTTPRequestHandle CreateHTTPRequest(ESteamHTTPMethod HTTPRequestMethod, const FString& AbsoluteURL) { return SteamHTTP()->CreateHTTPRequest((EHTTPMethod)HTTPRequestMethod, TCHAR_TO_UTF8(*AbsoluteURL)); }
+	FHTTPRequestHandle CreateHTTPRequest(ESteamHTTPMethod HTTPRequestMethod, const FString& AbsoluteURL) { STEAMBRIDGE_TRACE_SCOPE(USteamHTTP::CreateHTTPRequest); return SteamBridgeHTTP()->CreateHTTPRequest((EHTTPMethod)HTTPRequestMethod, TCHAR_TO_UTF8(*AbsoluteURL)); }
 
 	/**
 	 * Defers a request which has already been sent by moving it at the back of the queue.
@@ -64,7 +66,7 @@ public:
 	 * @return bool
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|HTTP")
-	bool DeferHTTPRequest(FHTTPRequestHandle RequestHandle) { return SteamHTTP()->DeferHTTPRequest(RequestHandle); }
+	bool DeferHTTPRequest(FHTTPRequestHandle RequestHandle) { STEAMBRIDGE_TRACE_SCOPE(USteamHTTP::DeferHTTPRequest); return SteamBridgeHTTP()->DeferHTTPRequest(RequestHandle); }
 
 	/**
 	 * Gets progress on downloading the body for the request.
@@ -76,7 +78,7 @@ public:
 	 * @return bool
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|HTTP")
-	bool GetHTTPDownloadProgressPct(FHTTPRequestHandle RequestHandle, float& Percent) { return SteamHTTP()->GetHTTPDownloadProgressPct(RequestHandle, &Percent); }
+	bool GetHTTPDownloadProgressPct(FHTTPRequestHandle RequestHandle, float& Percent) { STEAMBRIDGE_TRACE_SCOPE(USteamHTTP::GetHTTPDownloadProgressPct); return SteamBridgeHTTP()->GetHTTPDownloadProgressPct(RequestHandle, &Percent); }
 
 	/**
 	 * Check if the reason the request failed was because we timed it out (rather than some harder failure).
@@ -87,7 +89,7 @@ public:
 	 * @return bool
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|HTTP")
-	bool GetHTTPRequestWasTimedOut(FHTTPRequestHandle RequestHandle, bool& bWasTimedOut) { return SteamHTTP()->GetHTTPRequestWasTimedOut(RequestHandle, &bWasTimedOut); }
+	bool GetHTTPRequestWasTimedOut(FHTTPRequestHandle RequestHandle, bool& bWasTimedOut) { STEAMBRIDGE_TRACE_SCOPE(USteamHTTP::GetHTTPRequestWasTimedOut); return SteamBridgeHTTP()->GetHTTPRequestWasTimedOut(RequestHandle, &bWasTimedOut); }
 
 	/**
 	 * Gets the body data from an HTTP response.
@@ -100,7 +102,7 @@ public:
 	 * @return bool
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|HTTP")
-	bool GetHTTPResponseBodyData(FHTTPRequestHandle RequestHandle, uint8& BodyDataBuffer) { return SteamHTTP()->GetHTTPResponseBodyData(RequestHandle, &BodyDataBuffer, MAX_uint32); }
+	bool GetHTTPResponseBodyData(FHTTPRequestHandle RequestHandle, uint8& BodyDataBuffer) { STEAMBRIDGE_TRACE_SCOPE(USteamHTTP::GetHTTPResponseBodyData); return SteamBridgeHTTP()->GetHTTPResponseBodyData(RequestHandle, &BodyDataBuffer, MAX_uint32); }
 
 	/**
 	 * Gets the size of the body data from an HTTP response.
@@ -138,7 +140,7 @@ public:
 	 * @return bool
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|HTTP")
-	bool GetHTTPResponseHeaderValue(FHTTPRequestHandle RequestHandle, const FString& HeaderName, uint8& HeaderValueBuffer) { return SteamHTTP()->GetHTTPResponseHeaderValue(RequestHandle, TCHAR_TO_UTF8(*HeaderName), &HeaderValueBuffer, MAX_uint32); }
+	bool GetHTTPResponseHeaderValue(FHTTPRequestHandle RequestHandle, const FString& HeaderName, uint8& HeaderValueBuffer) { STEAMBRIDGE_TRACE_SCOPE(USteamHTTP::GetHTTPResponseHeaderValue); return SteamBridgeHTTP()->GetHTTPResponseHeaderValue(RequestHandle, TCHAR_TO_UTF8(*HeaderName), &HeaderValueBuffer, MAX_uint32); }
 
 	/**
 	 * Gets the body data from a streaming HTTP response.
@@ -152,7 +154,7 @@ public:
 	 * @return bool
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|HTTP")
-	bool GetHTTPStreamingResponseBodyData(FHTTPRequestHandle RequestHandle, int32 Offset, uint8& BodyDataBuffer) { return SteamHTTP()->GetHTTPStreamingResponseBodyData(RequestHandle, Offset, &BodyDataBuffer, MAX_uint32); }
+	bool GetHTTPStreamingResponseBodyData(FHTTPRequestHandle RequestHandle, int32 Offset, uint8& BodyDataBuffer) { STEAMBRIDGE_TRACE_SCOPE(USteamHTTP::GetHTTPStreamingResponseBodyData); return SteamBridgeHTTP()->GetHTTPStreamingResponseBodyData(RequestHandle, Offset, &BodyDataBuffer, MAX_uint32); }
 
 	/**
 	 * Prioritizes a request which has already been sent by moving it at the front of the queue.
@@ -161,7 +163,7 @@ public:
 	 * @return bool
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|HTTP")
-	bool PrioritizeHTTPRequest(FHTTPRequestHandle RequestHandle) { return SteamHTTP()->PrioritizeHTTPRequest(RequestHandle); }
+	bool PrioritizeHTTPRequest(FHTTPRequestHandle RequestHandle) { STEAMBRIDGE_TRACE_SCOPE(USteamHTTP::PrioritizeHTTPRequest); return SteamBridgeHTTP()->PrioritizeHTTPRequest(RequestHandle); }
 
 	/**
 	 * Releases a cookie container, freeing the memory allocated within Steam.
@@ -171,7 +173,7 @@ public:
 	 * @return bool
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|HTTP")
-	bool ReleaseCookieContainer(FHTTPCookieContainerHandle CookieContainerHandle) { return SteamHTTP()->ReleaseCookieContainer(CookieContainerHandle); }
+	bool ReleaseCookieContainer(FHTTPCookieContainerHandle CookieContainerHandle) { STEAMBRIDGE_TRACE_SCOPE(USteamHTTP::ReleaseCookieContainer); return SteamBridgeHTTP()->ReleaseCookieContainer(CookieContainerHandle); }
 
 	/**
 	 * Releases an HTTP request handle, freeing the memory allocated within Steam.
@@ -181,7 +183,7 @@ public:
 	 * @return bool
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|HTTP")
-	bool ReleaseHTTPRequest(FHTTPRequestHandle RequestHandle) { return SteamHTTP()->ReleaseHTTPRequest(RequestHandle); }
+	bool ReleaseHTTPRequest(FHTTPRequestHandle RequestHandle) { STEAMBRIDGE_TRACE_SCOPE(USteamHTTP::ReleaseHTTPRequest); return SteamBridgeHTTP()->ReleaseHTTPRequest(RequestHandle); }
 
 	/**
 	 * Sends an HTTP request.
@@ -221,7 +223,7 @@ public:
 	 * @return bool
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|HTTP")
-	bool SetCookie(FHTTPCookieContainerHandle CookieContainerHandle, const FString& Host, const FString& Url, const FString& Cookie) { return SteamHTTP()->SetCookie(CookieContainerHandle, TCHAR_TO_UTF8(*Host), TCHAR_TO_UTF8(*Url), TCHAR_TO_UTF8(*Cookie)); }
+	bool SetCookie(FHTTPCookieContainerHandle CookieContainerHandle, const FString& Host, const FString& Url, const FString& Cookie) { STEAMBRIDGE_TRACE_SCOPE(USteamHTTP::SetCookie); return SteamBridgeHTTP()->SetCookie(CookieContainerHandle, TCHAR_TO_UTF8(*Host), TCHAR_TO_UTF8(*Url), TCHAR_TO_UTF8(*Cookie)); }
 
 	/**
 	 * Set an absolute timeout in milliseconds for the HTTP request.
@@ -232,7 +234,7 @@ public:
 	 * @return bool
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|HTTP")
-	bool SetHTTPRequestAbsoluteTimeoutMS(FHTTPRequestHandle RequestHandle, int32 Milliseconds) { return SteamHTTP()->SetHTTPRequestAbsoluteTimeoutMS(RequestHandle, Milliseconds); }
+	bool SetHTTPRequestAbsoluteTimeoutMS(FHTTPRequestHandle RequestHandle, int32 Milliseconds) { STEAMBRIDGE_TRACE_SCOPE(USteamHTTP::SetHTTPRequestAbsoluteTimeoutMS); return SteamBridgeHTTP()->SetHTTPRequestAbsoluteTimeoutMS(RequestHandle, Milliseconds); }
 
 	/**
 	 * Set a context value for the request, which will be returned in the HTTPRequestCompleted_t callback after sending the request.
@@ -244,7 +246,7 @@ public:
 	 * @return bool
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|HTTP")
-	bool SetHTTPRequestContextValue(FHTTPRequestHandle RequestHandle, int64 ContextValue) { return SteamHTTP()->SetHTTPRequestContextValue(RequestHandle, ContextValue); }
+	bool SetHTTPRequestContextValue(FHTTPRequestHandle RequestHandle, int64 ContextValue) { STEAMBRIDGE_TRACE_SCOPE(USteamHTTP::SetHTTPRequestContextValue); return SteamBridgeHTTP()->SetHTTPRequestContextValue(RequestHandle, ContextValue); }
 
 	/**
 	 * Associates a cookie container to use for an HTTP request.
@@ -254,7 +256,7 @@ public:
 	 * @return bool
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|HTTP")
-	bool SetHTTPRequestCookieContainer(FHTTPRequestHandle RequestHandle, FHTTPCookieContainerHandle CookieContainerHandle) { return SteamHTTP()->SetHTTPRequestCookieContainer(RequestHandle, CookieContainerHandle); }
+	bool SetHTTPRequestCookieContainer(FHTTPRequestHandle RequestHandle, FHTTPCookieContainerHandle CookieContainerHandle) { STEAMBRIDGE_TRACE_SCOPE(USteamHTTP::SetHTTPRequestCookieContainer); return SteamBridgeHTTP()->SetHTTPRequestCookieContainer(RequestHandle, CookieContainerHandle); }
 
 	/**
 	 * Set a GET or POST parameter value on the HTTP request.
@@ -266,7 +268,7 @@ public:
 	 * @return bool
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|HTTP")
-	bool SetHTTPRequestGetOrPostParameter(FHTTPRequestHandle RequestHandle, const FString& Name, const FString& Value) { return SteamHTTP()->SetHTTPRequestGetOrPostParameter(RequestHandle, TCHAR_TO_UTF8(*Name), TCHAR_TO_UTF8(*Value)); }
+	bool SetHTTPRequestGetOrPostParameter(FHTTPRequestHandle RequestHandle, const FString& Name, const FString& Value) { STEAMBRIDGE_TRACE_SCOPE(USteamHTTP::SetHTTPRequestGetOrPostParameter); return SteamBridgeHTTP()->SetHTTPRequestGetOrPostParameter(RequestHandle, TCHAR_TO_UTF8(*Name), TCHAR_TO_UTF8(*Value)); }
 
 	/**
 	 * Set a request header value for the HTTP request.
@@ -279,7 +281,7 @@ public:
 	 * @return bool
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|HTTP")
-	bool SetHTTPRequestHeaderValue(FHTTPRequestHandle RequestHandle, const FString& Name, const FString& Value) { return SteamHTTP()->SetHTTPRequestHeaderValue(RequestHandle, TCHAR_TO_UTF8(*Name), TCHAR_TO_UTF8(*Value)); }
+	bool SetHTTPRequestHeaderValue(FHTTPRequestHandle RequestHandle, const FString& Name, const FString& Value) { STEAMBRIDGE_TRACE_SCOPE(USteamHTTP::SetHTTPRequestHeaderValue); return SteamBridgeHTTP()->SetHTTPRequestHeaderValue(RequestHandle, TCHAR_TO_UTF8(*Name), TCHAR_TO_UTF8(*Value)); }
 
 	/**
 	 * Set the timeout in seconds for the HTTP request.
@@ -290,7 +292,7 @@ public:
 	 * @return bool
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|HTTP")
-	bool SetHTTPRequestNetworkActivityTimeout(FHTTPRequestHandle RequestHandle, int32 TimeoutSeconds) { return SteamHTTP()->SetHTTPRequestNetworkActivityTimeout(RequestHandle, TimeoutSeconds); }
+	bool SetHTTPRequestNetworkActivityTimeout(FHTTPRequestHandle RequestHandle, int32 TimeoutSeconds) { STEAMBRIDGE_TRACE_SCOPE(USteamHTTP::SetHTTPRequestNetworkActivityTimeout); return SteamBridgeHTTP()->SetHTTPRequestNetworkActivityTimeout(RequestHandle, TimeoutSeconds); }
 
 	/**
 	 * Sets the body for an HTTP Post request.
@@ -303,7 +305,7 @@ public:
 	 * @return bool
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|HTTP")
-	bool SetHTTPRequestRawPostBody(FHTTPRequestHandle RequestHandle, const FString& ContentType, uint8& Body) { return SteamHTTP()->SetHTTPRequestRawPostBody(RequestHandle, TCHAR_TO_UTF8(*ContentType), &Body, MAX_uint8); }
+	bool SetHTTPRequestRawPostBody(FHTTPRequestHandle RequestHandle, const FString& ContentType, uint8& Body) { STEAMBRIDGE_TRACE_SCOPE(USteamHTTP::SetHTTPRequestRawPostBody); return SteamBridgeHTTP()->SetHTTPRequestRawPostBody(RequestHandle, TCHAR_TO_UTF8(*ContentType), &Body, MAX_uint8); }
 
 	/**
 	 * Sets that the HTTPS request should require verified SSL certificate via machines certificate trust store.
@@ -314,7 +316,7 @@ public:
 	 * @return bool
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|HTTP")
-	bool SetHTTPRequestRequiresVerifiedCertificate(FHTTPRequestHandle RequestHandle, bool bRequireVerifiedCertificate) { return SteamHTTP()->SetHTTPRequestRequiresVerifiedCertificate(RequestHandle, bRequireVerifiedCertificate); }
+	bool SetHTTPRequestRequiresVerifiedCertificate(FHTTPRequestHandle RequestHandle, bool bRequireVerifiedCertificate) { STEAMBRIDGE_TRACE_SCOPE(USteamHTTP::SetHTTPRequestRequiresVerifiedCertificate); return SteamBridgeHTTP()->SetHTTPRequestRequiresVerifiedCertificate(RequestHandle, bRequireVerifiedCertificate); }
 
 	/**
 	 * Set additional user agent info for a request.
@@ -325,7 +327,7 @@ public:
 	 * @return bool
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|HTTP")
-	bool SetHTTPRequestUserAgentInfo(FHTTPRequestHandle RequestHandle, const FString& UserAgentInfo) { return SteamHTTP()->SetHTTPRequestUserAgentInfo(RequestHandle, TCHAR_TO_UTF8(*UserAgentInfo)); }
+	bool SetHTTPRequestUserAgentInfo(FHTTPRequestHandle RequestHandle, const FString& UserAgentInfo) { STEAMBRIDGE_TRACE_SCOPE(USteamHTTP::SetHTTPRequestUserAgentInfo); return SteamBridgeHTTP()->SetHTTPRequestUserAgentInfo(RequestHandle, TCHAR_TO_UTF8(*UserAgentInfo)); }
 
 	/** Delegates */
 	UPROPERTY(BlueprintAssignable, Category = "SteamBridgeCore|HTTP", meta = (DisplayName = "OnHTTPRequestCompleted"))
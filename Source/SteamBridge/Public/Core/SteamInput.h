@@ -4,7 +4,9 @@
 
 #include "CoreMinimal.h"
 #include "Steam.h"
+#include "SteamBridgeTrace.h"
 #include "SteamEnums.h"
+#include "SteamFlags.h"
 #include "SteamStructs.h"
 #include "UObject/NoExportTypes.h"
 
@@ -35,7 +37,7 @@ public:
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|Input")
-	void ActivateActionSet(FInputHandle InputHandle, FInputActionSetHandle ActionSetHandle) { SteamInput()->ActivateActionSet(InputHandle, ActionSetHandle.Value); }
+	void ActivateActionSet(FInputHandle InputHandle, FInputActionSetHandle ActionSetHandle) { STEAMBRIDGE_TRACE_SCOPE(USteamInput::ActivateActionSet); SteamInput()->ActivateActionSet(InputHandle, ActionSetHandle.Value); }
 
 	/**
 	 * Reconfigure the controller to use the specified action set layer.
@@ -45,7 +47,7 @@ public:
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|Input")
-	void ActivateActionSetLayer(FInputHandle InputHandle, FInputActionSetHandle ActionSetHandle) { SteamInput()->ActivateActionSetLayer(InputHandle, ActionSetHandle); }
+	void ActivateActionSetLayer(FInputHandle InputHandle, FInputActionSetHandle ActionSetHandle) { STEAMBRIDGE_TRACE_SCOPE(USteamInput::ActivateActionSetLayer); SteamInput()->ActivateActionSetLayer(InputHandle, ActionSetHandle); }
 
 	/**
 	 * Reconfigure the controller to stop using the specified action set layer.
@@ -55,7 +57,7 @@ public:
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|Input")
-	void DeactivateActionSetLayer(FInputHandle InputHandle, FInputActionSetHandle ActionSetHandle) { SteamInput()->DeactivateActionSetLayer(InputHandle, ActionSetHandle); }
+	void DeactivateActionSetLayer(FInputHandle InputHandle, FInputActionSetHandle ActionSetHandle) { STEAMBRIDGE_TRACE_SCOPE(USteamInput::DeactivateActionSetLayer); SteamInput()->DeactivateActionSetLayer(InputHandle, ActionSetHandle); }
 
 	/**
 	 * Reconfigure the controller to stop using all action set layers.
@@ -64,7 +66,7 @@ public:
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|Input")
-	void DeactivateAllActionSetLayers(FInputHandle InputHandle) { SteamInput()->DeactivateAllActionSetLayers(InputHandle); }
+	void DeactivateAllActionSetLayers(FInputHandle InputHandle) { STEAMBRIDGE_TRACE_SCOPE(USteamInput::DeactivateAllActionSetLayers); SteamInput()->DeactivateAllActionSetLayers(InputHandle); }
 
 	/**
 	 * Fill an array with all of the currently active action set layers for a specified controller handle.
@@ -83,7 +85,7 @@ public:
 	 * @return FInputActionSetHandle
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Input")
-	FInputActionSetHandle GetActionSetHandle(const FString& ActionSetName) const { return SteamInput()->GetActionSetHandle(TCHAR_TO_UTF8(*ActionSetName)); }
+	FInputActionSetHandle GetActionSetHandle(const FString& ActionSetName) const { STEAMBRIDGE_TRACE_SCOPE(USteamInput::GetActionSetHandle); return SteamInput()->GetActionSetHandle(TCHAR_TO_UTF8(*ActionSetName)); }
 
 	/**
 	 * Returns the current state of the supplied analog game action.
@@ -104,7 +106,7 @@ public:
 	 * @return FInputAnalogActionHandle
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Input")
-	FInputAnalogActionHandle GetAnalogActionHandle(const FString& ActionName) const { return SteamInput()->GetAnalogActionHandle(TCHAR_TO_UTF8(*ActionName)); }
+	FInputAnalogActionHandle GetAnalogActionHandle(const FString& ActionName) const { STEAMBRIDGE_TRACE_SCOPE(USteamInput::GetAnalogActionHandle); return SteamInput()->GetAnalogActionHandle(TCHAR_TO_UTF8(*ActionName)); }
 
 	/**
 	 * Get the origin(s) for an analog action within an action set by filling originsOut with EInputActionOrigin handles. Use this to display the appropriate on-screen prompt for the action.
@@ -134,7 +136,7 @@ public:
 	 * @return FInputHandle
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|Input")
-	FInputHandle GetControllerForGamepadIndex(int32 Index) const { return SteamInput()->GetControllerForGamepadIndex(Index); }
+	FInputHandle GetControllerForGamepadIndex(int32 Index) const { STEAMBRIDGE_TRACE_SCOPE(USteamInput::GetControllerForGamepadIndex); return SteamInput()->GetControllerForGamepadIndex(Index); }
 
 	/**
 	 * Get the currently active action set for the specified controller.
@@ -143,7 +145,7 @@ public:
 	 * @return FInputActionSetHandle
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Input")
-	FInputActionSetHandle GetCurrentActionSet(FInputHandle InputHandle) const { return SteamInput()->GetCurrentActionSet(InputHandle); }
+	FInputActionSetHandle GetCurrentActionSet(FInputHandle InputHandle) const { STEAMBRIDGE_TRACE_SCOPE(USteamInput::GetCurrentActionSet); return SteamInput()->GetCurrentActionSet(InputHandle); }
 
 	/**
 	 * Returns the current state of the supplied digital game action.
@@ -164,7 +166,7 @@ public:
 	 * @return FInputDigitalActionHandle
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Input")
-	FInputDigitalActionHandle GetDigitalActionHandle(const FString& ActionName) const { return SteamInput()->GetDigitalActionHandle(TCHAR_TO_UTF8(*ActionName)); }
+	FInputDigitalActionHandle GetDigitalActionHandle(const FString& ActionName) const { STEAMBRIDGE_TRACE_SCOPE(USteamInput::GetDigitalActionHandle); return SteamInput()->GetDigitalActionHandle(TCHAR_TO_UTF8(*ActionName)); }
 
 	/**
 	 * Get the origin(s) for a digital action within an action set by filling originsOut with EInputActionOrigin handles. Use this to display the appropriate on-screen prompt for the action.
@@ -185,7 +187,7 @@ public:
 	 * @return int32
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Input")
-	int32 GetGamepadIndexForController(FInputHandle ControllerHandle) const { return SteamInput()->GetGamepadIndexForController(ControllerHandle); }
+	int32 GetGamepadIndexForController(FInputHandle ControllerHandle) const { STEAMBRIDGE_TRACE_SCOPE(USteamInput::GetGamepadIndexForController); return SteamInput()->GetGamepadIndexForController(ControllerHandle); }
 
 	/**
 	 * Get a local path to art for on-screen glyph for a particular origin.
@@ -194,7 +196,7 @@ public:
 	 * @return FString
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Input")
-	FString GetGlyphForActionOrigin(ESteamInputActionOrigin Origin) const { return UTF8_TO_TCHAR(*SteamInput()->GetGlyphForActionOrigin((EInputActionOrigin)Origin)); }
+	FString GetGlyphForActionOrigin(ESteamInputActionOrigin Origin) const { STEAMBRIDGE_TRACE_SCOPE(USteamInput::GetGlyphForActionOrigin); return UTF8_TO_TCHAR(*SteamInput()->GetGlyphForActionOrigin((EInputActionOrigin)Origin)); }
 
 	/**
 	 * Returns the input type (device model) for the specified controller. This tells you if a given controller is a Steam controller, XBox 360 controller, PS4 controller, etc.
@@ -203,7 +205,7 @@ public:
 	 * @return ESteamInputType_
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Input")
-	ESteamInputType_ GetInputTypeForHandle(FInputHandle InputHandle) const { return (ESteamInputType_)SteamInput()->GetInputTypeForHandle(InputHandle); }
+	ESteamInputType_ GetInputTypeForHandle(FInputHandle InputHandle) const { STEAMBRIDGE_TRACE_SCOPE(USteamInput::GetInputTypeForHandle); return (ESteamInputType_)SteamInput()->GetInputTypeForHandle(InputHandle); }
 
 	/**
 	 * Returns raw motion data for the specified controller.
@@ -221,7 +223,7 @@ public:
 	 * @return FString
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Input")
-	FString GetStringForActionOrigin(ESteamInputActionOrigin Origin) const { return SteamInput()->GetStringForActionOrigin((EInputActionOrigin)Origin); }
+	FString GetStringForActionOrigin(ESteamInputActionOrigin Origin) const { STEAMBRIDGE_TRACE_SCOPE(USteamInput::GetStringForActionOrigin); return SteamInput()->GetStringForActionOrigin((EInputActionOrigin)Origin); }
 
 	/**
 	 * Must be called when starting use of the ISteamInput interface.
@@ -229,7 +231,7 @@ public:
 	 * @return bool
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|Input")
-	bool Init() { return SteamInput()->Init(); }
+	bool Init() { STEAMBRIDGE_TRACE_SCOPE(USteamInput::Init); return SteamInput()->Init(); }
 
 	/**
 	 * Synchronize API state with the latest Steam Controller inputs available. This is performed automatically by SteamAPI_RunCallbacks, but for the absolute lowest possible latency, you can call this -
@@ -238,7 +240,7 @@ public:
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|Input")
-	void RunFrame() { SteamInput()->RunFrame(); }
+	void RunFrame() { STEAMBRIDGE_TRACE_SCOPE(USteamInput::RunFrame); SteamInput()->RunFrame(); }
 
 	/**
 	 * Set the controller LED color on supported controllers.
@@ -255,6 +257,22 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|Input")
 	void SetLEDColorU(FInputHandle InputHandle, uint8 R, uint8 G, uint8 B, const TArray<ESteamControllerLEDFlag_>& Flags);
 
+	/** C++ only, takes the flags already combined. */
+	void SetLEDColorU(FInputHandle InputHandle, uint8 R, uint8 G, uint8 B, FSteamControllerLEDFlags Flags) { STEAMBRIDGE_TRACE_SCOPE(USteamInput::SetLEDColorU); SteamInput()->SetLEDColor(InputHandle.Value, R, G, B, Flags.GetBits()); }
+
+	/**
+	 * Same as SetLEDColorU but takes the flags as a bitmask, which doesn't have to be rebuilt on every call.
+	 *
+	 * @param FInputHandle InputHandle
+	 * @param uint8 R
+	 * @param uint8 G
+	 * @param uint8 B
+	 * @param int32 Flags
+	 * @return void
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|Input", meta = (DisplayName = "Set LED Color U (Bitmask)"))
+	void SetLEDColorUWithBitmask(FInputHandle InputHandle, uint8 R, uint8 G, uint8 B, UPARAM(meta = (Bitmask, BitmaskEnum = ESteamControllerLEDFlag_)) int32 Flags) { SetLEDColorU(InputHandle, R, G, B, FSteamControllerLEDFlags::FromBitmask(Flags)); }
+
 	/**
 	 * Set the controller LED color on supported controllers.
 	 * NOTE: The VSC does not support any color but white, and will interpret the RGB values as a greyscale value affecting the brightness of the Steam button LED.
@@ -268,6 +286,20 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|Input")
 	void SetLEDColor(FInputHandle InputHandle, const FLinearColor& Color, const TArray<ESteamControllerLEDFlag_>& Flags);
 
+	/** C++ only, takes the flags already combined. */
+	void SetLEDColor(FInputHandle InputHandle, const FLinearColor& Color, FSteamControllerLEDFlags Flags) { STEAMBRIDGE_TRACE_SCOPE(USteamInput::SetLEDColor); SteamInput()->SetLEDColor(InputHandle.Value, Color.R, Color.G, Color.B, Flags.GetBits()); }
+
+	/**
+	 * Same as SetLEDColor but takes the flags as a bitmask, which doesn't have to be rebuilt on every call.
+	 *
+	 * @param FInputHandle InputHandle
+	 * @param const FLinearColor & Color
+	 * @param int32 Flags
+	 * @return void
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|Input", meta = (DisplayName = "Set LED Color (Bitmask)"))
+	void SetLEDColorWithBitmask(FInputHandle InputHandle, const FLinearColor& Color, UPARAM(meta = (Bitmask, BitmaskEnum = ESteamControllerLEDFlag_)) int32 Flags) { SetLEDColor(InputHandle, Color, FSteamControllerLEDFlags::FromBitmask(Flags)); }
+
 	/**
 	 * Invokes the Steam overlay and brings up the binding screen.
 	 *
@@ -275,7 +307,7 @@ public:
 	 * @return bool
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Input")
-	bool ShowBindingPanel(FInputHandle InputHandle) const { return SteamInput()->ShowBindingPanel(InputHandle); }
+	bool ShowBindingPanel(FInputHandle InputHandle) const { STEAMBRIDGE_TRACE_SCOPE(USteamInput::ShowBindingPanel); return SteamInput()->ShowBindingPanel(InputHandle); }
 
 	/**
 	 * Must be called when ending use of the ISteamInput interface.
@@ -283,7 +315,7 @@ public:
 	 * @return bool
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|Input")
-	bool Shutdown() { return SteamInput()->Shutdown(); }
+	bool Shutdown() { STEAMBRIDGE_TRACE_SCOPE(USteamInput::Shutdown); return SteamInput()->Shutdown(); }
 
 	/**
 	 * Stops the momentum of an analog action (where applicable, ie a touchpad w/ virtual trackball settings).
@@ -294,7 +326,7 @@ public:
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|Input")
-	void StopAnalogActionMomentum(FInputHandle InputHandle, FInputAnalogActionHandle ActionHandle) { SteamInput()->StopAnalogActionMomentum(InputHandle, ActionHandle); }
+	void StopAnalogActionMomentum(FInputHandle InputHandle, FInputAnalogActionHandle ActionHandle) { STEAMBRIDGE_TRACE_SCOPE(USteamInput::StopAnalogActionMomentum); SteamInput()->StopAnalogActionMomentum(InputHandle, ActionHandle); }
 
 	/**
 	 * Triggers a (low-level) haptic pulse on supported controllers.
@@ -309,7 +341,7 @@ public:
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|Input")
-	void TriggerHapticPulse(FInputHandle InputHandle, ESteamControllerPad_ TargetPad, int32 DurationMicroSec) { SteamInput()->TriggerHapticPulse(InputHandle, (ESteamControllerPad)TargetPad, DurationMicroSec); }
+	void TriggerHapticPulse(FInputHandle InputHandle, ESteamControllerPad_ TargetPad, int32 DurationMicroSec) { STEAMBRIDGE_TRACE_SCOPE(USteamInput::TriggerHapticPulse); SteamInput()->TriggerHapticPulse(InputHandle, (ESteamControllerPad)TargetPad, DurationMicroSec); }
 
 	/**
 	 * Triggers a repeated haptic pulse on supported controllers.
@@ -326,7 +358,7 @@ public:
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|Input")
-	void TriggerRepeatedHapticPulse(FInputHandle InputHandle, ESteamControllerPad_ TargetPad, int32 DurationMicroSec, int32 OffMicroSec, int32 Repeat) { SteamInput()->TriggerRepeatedHapticPulse(InputHandle, (ESteamControllerPad)TargetPad, DurationMicroSec, OffMicroSec, Repeat, 0); }
+	void TriggerRepeatedHapticPulse(FInputHandle InputHandle, ESteamControllerPad_ TargetPad, int32 DurationMicroSec, int32 OffMicroSec, int32 Repeat) { STEAMBRIDGE_TRACE_SCOPE(USteamInput::TriggerRepeatedHapticPulse); SteamInput()->TriggerRepeatedHapticPulse(InputHandle, (ESteamControllerPad)TargetPad, DurationMicroSec, OffMicroSec, Repeat, 0); }
 
 	/**
 	 * Trigger a vibration event on supported controllers.
@@ -340,10 +372,10 @@ public:
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|Input")
-	void TriggerVibration(FInputHandle InputHandle, int32 LeftSpeed, int32 RightSpeed) { SteamInput()->TriggerVibration(InputHandle, LeftSpeed, RightSpeed); }
+	void TriggerVibration(FInputHandle InputHandle, int32 LeftSpeed, int32 RightSpeed) { STEAMBRIDGE_TRACE_SCOPE(USteamInput::TriggerVibration); SteamInput()->TriggerVibration(InputHandle, LeftSpeed, RightSpeed); }
 
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Input")
-	ESteamInputActionOrigin GetActionOriginFromXboxOrigin(FInputHandle InputHandle, ESteamXboxOrigin Origin) const { return (ESteamInputActionOrigin)SteamInput()->GetActionOriginFromXboxOrigin(InputHandle, (EXboxOrigin)Origin); }
+	ESteamInputActionOrigin GetActionOriginFromXboxOrigin(FInputHandle InputHandle, ESteamXboxOrigin Origin) const { STEAMBRIDGE_TRACE_SCOPE(USteamInput::GetActionOriginFromXboxOrigin); return (ESteamInputActionOrigin)SteamInput()->GetActionOriginFromXboxOrigin(InputHandle, (EXboxOrigin)Origin); }
 
 	/**
 	 * Get the equivalent origin for a given controller type or the closest controller type that existed in the SDK you built into your game if eDestinationInputType is k_ESteamInputType_Unknown. This action origin -
@@ -354,7 +386,7 @@ public:
 	 * @return ESteamInputActionOrigin
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Input")
-	ESteamInputActionOrigin TranslateActionOrigin(ESteamInputType_ DestinationInputType, ESteamInputActionOrigin SourceOrigin) const { return (ESteamInputActionOrigin)SteamInput()->TranslateActionOrigin((ESteamInputType)DestinationInputType, (EInputActionOrigin)SourceOrigin); }
+	ESteamInputActionOrigin TranslateActionOrigin(ESteamInputType_ DestinationInputType, ESteamInputActionOrigin SourceOrigin) const { STEAMBRIDGE_TRACE_SCOPE(USteamInput::TranslateActionOrigin); return (ESteamInputActionOrigin)SteamInput()->TranslateActionOrigin((ESteamInputType)DestinationInputType, (EInputActionOrigin)SourceOrigin); }
 
 	/**
 	 * Gets the major and minor device binding revisions for Steam Input API configurations. Major revisions are to be used when changing the number of action sets or otherwise reworking configurations to the degree -
@@ -368,7 +400,7 @@ public:
 	 * @return bool
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Input")
-	bool GetDeviceBindingRevision(FInputHandle InputHandle, int32& Major, int32& Minor) const { return SteamInput()->GetDeviceBindingRevision(InputHandle, &Major, &Minor); }
+	bool GetDeviceBindingRevision(FInputHandle InputHandle, int32& Major, int32& Minor) const { STEAMBRIDGE_TRACE_SCOPE(USteamInput::GetDeviceBindingRevision); return SteamInput()->GetDeviceBindingRevision(InputHandle, &Major, &Minor); }
 
 	/**
 	 * Get the Steam Remote Play session ID associated with a device, or 0 if there is no session associated with it. See isteamremoteplay.h for more information on Steam Remote Play sessions
@@ -377,7 +409,7 @@ public:
 	 * @return int32
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|Input")
-	int32 GetRemotePlaySessionID(FInputHandle InputHandle) const { return SteamInput()->GetRemotePlaySessionID(InputHandle); }
+	int32 GetRemotePlaySessionID(FInputHandle InputHandle) const { STEAMBRIDGE_TRACE_SCOPE(USteamInput::GetRemotePlaySessionID); return SteamInput()->GetRemotePlaySessionID(InputHandle); }
 
 protected:
 private:
@@ -4,6 +4,8 @@
 
 #include "CoreMinimal.h"
 #include "Steam.h"
+#include "SteamBackend.h"
+#include "SteamBridgeTrace.h"
 #include "SteamEnums.h"
 #include "SteamStructs.h"
 #include "UObject/NoExportTypes.h"
@@ -27,28 +29,28 @@ public:
 	static USteamInventory* GetSteamInventory() { return USteamInventory::StaticClass()->GetDefaultObject<USteamInventory>(); }
 
 	UFUNCTION(BlueprintCallable, BlueprintPure = false, Category = "SteamBridgeCore|USteamInventory")
-	bool AddPromoItem(FSteamInventoryResult& ResultHandle, FSteamItemDef ItemDef) const { return SteamInventory()->AddPromoItem(&ResultHandle.Value, ItemDef.Value); }
+	bool AddPromoItem(FSteamInventoryResult& ResultHandle, FSteamItemDef ItemDef) const { STEAMBRIDGE_TRACE_SCOPE(USteamInventory::AddPromoItem); return SteamBridgeInventory()->AddPromoItem(&ResultHandle.Value, ItemDef.Value); }
 
 	UFUNCTION(BlueprintCallable, BlueprintPure = false, Category = "SteamBridgeCore|USteamInventory")
 	bool AddPromoItems(FSteamInventoryResult& ResultHandle, const TArray<FSteamItemDef>& ItemDefs) const;
 
 	UFUNCTION(BlueprintCallable, BlueprintPure = false, Category = "SteamBridgeCore|USteamInventory")
-	bool CheckResultSteamID(FSteamInventoryResult ResultHandle, FSteamID SteamIDExpected) const { return SteamInventory()->CheckResultSteamID(ResultHandle, SteamIDExpected.Value); }
+	bool CheckResultSteamID(FSteamInventoryResult ResultHandle, FSteamID SteamIDExpected) const { STEAMBRIDGE_TRACE_SCOPE(USteamInventory::CheckResultSteamID); return SteamBridgeInventory()->CheckResultSteamID(ResultHandle, SteamIDExpected.Value); }
 
 	UFUNCTION(BlueprintCallable, BlueprintPure = false, Category = "SteamBridgeCore|USteamInventory")
-	bool ConsumeItem(FSteamInventoryResult& ResultHandle, FSteamItemInstanceID ItemID, int32 Quantity) const { return SteamInventory()->ConsumeItem(&ResultHandle.Value, ItemID, Quantity); }
+	bool ConsumeItem(FSteamInventoryResult& ResultHandle, FSteamItemInstanceID ItemID, int32 Quantity) const { STEAMBRIDGE_TRACE_SCOPE(USteamInventory::ConsumeItem); return SteamBridgeInventory()->ConsumeItem(&ResultHandle.Value, ItemID, Quantity); }
 
 	UFUNCTION(BlueprintCallable, BlueprintPure = false, Category = "SteamBridgeCore|USteamInventory")
-	bool DeserializeResult(FSteamInventoryResult& ResultHandle, TArray<uint8> Buffer) const { return SteamInventory()->DeserializeResult(&ResultHandle.Value, Buffer.GetData(), Buffer.Num(), false); }
+	bool DeserializeResult(FSteamInventoryResult& ResultHandle, TArray<uint8> Buffer) const { STEAMBRIDGE_TRACE_SCOPE(USteamInventory::DeserializeResult); return SteamBridgeInventory()->DeserializeResult(&ResultHandle.Value, Buffer.GetData(), Buffer.Num(), false); }
 
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|USteamInventory")
-	void DestroyResult(FSteamInventoryResult ResultHandle) { SteamInventory()->DestroyResult(ResultHandle); }
+	void DestroyResult(FSteamInventoryResult ResultHandle) { STEAMBRIDGE_TRACE_SCOPE(USteamInventory::DestroyResult); SteamBridgeInventory()->DestroyResult(ResultHandle); }
 
 	// TODO: ExchangeItems
 	// TODO: GenerateItems
 
 	UFUNCTION(BlueprintCallable, BlueprintPure = false, Category = "SteamBridgeCore|USteamInventory")
-	bool GetAllItems(FSteamInventoryResult& ResultHandle) const { return SteamInventory()->GetAllItems(&ResultHandle.Value); }
+	bool GetAllItems(FSteamInventoryResult& ResultHandle) const { STEAMBRIDGE_TRACE_SCOPE(USteamInventory::GetAllItems); return SteamBridgeInventory()->GetAllItems(&ResultHandle.Value); }
 
 	// TODO: GetEligiblePromoItemDefinitionIDs
 	// TODO: GetItemDefinitionIDs
@@ -59,7 +61,7 @@ public:
 
 	// TODO: GetItemsWithPrices
 
-	int32 GetNumItemsWithPrices() const { return SteamInventory()->GetNumItemsWithPrices(); }
+	int32 GetNumItemsWithPrices() const { STEAMBRIDGE_TRACE_SCOPE(USteamInventory::GetNumItemsWithPrices); return SteamBridgeInventory()->GetNumItemsWithPrices(); }
 
 protected:
 private:
@@ -4,6 +4,8 @@
 
 #include "CoreMinimal.h"
 #include "Steam.h"
+#include "SteamBackend.h"
+#include "SteamBridgeTrace.h"
 #include "SteamEnums.h"
 #include "SteamStructs.h"
 #include "UObject/NoExportTypes.h"
@@ -66,7 +68,7 @@ public:
      * Triggers a ValidateAuthTicketResponse_t callback.
      */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|User")
-	ESteamBeginAuthSessionResult BeginAuthSession(TArray<uint8> Ticket, FSteamID SteamID) { return (ESteamBeginAuthSessionResult)SteamUser()->BeginAuthSession(Ticket.GetData(), Ticket.Num(), SteamID.Value); }
+	ESteamBeginAuthSessionResult BeginAuthSession(TArray<uint8> Ticket, FSteamID SteamID) { STEAMBRIDGE_TRACE_SCOPE(USteamUser::BeginAuthSession); return (ESteamBeginAuthSessionResult)SteamBridgeUser()->BeginAuthSession(Ticket.GetData(), Ticket.Num(), SteamID.Value); }
 
 	/**
 	 * Checks if the current users looks like they are behind a NAT device.
@@ -75,7 +77,7 @@ public:
      * @return bool
      */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|User")
-	bool BIsBehindNAT() { return SteamUser()->BIsBehindNAT(); }
+	bool BIsBehindNAT() { STEAMBRIDGE_TRACE_SCOPE(USteamUser::BIsBehindNAT); return SteamBridgeUser()->BIsBehindNAT(); }
 
 	/**
      * Checks whether the user's phone number is used to uniquely identify them.
@@ -83,7 +85,7 @@ public:
      * @return bool
      */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|User")
-	bool BIsPhoneIdentifying() { return SteamUser()->BIsPhoneIdentifying(); }
+	bool BIsPhoneIdentifying() { STEAMBRIDGE_TRACE_SCOPE(USteamUser::BIsPhoneIdentifying); return SteamBridgeUser()->BIsPhoneIdentifying(); }
 
 	/**
      * Checks whether the current user's phone number is awaiting (re)verification.
@@ -91,7 +93,7 @@ public:
      * @return bool
      */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|User")
-	bool BIsPhoneRequiringVerification() { return SteamUser()->BIsPhoneRequiringVerification(); }
+	bool BIsPhoneRequiringVerification() { STEAMBRIDGE_TRACE_SCOPE(USteamUser::BIsPhoneRequiringVerification); return SteamBridgeUser()->BIsPhoneRequiringVerification(); }
 
 	/**
      * Checks whether the current user has verified their phone number.
@@ -99,7 +101,7 @@ public:
      * @return bool
      */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|User")
-	bool BIsPhoneVerified() { return SteamUser()->BIsPhoneVerified(); }
+	bool BIsPhoneVerified() { STEAMBRIDGE_TRACE_SCOPE(USteamUser::BIsPhoneVerified); return SteamBridgeUser()->BIsPhoneVerified(); }
 
 	/**
      * Checks whether the current user has Steam Guard two factor authentication enabled on their account.
@@ -107,7 +109,7 @@ public:
      * @return bool
      */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|User")
-	bool BIsTwoFactorEnabled() { return SteamUser()->BIsTwoFactorEnabled(); }
+	bool BIsTwoFactorEnabled() { STEAMBRIDGE_TRACE_SCOPE(USteamUser::BIsTwoFactorEnabled); return SteamBridgeUser()->BIsTwoFactorEnabled(); }
 
 	/**
 	 * Checks if the current user's Steam client is connected to the Steam servers.
@@ -119,7 +121,7 @@ public:
      * @return bool
      */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|User")
-	bool BLoggedOn() { return SteamUser()->BLoggedOn(); }
+	bool BLoggedOn() { STEAMBRIDGE_TRACE_SCOPE(USteamUser::BLoggedOn); return SteamBridgeUser()->BLoggedOn(); }
 
 	/**
      * Cancels an auth ticket received from GetAuthSessionTicket. This should be called when no longer playing with the specified entity.
@@ -128,7 +130,7 @@ public:
      * @return void
      */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|User")
-	void CancelAuthTicket(FHAuthTicket AuthTicket) { SteamUser()->CancelAuthTicket(AuthTicket); }
+	void CancelAuthTicket(FHAuthTicket AuthTicket) { STEAMBRIDGE_TRACE_SCOPE(USteamUser::CancelAuthTicket); SteamBridgeUser()->CancelAuthTicket(AuthTicket); }
 
 	/**
      * Decodes the compressed voice data returned by GetVoice.
@@ -149,7 +151,7 @@ public:
      * @return void
      */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|User")
-	void EndAuthSession(FSteamID SteamID) { SteamUser()->EndAuthSession(SteamID.Value); }
+	void EndAuthSession(FSteamID SteamID) { STEAMBRIDGE_TRACE_SCOPE(USteamUser::EndAuthSession); SteamBridgeUser()->EndAuthSession(SteamID.Value); }
 
 	/**
 	 * Retrieve a authentication ticket to be sent to the entity who wishes to authenticate you.
@@ -174,7 +176,7 @@ public:
      * @return ESteamVoiceResult
      */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|User")
-	ESteamVoiceResult GetAvailableVoice(int32& CompressedSize) { return (ESteamVoiceResult)SteamUser()->GetAvailableVoice((uint32*)&CompressedSize); }
+	ESteamVoiceResult GetAvailableVoice(int32& CompressedSize) { STEAMBRIDGE_TRACE_SCOPE(USteamUser::GetAvailableVoice); return (ESteamVoiceResult)SteamBridgeUser()->GetAvailableVoice((uint32*)&CompressedSize); }
 
 	/**
 	 * Retrieves anti indulgence / duration control for current user / game combination.
@@ -182,7 +184,7 @@ public:
 	 * @return FSteamAPICall
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|User")
-	FSteamAPICall GetDurationControl() { return (FSteamAPICall)SteamUser()->GetDurationControl(); }
+	FSteamAPICall GetDurationControl() { STEAMBRIDGE_TRACE_SCOPE(USteamUser::GetDurationControl); return FSteamBridgeTrace::APICallIssued(SteamBridgeUser()->GetDurationControl()); }
 
 	/**
 	 * Retrieve an encrypted ticket.
@@ -205,7 +207,7 @@ public:
 	 * @return int32
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|User")
-	int32 GetGameBadgeLevel(int32 nSeries, bool bFoil) { return SteamUser()->GetGameBadgeLevel(nSeries, bFoil); }
+	int32 GetGameBadgeLevel(int32 nSeries, bool bFoil) { STEAMBRIDGE_TRACE_SCOPE(USteamUser::GetGameBadgeLevel); return SteamBridgeUser()->GetGameBadgeLevel(nSeries, bFoil); }
 
 	/**
 	 * Gets Steam user handle that this interface represents.
@@ -214,7 +216,7 @@ public:
 	 * @return FHSteamUser
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|User")
-	FHSteamUser GetHSteamUser() { return (FHSteamUser)SteamUser()->GetHSteamUser(); }
+	FHSteamUser GetHSteamUser() { STEAMBRIDGE_TRACE_SCOPE(USteamUser::GetHSteamUser); return (FHSteamUser)SteamBridgeUser()->GetHSteamUser(); }
 
 	/**
 	 * Gets the Steam level of the user, as shown on their Steam community profile.
@@ -222,7 +224,7 @@ public:
 	 * @return int32
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|User")
-	int32 GetPlayerSteamLevel() { return SteamUser()->GetPlayerSteamLevel(); }
+	int32 GetPlayerSteamLevel() { STEAMBRIDGE_TRACE_SCOPE(USteamUser::GetPlayerSteamLevel); return SteamBridgeUser()->GetPlayerSteamLevel(); }
 
 	/**
 	 * Gets the Steam ID of the account currently logged into the Steam client. This is commonly called the 'current user', or 'local user'.
@@ -231,7 +233,7 @@ public:
 	 * @return FSteamID
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|User")
-	FSteamID GetSteamID() { return SteamUser()->GetSteamID().ConvertToUint64(); }
+	FSteamID GetSteamID() { STEAMBRIDGE_TRACE_SCOPE(USteamUser::GetSteamID); return SteamBridgeUser()->GetSteamID().ConvertToUint64(); }
 
 	/**
 	 * Read captured audio data from the microphone buffer.
@@ -257,7 +259,7 @@ public:
 	 * @return int32
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|User")
-	int32 GetVoiceOptimalSampleRate() { return (uint32)SteamUser()->GetVoiceOptimalSampleRate(); }
+	int32 GetVoiceOptimalSampleRate() { STEAMBRIDGE_TRACE_SCOPE(USteamUser::GetVoiceOptimalSampleRate); return (uint32)SteamBridgeUser()->GetVoiceOptimalSampleRate(); }
 
 	/**
 	 * This starts the state machine for authenticating the game client with the game server.
@@ -282,7 +284,7 @@ public:
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|User")
-	void StartVoiceRecording() { SteamUser()->StartVoiceRecording(); }
+	void StartVoiceRecording() { STEAMBRIDGE_TRACE_SCOPE(USteamUser::StartVoiceRecording); SteamBridgeUser()->StartVoiceRecording(); }
 
 	/**
 	 * Stops voice recording.
@@ -292,7 +294,7 @@ public:
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|User")
-	void StopVoiceRecording() { SteamUser()->StopVoiceRecording(); }
+	void StopVoiceRecording() { STEAMBRIDGE_TRACE_SCOPE(USteamUser::StopVoiceRecording); SteamBridgeUser()->StopVoiceRecording(); }
 
 	/**
 	 * Notify the game server that we are disconnecting.
@@ -303,7 +305,7 @@ public:
 	 * @return void
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SteamBridgeCore|User")
-	void TerminateGameConnection(int32 IPServer, int32 PortServer) { SteamUser()->TerminateGameConnection(IPServer, PortServer); }
+	void TerminateGameConnection(int32 IPServer, int32 PortServer) { STEAMBRIDGE_TRACE_SCOPE(USteamUser::TerminateGameConnection); SteamBridgeUser()->TerminateGameConnection(IPServer, PortServer); }
 
 	/**
 	 * Checks if the user owns a specific piece of Downloadable Content (DLC).
@@ -314,7 +316,7 @@ public:
 	 * @return ESteamUserHasLicenseForAppResult
 	 */
 	UFUNCTION(BlueprintPure, Category = "SteamBridgeCore|User")
-	ESteamUserHasLicenseForAppResult UserHasLicenseForApp(FSteamID steamID, int32 appID) { return (ESteamUserHasLicenseForAppResult)SteamUser()->UserHasLicenseForApp(steamID.Value, appID); }
+	ESteamUserHasLicenseForAppResult UserHasLicenseForApp(FSteamID steamID, int32 appID) { STEAMBRIDGE_TRACE_SCOPE(USteamUser::UserHasLicenseForApp); return (ESteamUserHasLicenseForAppResult)SteamBridgeUser()->UserHasLicenseForApp(steamID.Value, appID); }
 
 	/** Delegates */
 
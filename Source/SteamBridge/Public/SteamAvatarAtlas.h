@@ -0,0 +1,79 @@
+// Copyright 2020 Russ 'trdwll' Treadwell <trdwll.com>. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/GCObject.h"
+
+class UTexture2D;
+
+/**
+ * Packs avatars of one size into shared texture pages, so a list of hundreds of avatars draws from a handful of textures.
+ * Pages are a grid of equally sized slots and are added as they fill up, to a maximum; after that the least recently used avatar gives up its slot.
+ * Keyed by Steam image handle. Game thread only.
+ */
+class STEAMBRIDGE_API FSteamAvatarAtlas final : public FGCObject
+{
+public:
+	/**
+	 * @param int32 AvatarSize The width and height of the avatars, images of any other size are rejected
+	 * @param int32 PageSize The width and height of each page
+	 * @param int32 MaxPages
+	 */
+	FSteamAvatarAtlas(int32 AvatarSize, int32 PageSize, int32 MaxPages);
+
+	/**
+	 * Gets the page and UV rect of the image, copying it into a slot on a miss.
+	 *
+	 * @param int32 Image
+	 * @param UTexture2D * & Page
+	 * @param FBox2D & UV Inset by half a texel so filtering doesn't bleed in the neighbouring avatars
+	 * @return bool false if Steam doesn't have the image (yet)
+	 */
+	bool Get(int32 Image, UTexture2D*& Page, FBox2D& UV);
+
+	/**
+	 * Copies the image into its slot again, for when Steam reports it has (re)loaded.
+	 *
+	 * @param int32 Image
+	 * @return bool Whether the image was in the atlas
+	 */
+	bool Refresh(int32 Image);
+
+	/** Frees the image's slot. */
+	void Release(int32 Image);
+
+	int32 GetAvatarSize() const { return m_AvatarSize; }
+	int32 GetNumPages() const { return m_Pages.Num(); }
+	int32 Num() const { return m_Entries.Num(); }
+
+	virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
+	virtual FString GetReferencerName() const override { return TEXT("FSteamAvatarAtlas"); }
+
+private:
+	using FLRUNode = TDoubleLinkedList<int32>::TDoubleLinkedListNode;
+
+	struct FEntry
+	{
+		int32 Slot;
+		FLRUNode* Node;
+	};
+
+	/** Gets a free slot, adding a page or evicting the least recently used avatar when there's none. */
+	int32 AllocateSlot();
+	void AddPage();
+	bool Upload(int32 Image, int32 Slot);
+	void GetSlot(int32 Slot, UTexture2D*& Page, FBox2D& UV) const;
+
+	const int32 m_AvatarSize;
+	const int32 m_PageSize;
+	const int32 m_SlotsPerRow;
+	const int32 m_MaxPages;
+
+	TArray<UTexture2D*> m_Pages;
+	TArray<int32> m_FreeSlots;
+	TMap<int32, FEntry> m_Entries;
+
+	// Images from most to least recently used
+	TDoubleLinkedList<int32> m_LRU;
+};
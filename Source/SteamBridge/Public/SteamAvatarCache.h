@@ -0,0 +1,81 @@
+// Copyright 2020 Russ 'trdwll' Treadwell <trdwll.com>. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SteamEnums.h"
+#include "UObject/GCObject.h"
+
+class UTexture2D;
+
+/**
+ * Avatar textures by Steam image handle and size, so showing the same avatar again doesn't create and upload another texture.
+ * Once the textures exceed the budget the least recently used ones are dropped (a texture still referenced elsewhere stays alive). Game thread only.
+ */
+class STEAMBRIDGE_API FSteamAvatarCache final : public FGCObject
+{
+public:
+	FSteamAvatarCache() : m_Bytes(0) {}
+
+	/**
+	 * Gets the texture for the image, creating it on a miss and then evicting down to BudgetBytes.
+	 *
+	 * @param int32 Image
+	 * @param ESteamAvatarSize Size
+	 * @param int64 BudgetBytes
+	 * @param bool * bOutCreated Set to whether the texture was just created
+	 * @return UTexture2D* nullptr if Steam doesn't have the image (yet)
+	 */
+	UTexture2D* Get(int32 Image, ESteamAvatarSize Size, int64 BudgetBytes, bool* bOutCreated = nullptr);
+
+	/**
+	 * Copies the image into its cached texture again, for when Steam reports it has (re)loaded.
+	 *
+	 * @param int32 Image
+	 * @param ESteamAvatarSize Size
+	 * @return bool Whether the image was cached
+	 */
+	bool Refresh(int32 Image, ESteamAvatarSize Size);
+
+	void Empty();
+
+	int32 Num() const { return m_Entries.Num(); }
+	int64 GetBytes() const { return m_Bytes; }
+
+	/**
+	 * Copies a Steam image into a texture, reusing Texture when it's the same size.
+	 *
+	 * @param int32 Image
+	 * @param UTexture2D * Texture
+	 * @return UTexture2D* nullptr if Steam doesn't have the image (yet)
+	 */
+	static UTexture2D* CopyToTexture(int32 Image, UTexture2D* Texture = nullptr);
+
+	/** The size an avatar of the given width was requested as. */
+	static ESteamAvatarSize GetSizeForWidth(int32 Width) { return Width <= 32 ? ESteamAvatarSize::Small : Width <= 64 ? ESteamAvatarSize::Medium : ESteamAvatarSize::Large; }
+
+	virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
+	virtual FString GetReferencerName() const override { return TEXT("FSteamAvatarCache"); }
+
+private:
+	static uint64 MakeKey(int32 Image, ESteamAvatarSize Size) { return ((uint64)Size << 32) | (uint32)Image; }
+
+	using FLRUNode = TDoubleLinkedList<uint64>::TDoubleLinkedListNode;
+
+	struct FEntry
+	{
+		UTexture2D* Texture;
+		int64 Bytes;
+		FLRUNode* Node;
+	};
+
+	void Touch(FEntry& Entry);
+	void EvictTo(int64 BudgetBytes);
+
+	TMap<uint64, FEntry> m_Entries;
+
+	// Keys from most to least recently used
+	TDoubleLinkedList<uint64> m_LRU;
+
+	int64 m_Bytes;
+};
@@ -0,0 +1,73 @@
+// Copyright 2020 Russ 'trdwll' Treadwell <trdwll.com>. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SteamEnums.h"
+#include "UObject/GCObject.h"
+
+class UTexture2D;
+
+/**
+ * Keeps the last avatar seen for each user and size on disk (zlib compressed BGRA), so the next session can show it before Steam has loaded it.
+ * Steam image handles only live for one session, so entries are keyed by SteamID and size and revalidated by comparing a CRC of the pixels.
+ * Files are read on the game thread (they're a few KB) and written one at a time by a worker draining a write queue, each through a temporary file
+ * that's renamed over the old one. Once the directory grows past the budget the least recently used files are deleted. Game thread only.
+ */
+class STEAMBRIDGE_API FSteamAvatarDiskCache final : public FGCObject
+{
+public:
+	/**
+	 * @param const FString & Directory
+	 * @param int64 BudgetBytes How large the directory may grow, 0 for no limit
+	 */
+	FSteamAvatarDiskCache(const FString& Directory, int64 BudgetBytes);
+	virtual ~FSteamAvatarDiskCache();
+
+	/**
+	 * Gets the avatar as it was stored, reading it from disk the first time.
+	 *
+	 * @param uint64 SteamID
+	 * @param ESteamAvatarSize Size
+	 * @return UTexture2D* nullptr if nothing was stored
+	 */
+	UTexture2D* Load(uint64 SteamID, ESteamAvatarSize Size);
+
+	/**
+	 * Writes the texture's pixels out, unless they're what's already stored. Also drops the texture Load returned, Steam's is current.
+	 *
+	 * @param uint64 SteamID
+	 * @param ESteamAvatarSize Size
+	 * @param UTexture2D * Texture A BGRA8 texture that still has its mip data, e.g. from FSteamAvatarCache
+	 * @return void
+	 */
+	void Store(uint64 SteamID, ESteamAvatarSize Size, UTexture2D* Texture);
+
+	virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
+	virtual FString GetReferencerName() const override { return TEXT("FSteamAvatarDiskCache"); }
+
+private:
+	struct FKey
+	{
+		uint64 SteamID;
+		ESteamAvatarSize Size;
+
+		bool operator==(const FKey& Other) const { return SteamID == Other.SteamID && Size == Other.Size; }
+		friend uint32 GetTypeHash(const FKey& Key) { return HashCombine(GetTypeHash(Key.SteamID), (uint32)Key.Size); }
+	};
+
+	FString GetPath(const FKey& Key) const;
+
+	const FString m_Directory;
+
+	/** Shared with the worker writing the files, which may outlive the cache */
+	struct FWriteQueue;
+	TSharedRef<FWriteQueue, ESPMode::ThreadSafe> m_WriteQueue;
+
+	/** The CRC of what's stored (or being written) for each avatar that was read or written this session */
+	TMap<FKey, uint32> m_StoredCrcs;
+	/** Avatars read from disk, until Steam's own replaces them */
+	TMap<FKey, UTexture2D*> m_Loaded;
+	/** Avatars there's no file for, so the disk isn't checked again */
+	TSet<FKey> m_Missing;
+};
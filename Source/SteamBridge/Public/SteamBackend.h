@@ -0,0 +1,291 @@
+// Copyright 2020 Russ 'trdwll' Treadwell <trdwll.com>. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Steam.h"
+
+// The subset of the Steamworks interfaces SteamBridge calls, with the SDK's signatures, so the wrappers can run against something other than Steam.
+
+/** Persona, friends list, clan, overlay and rich presence calls. Mirrors ISteamFriends. */
+class ISteamBridgeFriends
+{
+public:
+	virtual ~ISteamBridgeFriends() {}
+
+	virtual const char* GetPersonaName() = 0;
+	virtual SteamAPICall_t SetPersonaName(const char* pchPersonaName) = 0;
+	virtual EPersonaState GetPersonaState() = 0;
+	virtual int GetFriendCount(int iFriendFlags) = 0;
+	virtual CSteamID GetFriendByIndex(int iFriend, int iFriendFlags) = 0;
+	virtual EFriendRelationship GetFriendRelationship(CSteamID steamIDFriend) = 0;
+	virtual EPersonaState GetFriendPersonaState(CSteamID steamIDFriend) = 0;
+	virtual const char* GetFriendPersonaName(CSteamID steamIDFriend) = 0;
+	virtual bool GetFriendGamePlayed(CSteamID steamIDFriend, FriendGameInfo_t* pFriendGameInfo) = 0;
+	virtual const char* GetFriendPersonaNameHistory(CSteamID steamIDFriend, int iPersonaName) = 0;
+	virtual int GetFriendSteamLevel(CSteamID steamIDFriend) = 0;
+	virtual const char* GetPlayerNickname(CSteamID steamIDPlayer) = 0;
+	virtual int GetFriendsGroupCount() = 0;
+	virtual FriendsGroupID_t GetFriendsGroupIDByIndex(int iFG) = 0;
+	virtual const char* GetFriendsGroupName(FriendsGroupID_t friendsGroupID) = 0;
+	virtual int GetFriendsGroupMembersCount(FriendsGroupID_t friendsGroupID) = 0;
+	virtual void GetFriendsGroupMembersList(FriendsGroupID_t friendsGroupID, CSteamID* pOutSteamIDMembers, int nMembersCount) = 0;
+	virtual bool HasFriend(CSteamID steamIDFriend, int iFriendFlags) = 0;
+	virtual int GetClanCount() = 0;
+	virtual CSteamID GetClanByIndex(int iClan) = 0;
+	virtual const char* GetClanName(CSteamID steamIDClan) = 0;
+	virtual const char* GetClanTag(CSteamID steamIDClan) = 0;
+	virtual bool GetClanActivityCounts(CSteamID steamIDClan, int* pnOnline, int* pnInGame, int* pnChatting) = 0;
+	virtual SteamAPICall_t DownloadClanActivityCounts(CSteamID* psteamIDClans, int cClansToRequest) = 0;
+	virtual int GetFriendCountFromSource(CSteamID steamIDSource) = 0;
+	virtual CSteamID GetFriendFromSourceByIndex(CSteamID steamIDSource, int iFriend) = 0;
+	virtual bool IsUserInSource(CSteamID steamIDUser, CSteamID steamIDSource) = 0;
+	virtual void SetInGameVoiceSpeaking(CSteamID steamIDUser, bool bSpeaking) = 0;
+	virtual void ActivateGameOverlay(const char* pchDialog) = 0;
+	virtual void ActivateGameOverlayToUser(const char* pchDialog, CSteamID steamID) = 0;
+	virtual void ActivateGameOverlayToWebPage(const char* pchURL, EActivateGameOverlayToWebPageMode eMode) = 0;
+	virtual void ActivateGameOverlayToStore(AppId_t nAppID, EOverlayToStoreFlag eFlag) = 0;
+	virtual void SetPlayedWith(CSteamID steamIDUserPlayedWith) = 0;
+	virtual void ActivateGameOverlayInviteDialog(CSteamID steamIDLobby) = 0;
+	virtual int GetSmallFriendAvatar(CSteamID steamIDFriend) = 0;
+	virtual int GetMediumFriendAvatar(CSteamID steamIDFriend) = 0;
+	virtual int GetLargeFriendAvatar(CSteamID steamIDFriend) = 0;
+	virtual bool RequestUserInformation(CSteamID steamIDUser, bool bRequireNameOnly) = 0;
+	virtual SteamAPICall_t RequestClanOfficerList(CSteamID steamIDClan) = 0;
+	virtual CSteamID GetClanOwner(CSteamID steamIDClan) = 0;
+	virtual int GetClanOfficerCount(CSteamID steamIDClan) = 0;
+	virtual CSteamID GetClanOfficerByIndex(CSteamID steamIDClan, int iOfficer) = 0;
+	virtual uint32 GetUserRestrictions() = 0;
+	virtual bool SetRichPresence(const char* pchKey, const char* pchValue) = 0;
+	virtual void ClearRichPresence() = 0;
+	virtual const char* GetFriendRichPresence(CSteamID steamIDFriend, const char* pchKey) = 0;
+	virtual int GetFriendRichPresenceKeyCount(CSteamID steamIDFriend) = 0;
+	virtual const char* GetFriendRichPresenceKeyByIndex(CSteamID steamIDFriend, int iKey) = 0;
+	virtual void RequestFriendRichPresence(CSteamID steamIDFriend) = 0;
+	virtual bool InviteUserToGame(CSteamID steamIDFriend, const char* pchConnectString) = 0;
+	virtual int GetCoplayFriendCount() = 0;
+	virtual CSteamID GetCoplayFriend(int iCoplayFriend) = 0;
+	virtual AppId_t GetFriendCoplayGame(CSteamID steamIDFriend) = 0;
+	virtual SteamAPICall_t JoinClanChatRoom(CSteamID steamIDClan) = 0;
+	virtual bool LeaveClanChatRoom(CSteamID steamIDClan) = 0;
+	virtual int GetClanChatMemberCount(CSteamID steamIDClan) = 0;
+	virtual CSteamID GetChatMemberByIndex(CSteamID steamIDClan, int iUser) = 0;
+	virtual bool SendClanChatMessage(CSteamID steamIDClanChat, const char* pchText) = 0;
+	virtual int GetClanChatMessage(CSteamID steamIDClanChat, int iMessage, void* prgchText, int cchTextMax, EChatEntryType* peChatEntryType, CSteamID* psteamidChatter) = 0;
+	virtual bool IsClanChatAdmin(CSteamID steamIDClanChat, CSteamID steamIDUser) = 0;
+	virtual bool IsClanChatWindowOpenInSteam(CSteamID steamIDClanChat) = 0;
+	virtual bool OpenClanChatWindowInSteam(CSteamID steamIDClanChat) = 0;
+	virtual bool CloseClanChatWindowInSteam(CSteamID steamIDClanChat) = 0;
+	virtual bool SetListenForFriendsMessages(bool bInterceptEnabled) = 0;
+	virtual bool ReplyToFriendMessage(CSteamID steamIDFriend, const char* pchMsgToSend) = 0;
+	virtual int GetFriendMessage(CSteamID steamIDFriend, int iMessageID, void* pvData, int cubData, EChatEntryType* peChatEntryType) = 0;
+	virtual SteamAPICall_t GetFollowerCount(CSteamID steamID) = 0;
+	virtual SteamAPICall_t IsFollowing(CSteamID steamID) = 0;
+	virtual SteamAPICall_t EnumerateFollowingList(uint32 unStartIndex) = 0;
+	virtual bool IsClanPublic(CSteamID steamIDClan) = 0;
+	virtual bool IsClanOfficialGameGroup(CSteamID steamIDClan) = 0;
+};
+
+/** Local user, auth ticket and voice calls. Mirrors ISteamUser. */
+class ISteamBridgeUser
+{
+public:
+	virtual ~ISteamBridgeUser() {}
+
+	virtual HSteamUser GetHSteamUser() = 0;
+	virtual bool BLoggedOn() = 0;
+	virtual CSteamID GetSteamID() = 0;
+	virtual int InitiateGameConnection(void* pAuthBlob, int cbMaxAuthBlob, CSteamID steamIDGameServer, uint32 unIPServer, uint16 usPortServer, bool bSecure) = 0;
+	virtual void TerminateGameConnection(uint32 unIPServer, uint16 usPortServer) = 0;
+	virtual void StartVoiceRecording() = 0;
+	virtual void StopVoiceRecording() = 0;
+	virtual EVoiceResult GetAvailableVoice(uint32* pcbCompressed) = 0;
+	virtual EVoiceResult GetVoice(bool bWantCompressed, void* pDestBuffer, uint32 cbDestBufferSize, uint32* nBytesWritten) = 0;
+	virtual EVoiceResult DecompressVoice(const void* pCompressed, uint32 cbCompressed, void* pDestBuffer, uint32 cbDestBufferSize, uint32* nBytesWritten, uint32 nDesiredSampleRate) = 0;
+	virtual uint32 GetVoiceOptimalSampleRate() = 0;
+	virtual HAuthTicket GetAuthSessionTicket(void* pTicket, int cbMaxTicket, uint32* pcbTicket) = 0;
+	virtual EBeginAuthSessionResult BeginAuthSession(const void* pAuthTicket, int cbAuthTicket, CSteamID steamID) = 0;
+	virtual void EndAuthSession(CSteamID steamID) = 0;
+	virtual void CancelAuthTicket(HAuthTicket hAuthTicket) = 0;
+	virtual EUserHasLicenseForAppResult UserHasLicenseForApp(CSteamID steamID, AppId_t appID) = 0;
+	virtual bool BIsBehindNAT() = 0;
+	virtual void AdvertiseGame(CSteamID steamIDGameServer, uint32 unIPServer, uint16 usPortServer) = 0;
+	virtual bool GetEncryptedAppTicket(void* pTicket, int cbMaxTicket, uint32* pcbTicket) = 0;
+	virtual int GetGameBadgeLevel(int nSeries, bool bFoil) = 0;
+	virtual int GetPlayerSteamLevel() = 0;
+	virtual bool BIsPhoneVerified() = 0;
+	virtual bool BIsTwoFactorEnabled() = 0;
+	virtual bool BIsPhoneIdentifying() = 0;
+	virtual bool BIsPhoneRequiringVerification() = 0;
+	virtual SteamAPICall_t GetDurationControl() = 0;
+};
+
+/** Game server session, auth and server browser calls. Mirrors ISteamGameServer. */
+class ISteamBridgeGameServer
+{
+public:
+	virtual ~ISteamBridgeGameServer() {}
+
+	virtual void SetProduct(const char* pszProduct) = 0;
+	virtual void SetGameDescription(const char* pszGameDescription) = 0;
+	virtual void SetModDir(const char* pszModDir) = 0;
+	virtual void SetDedicatedServer(bool bDedicated) = 0;
+	virtual void LogOn(const char* pszToken) = 0;
+	virtual void LogOnAnonymous() = 0;
+	virtual void LogOff() = 0;
+	virtual bool BLoggedOn() = 0;
+	virtual bool BSecure() = 0;
+	virtual CSteamID GetSteamID() = 0;
+	virtual bool WasRestartRequested() = 0;
+	virtual void SetMaxPlayerCount(int cPlayersMax) = 0;
+	virtual void SetBotPlayerCount(int cBotplayers) = 0;
+	virtual void SetServerName(const char* pszServerName) = 0;
+	virtual void SetMapName(const char* pszMapName) = 0;
+	virtual void SetPasswordProtected(bool bPasswordProtected) = 0;
+	virtual void SetSpectatorPort(uint16 unSpectatorPort) = 0;
+	virtual void SetSpectatorServerName(const char* pszSpectatorServerName) = 0;
+	virtual void ClearAllKeyValues() = 0;
+	virtual void SetKeyValue(const char* pKey, const char* pValue) = 0;
+	virtual void SetGameTags(const char* pchGameTags) = 0;
+	virtual void SetGameData(const char* pchGameData) = 0;
+	virtual void SetRegion(const char* pszRegion) = 0;
+	virtual HAuthTicket GetAuthSessionTicket(void* pTicket, int cbMaxTicket, uint32* pcbTicket) = 0;
+	virtual EBeginAuthSessionResult BeginAuthSession(const void* pAuthTicket, int cbAuthTicket, CSteamID steamID) = 0;
+	virtual void EndAuthSession(CSteamID steamID) = 0;
+	virtual void CancelAuthTicket(HAuthTicket hAuthTicket) = 0;
+	virtual EUserHasLicenseForAppResult UserHasLicenseForApp(CSteamID steamID, AppId_t appID) = 0;
+	virtual bool RequestUserGroupStatus(CSteamID steamIDUser, CSteamID steamIDGroup) = 0;
+	virtual void EnableHeartbeats(bool bActive) = 0;
+	virtual void SetHeartbeatInterval(int iHeartbeatInterval) = 0;
+	virtual void ForceHeartbeat() = 0;
+	virtual SteamAPICall_t AssociateWithClan(CSteamID steamIDClan) = 0;
+};
+
+/** HTTP requests and cookie containers. Mirrors ISteamHTTP. */
+class ISteamBridgeHTTP
+{
+public:
+	virtual ~ISteamBridgeHTTP() {}
+
+	virtual HTTPRequestHandle CreateHTTPRequest(EHTTPMethod eHTTPRequestMethod, const char* pchAbsoluteURL) = 0;
+	virtual bool SetHTTPRequestContextValue(HTTPRequestHandle hRequest, uint64 ulContextValue) = 0;
+	virtual bool SetHTTPRequestNetworkActivityTimeout(HTTPRequestHandle hRequest, uint32 unTimeoutSeconds) = 0;
+	virtual bool SetHTTPRequestHeaderValue(HTTPRequestHandle hRequest, const char* pchHeaderName, const char* pchHeaderValue) = 0;
+	virtual bool SetHTTPRequestGetOrPostParameter(HTTPRequestHandle hRequest, const char* pchParamName, const char* pchParamValue) = 0;
+	virtual bool SendHTTPRequest(HTTPRequestHandle hRequest, SteamAPICall_t* pCallHandle) = 0;
+	virtual bool SendHTTPRequestAndStreamResponse(HTTPRequestHandle hRequest, SteamAPICall_t* pCallHandle) = 0;
+	virtual bool DeferHTTPRequest(HTTPRequestHandle hRequest) = 0;
+	virtual bool PrioritizeHTTPRequest(HTTPRequestHandle hRequest) = 0;
+	virtual bool GetHTTPResponseHeaderSize(HTTPRequestHandle hRequest, const char* pchHeaderName, uint32* unResponseHeaderSize) = 0;
+	virtual bool GetHTTPResponseHeaderValue(HTTPRequestHandle hRequest, const char* pchHeaderName, uint8* pHeaderValueBuffer, uint32 unBufferSize) = 0;
+	virtual bool GetHTTPResponseBodySize(HTTPRequestHandle hRequest, uint32* unBodySize) = 0;
+	virtual bool GetHTTPResponseBodyData(HTTPRequestHandle hRequest, uint8* pBodyDataBuffer, uint32 unBufferSize) = 0;
+	virtual bool GetHTTPStreamingResponseBodyData(HTTPRequestHandle hRequest, uint32 cOffset, uint8* pBodyDataBuffer, uint32 unBufferSize) = 0;
+	virtual bool ReleaseHTTPRequest(HTTPRequestHandle hRequest) = 0;
+	virtual bool GetHTTPDownloadProgressPct(HTTPRequestHandle hRequest, float* pflPercentOut) = 0;
+	virtual bool SetHTTPRequestRawPostBody(HTTPRequestHandle hRequest, const char* pchContentType, uint8* pubBody, uint32 unBodyLen) = 0;
+	virtual HTTPCookieContainerHandle CreateCookieContainer(bool bAllowResponsesToModify) = 0;
+	virtual bool ReleaseCookieContainer(HTTPCookieContainerHandle hCookieContainer) = 0;
+	virtual bool SetCookie(HTTPCookieContainerHandle hCookieContainer, const char* pchHost, const char* pchUrl, const char* pchCookie) = 0;
+	virtual bool SetHTTPRequestCookieContainer(HTTPRequestHandle hRequest, HTTPCookieContainerHandle hCookieContainer) = 0;
+	virtual bool SetHTTPRequestUserAgentInfo(HTTPRequestHandle hRequest, const char* pchUserAgentInfo) = 0;
+	virtual bool SetHTTPRequestRequiresVerifiedCertificate(HTTPRequestHandle hRequest, bool bRequireVerifiedCertificate) = 0;
+	virtual bool SetHTTPRequestAbsoluteTimeoutMS(HTTPRequestHandle hRequest, uint32 unMilliseconds) = 0;
+	virtual bool GetHTTPRequestWasTimedOut(HTTPRequestHandle hRequest, bool* pbWasTimedOut) = 0;
+};
+
+/** Inventory result and pricing calls. Mirrors ISteamInventory. */
+class ISteamBridgeInventory
+{
+public:
+	virtual ~ISteamBridgeInventory() {}
+
+	virtual bool GetAllItems(SteamInventoryResult_t* pResultHandle) = 0;
+	virtual bool AddPromoItem(SteamInventoryResult_t* pResultHandle, SteamItemDef_t itemDef) = 0;
+	virtual bool AddPromoItems(SteamInventoryResult_t* pResultHandle, const SteamItemDef_t* pArrayItemDefs, uint32 unArrayLength) = 0;
+	virtual bool ConsumeItem(SteamInventoryResult_t* pResultHandle, SteamItemInstanceID_t itemConsume, uint32 unQuantity) = 0;
+	virtual bool CheckResultSteamID(SteamInventoryResult_t resultHandle, CSteamID steamIDExpected) = 0;
+	virtual bool DeserializeResult(SteamInventoryResult_t* pOutResultHandle, const void* pBuffer, uint32 unBufferSize, bool bRESERVED_MUST_BE_FALSE) = 0;
+	virtual void DestroyResult(SteamInventoryResult_t resultHandle) = 0;
+	virtual bool GetItemPrice(SteamItemDef_t iDefinition, uint64* pCurrentPrice, uint64* pBasePrice) = 0;
+	virtual uint32 GetNumItemsWithPrices() = 0;
+};
+
+/** Image loading, used for avatars. Mirrors ISteamUtils. */
+class ISteamBridgeUtils
+{
+public:
+	virtual ~ISteamBridgeUtils() {}
+
+	virtual bool GetImageSize(int iImage, uint32* pnWidth, uint32* pnHeight) = 0;
+	virtual bool GetImageRGBA(int iImage, uint8* pubDest, int nDestBufferSize) = 0;
+};
+
+/**
+ * Where the wrappers send their Steamworks calls. Steam itself by default, see FSteamBackend::Set.
+ */
+class ISteamBridgeBackend
+{
+public:
+	virtual ~ISteamBridgeBackend() {}
+
+	virtual ISteamBridgeFriends* Friends() = 0;
+	virtual ISteamBridgeUser* User() = 0;
+	virtual ISteamBridgeGameServer* GameServer() = 0;
+	virtual ISteamBridgeHTTP* HTTP() = 0;
+	virtual ISteamBridgeInventory* Inventory() = 0;
+	virtual ISteamBridgeUtils* Utils() = 0;
+
+	/** Called at the start of each SteamBridge tick, before the queued callbacks are dispatched. */
+	virtual void Tick(double Now) {}
+
+	/** Whether the backend posts its own callbacks to the dispatcher instead of them coming from the Steam pipes. */
+	virtual bool IsStandIn() const { return false; }
+};
+
+/**
+ * Holds the active backend. The interfaces are cached so a wrapper call costs a single virtual call on top of the Steam one.
+ */
+class STEAMBRIDGE_API FSteamBackend
+{
+public:
+	static ISteamBridgeBackend& Get() { return *m_Backend; }
+
+	/**
+	 * Replaces the active backend. Must be done before any wrapper is used, i.e. on module startup.
+	 *
+	 * @param TUniquePtr<ISteamBridgeBackend> && Backend
+	 * @return void
+	 */
+	static void Set(TUniquePtr<ISteamBridgeBackend>&& Backend);
+
+	/** Goes back to Steam and destroys the backend that was set. */
+	static void Reset();
+
+	static ISteamBridgeFriends* Friends() { return m_Friends; }
+	static ISteamBridgeUser* User() { return m_User; }
+	static ISteamBridgeGameServer* GameServer() { return m_GameServer; }
+	static ISteamBridgeHTTP* HTTP() { return m_HTTP; }
+	static ISteamBridgeInventory* Inventory() { return m_Inventory; }
+	static ISteamBridgeUtils* Utils() { return m_Utils; }
+
+private:
+	static void Use(ISteamBridgeBackend& Backend);
+
+	static TUniquePtr<ISteamBridgeBackend> m_OwnedBackend;
+	static ISteamBridgeBackend* m_Backend;
+	static ISteamBridgeFriends* m_Friends;
+	static ISteamBridgeUser* m_User;
+	static ISteamBridgeGameServer* m_GameServer;
+	static ISteamBridgeHTTP* m_HTTP;
+	static ISteamBridgeInventory* m_Inventory;
+	static ISteamBridgeUtils* m_Utils;
+};
+
+// Drop-in replacements for the Steamworks accessors, used by the wrappers
+FORCEINLINE ISteamBridgeFriends* SteamBridgeFriends() { return FSteamBackend::Friends(); }
+FORCEINLINE ISteamBridgeUser* SteamBridgeUser() { return FSteamBackend::User(); }
+FORCEINLINE ISteamBridgeGameServer* SteamBridgeGameServer() { return FSteamBackend::GameServer(); }
+FORCEINLINE ISteamBridgeHTTP* SteamBridgeHTTP() { return FSteamBackend::HTTP(); }
+FORCEINLINE ISteamBridgeInventory* SteamBridgeInventory() { return FSteamBackend::Inventory(); }
+FORCEINLINE ISteamBridgeUtils* SteamBridgeUtils() { return FSteamBackend::Utils(); }
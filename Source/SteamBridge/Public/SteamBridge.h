@@ -17,6 +17,9 @@ public:
 
 private:
 
+	void StartBackend();
+	void StartCallbackDispatch();
+
 	bool HandleSettingsSaved();
 	void RegisterSettings();
 	void UnregisterSettings();
@@ -6,6 +6,14 @@
 #include "UObject/NoExportTypes.h"
 #include "SteamBridgeSettings.generated.h"
 
+UENUM()
+enum class ESteamCallbackPumpPolicy : uint8
+{
+	ClientOnly UMETA(DisplayName = "Client Only"),
+	ServerOnly UMETA(DisplayName = "Server Only"),
+	Both UMETA(DisplayName = "Client and Server")
+};
+
 /**
  * 
  */
@@ -18,5 +26,100 @@ public:
 	UPROPERTY(EditAnywhere, config, Category = General)
 	bool bTest;
 
+	/**
+	 * Drain Steam callbacks on a dedicated thread (Steam manual dispatch) and replay them on the game thread at the start of each frame.
+	 * Steam is switched to manual dispatch for the whole process, so nothing else (e.g. OnlineSubsystemSteam) may call SteamAPI_RunCallbacks. Requires a restart.
+	 */
+	UPROPERTY(EditAnywhere, config, Category = Callbacks, meta = (DisplayName = "Use Callback Thread", ConfigRestartRequired = true))
+	bool m_bUseCallbackThread;
+
+	/** How long the callback thread sleeps between draining the Steam pipes. */
+	UPROPERTY(EditAnywhere, config, Category = Callbacks, meta = (DisplayName = "Callback Thread Interval (ms)", ClampMin = 1, EditCondition = "m_bUseCallbackThread", ConfigRestartRequired = true))
+	int32 m_CallbackThreadIntervalMs = 10;
+
+	/** Which Steam pipes are pumped for callbacks. A pipe whose API hasn't been initialized is always skipped. Requires a restart. */
+	UPROPERTY(EditAnywhere, config, Category = Callbacks, meta = (DisplayName = "Callback Pump Policy", ConfigRestartRequired = true))
+	ESteamCallbackPumpPolicy m_CallbackPumpPolicy = ESteamCallbackPumpPolicy::Both;
+
+	/**
+	 * How often the client pipe is pumped, 0 for every frame. With the callback thread this is independent of the frame rate,
+	 * without it the pipe is pumped at most once per frame so the effective rate is bound by the frame rate. Requires a restart.
+	 */
+	UPROPERTY(EditAnywhere, config, Category = Callbacks, meta = (DisplayName = "Client Callback Rate (Hz)", ClampMin = 0, ConfigRestartRequired = true))
+	float m_ClientCallbackRateHz = 0.0f;
+
+	/**
+	 * How often the game server pipe is pumped, 0 for every frame. Only with the callback thread does this hold while the server tick is throttled or idle,
+	 * without it the pipe is pumped at most once per frame so the effective rate is bound by the frame rate. Requires a restart.
+	 */
+	UPROPERTY(EditAnywhere, config, Category = Callbacks, meta = (DisplayName = "Server Callback Rate (Hz)", ClampMin = 0, ConfigRestartRequired = true))
+	float m_ServerCallbackRateHz = 0.0f;
+
+	/**
+	 * Maximum time spent replaying callbacks each frame, 0 for no limit. Whatever doesn't fit is carried over to the next frame.
+	 * Auth, connection and game server callbacks are always replayed first and never deferred, neither are HTML surface callbacks. Enables manual dispatch even without the callback thread. Requires a restart.
+	 */
+	UPROPERTY(EditAnywhere, config, Category = Callbacks, meta = (DisplayName = "Callback Budget (us)", ClampMin = 0, ConfigRestartRequired = true))
+	int32 m_CallbackBudgetMicroseconds = 0;
+
+	/**
+	 * PersonaStateChange callbacks for the same user that arrive within this window are merged into a single broadcast with their change flags combined.
+	 * 0 broadcasts every callback as it arrives.
+	 */
+	UPROPERTY(EditAnywhere, config, Category = Callbacks, meta = (DisplayName = "Persona Change Coalesce Window (ms)", ClampMin = 0))
+	int32 m_PersonaCoalesceWindowMs = 0;
+
+	/**
+	 * How long the results of RequestUserInformation, RequestClanOfficerList and GetFollowerCount are reused for the same user or group, 0 to always ask Steam.
+	 * Identical requests that are still in flight always share a single Steam call.
+	 */
+	UPROPERTY(EditAnywhere, config, Category = Requests, meta = (DisplayName = "Request Memo TTL (s)", ClampMin = 0))
+	float m_RequestMemoSeconds = 5.0f;
+
+	/** How many users PrefetchUserInformation has waiting on Steam at once, the rest stay queued by priority. */
+	UPROPERTY(EditAnywhere, config, Category = Requests, meta = (DisplayName = "Max User Information Requests In Flight", ClampMin = 1))
+	int32 m_MaxUserInformationRequestsInFlight = 8;
+
+	/**
+	 * How much texture memory GetFriendAvatar keeps cached, least recently used avatars are dropped beyond it. A large avatar is 184*184*4 bytes.
+	 * 0 creates a new texture on every call.
+	 */
+	UPROPERTY(EditAnywhere, config, Category = Avatars, meta = (DisplayName = "Avatar Cache Budget (KB)", ClampMin = 0))
+	int32 m_AvatarCacheBudgetKB = 16384;
+
+	/** Keeps the avatars GetFriendAvatar returns in Saved/SteamBridge/Avatars, so they can be shown while Steam is still loading them next session. Needs the avatar cache. */
+	UPROPERTY(EditAnywhere, config, Category = Avatars, meta = (DisplayName = "Use Avatar Disk Cache", ConfigRestartRequired = true))
+	bool m_bUseAvatarDiskCache = true;
+
+	/** How large Saved/SteamBridge/Avatars may grow, the least recently shown avatars are deleted beyond it. 0 for no limit. */
+	UPROPERTY(EditAnywhere, config, Category = Avatars, meta = (DisplayName = "Avatar Disk Cache Budget (KB)", ClampMin = 0, EditCondition = "m_bUseAvatarDiskCache", ConfigRestartRequired = true))
+	int32 m_AvatarDiskCacheBudgetKB = 32768;
+
+	/**
+	 * How many messages USteamFriends keeps for each clan chat joined with JoinClanChatRoom, and each friend while SetListenForFriendsMessages is enabled.
+	 * 0 keeps none, leaving GetClanChatMessage and GetFriendMessage to read them from Steam.
+	 */
+	UPROPERTY(EditAnywhere, config, Category = Chat, meta = (DisplayName = "Chat History Length", ClampMin = 0, ConfigRestartRequired = true))
+	int32 m_ChatHistoryLength = 200;
+
+	/** The least time between batches of SetRichPresence and ClearRichPresence changes being published to Steam, 0 publishes them every frame. */
+	UPROPERTY(EditAnywhere, config, Category = RichPresence, meta = (DisplayName = "Rich Presence Interval (ms)", ClampMin = 0))
+	int32 m_RichPresenceIntervalMs = 1000;
+
+	/** The width and height of the pages GetFriendAvatarAtlasSlot packs avatars into. Requires a restart. */
+	UPROPERTY(EditAnywhere, config, Category = Avatars, meta = (DisplayName = "Avatar Atlas Page Size", ClampMin = 256, ClampMax = 4096, ConfigRestartRequired = true))
+	int32 m_AvatarAtlasPageSize = 1024;
+
+	/** How many pages each avatar size may use before the least recently used avatars are evicted from the atlas. Requires a restart. */
+	UPROPERTY(EditAnywhere, config, Category = Avatars, meta = (DisplayName = "Avatar Atlas Max Pages", ClampMin = 1, ConfigRestartRequired = true))
+	int32 m_AvatarAtlasMaxPages = 4;
+
+	/**
+	 * Run the wrappers against a simulated, in-process Steam instead of the Steam client, e.g. for automation on machines without Steam. Also enabled by -SteamBridgeStandIn.
+	 * The simulated session is shaped on the command line: -SteamBridgeStandInSeed=, Friends=, Clans=, AppID=, LatencyMs= and ChurnHz=. Requires a restart.
+	 */
+	UPROPERTY(EditAnywhere, config, Category = Backend, meta = (DisplayName = "Use Stand-In Backend", ConfigRestartRequired = true))
+	bool m_bUseStandInBackend;
+
 	// TODO: Implement OSS Steam settings to remove the requirement of setting the info via text editor
 };
@@ -0,0 +1,76 @@
+// Copyright 2020 Russ 'trdwll' Treadwell <trdwll.com>. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+
+DECLARE_STATS_GROUP(TEXT("SteamBridge"), STATGROUP_SteamBridge, STATCAT_Advanced);
+
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Queued Callbacks"), STAT_SteamBridge_QueueDepth, STATGROUP_SteamBridge, STEAMBRIDGE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Dispatched Callbacks"), STAT_SteamBridge_DispatchedCallbacks, STATGROUP_SteamBridge, STEAMBRIDGE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Deferred Callbacks"), STAT_SteamBridge_DeferredCallbacks, STATGROUP_SteamBridge, STEAMBRIDGE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Handled Callbacks"), STAT_SteamBridge_HandledCallbacks, STATGROUP_SteamBridge, STEAMBRIDGE_API);
+
+/**
+ * Invocation count and handler time of one callback type.
+ */
+struct FSteamCallbackProfile
+{
+	// Bucket 0 is under 8us, every following bucket doubles the upper bound and the last one is unbounded
+	static constexpr int32 NumLatencyBuckets = 14;
+
+	const TCHAR* Name;
+	uint64 Invocations;
+	double TotalSeconds;
+	double MaxSeconds;
+	uint32 LatencyBuckets[NumLatencyBuckets];
+
+	FSteamCallbackProfile() : Name(TEXT("")), Invocations(0), TotalSeconds(0.0), MaxSeconds(0.0) { FMemory::Memzero(LatencyBuckets); }
+
+	static int32 GetLatencyBucket(double Seconds);
+};
+
+/**
+ * Per callback type invocation counts and latency histograms of the On* handlers, including whatever is bound to their delegates.
+ * Queried with the SteamBridge.CallbackStats console command. Game thread only.
+ */
+class STEAMBRIDGE_API FSteamCallbackStats
+{
+public:
+	static FSteamCallbackStats& Get();
+
+	void Record(int32 CallbackID, const TCHAR* Name, double Seconds);
+
+	void Dump(FOutputDevice& Ar) const;
+	void Reset() { m_Profiles.Reset(); }
+
+	const FSteamCallbackProfile* Find(int32 CallbackID) const { return m_Profiles.Find(CallbackID); }
+
+private:
+	TMap<int32, FSteamCallbackProfile> m_Profiles;
+};
+
+#if !UE_BUILD_SHIPPING
+/**
+ * Times the enclosing On* handler into FSteamCallbackStats.
+ */
+class FSteamCallbackScope
+{
+public:
+	FSteamCallbackScope(int32 CallbackID, const TCHAR* Name) : m_CallbackID(CallbackID), m_Name(Name), m_StartCycles(FPlatformTime::Cycles64()) {}
+	~FSteamCallbackScope() { FSteamCallbackStats::Get().Record(m_CallbackID, m_Name, FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - m_StartCycles)); }
+
+private:
+	int32 m_CallbackID;
+	const TCHAR* m_Name;
+	uint64 m_StartCycles;
+};
+
+#define STEAMBRIDGE_CALLBACK_SCOPE(Handler, pParam)                                                        \
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT(#Handler), STAT_SteamBridge_##Handler, STATGROUP_SteamBridge);        \
+	INC_DWORD_STAT(STAT_SteamBridge_HandledCallbacks);                                                     \
+	FSteamCallbackScope SteamCallbackScope(TRemovePointer<decltype(pParam)>::Type::k_iCallback, TEXT(#Handler))
+#else
+#define STEAMBRIDGE_CALLBACK_SCOPE(Handler, pParam)
+#endif
@@ -0,0 +1,37 @@
+// Copyright 2020 Russ 'trdwll' Treadwell <trdwll.com>. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Steam.h"
+#include "Trace/Trace.h"
+
+/** Unreal Insights channel for the Steamworks wrappers, enable it with -trace=cpu,SteamBridge. */
+UE_TRACE_CHANNEL_EXTERN(SteamBridgeChannel, STEAMBRIDGE_API);
+
+#if CPUPROFILERTRACE_ENABLED
+/** Times the enclosing wrapper, including its string conversions. Emitted only while both the cpu and SteamBridge channels are enabled. */
+#define STEAMBRIDGE_TRACE_SCOPE(Name) TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL_STR(#Name, SteamBridgeChannel)
+#else
+#define STEAMBRIDGE_TRACE_SCOPE(Name)
+#endif
+
+/**
+ * Emits the issue and completion of Steam API calls on SteamBridgeChannel, so their async latency can be measured in a captured trace.
+ * Every issued call is traced, but completions only where SteamBridge sees the result by handle: in manual dispatch (callback thread or budget)
+ * that's every call, in the default dispatch mode only calls awaited through FSteamCallResults::Await (including the latent Blueprint nodes).
+ * A plain FSteamAPICall handle is completed by Steam straight into the On* handlers, which don't get the handle, so its completion isn't traced.
+ */
+struct STEAMBRIDGE_API FSteamBridgeTrace
+{
+	/**
+	 * Records that a Steam API call has been issued.
+	 *
+	 * @param SteamAPICall_t APICall
+	 * @return SteamAPICall_t The same handle, so it can wrap the issuing call
+	 */
+	static SteamAPICall_t APICallIssued(SteamAPICall_t APICall);
+
+	static void APICallCompleted(SteamAPICall_t APICall, int32 CallbackID, bool bIOFailure);
+};
@@ -23,6 +23,10 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Steam|USteamBridgeUtils")
 	FString GetSteamIDAsString(const FSteamID& SteamID) const;
 
+	/** Interns a stats, rich presence or rules key for the ByKey functions, case sensitively. Do it once (e.g. on BeginPlay) and keep the result. */
+	UFUNCTION(BlueprintPure, Category = "Steam|USteamBridgeUtils")
+	static FSteamKey MakeSteamKey(const FString& Key);
+
 	// Thanks to Rama for this method
 	// GetEnumValueAsString<EEnumType>("EEnumType", Value);
 	template <typename TEnum>
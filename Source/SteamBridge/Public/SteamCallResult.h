@@ -0,0 +1,104 @@
+// Copyright 2020 Russ 'trdwll' Treadwell <trdwll.com>. All Rights Reserved.
+
+#pragma once
+
+#include "Async/Future.h"
+#include "CoreMinimal.h"
+#include "Steam.h"
+#include "SteamBridgeTrace.h"
+#include "SteamCallbackDispatcher.h"
+
+/**
+ * The payload of a completed Steam API call. Result is zeroed when bIOFailure is set.
+ */
+template <class T>
+struct TSteamCallResult
+{
+	T Result;
+	bool bIOFailure;
+
+	TSteamCallResult() : bIOFailure(true) { FMemory::Memzero(Result); }
+	TSteamCallResult(const T& InResult, bool bInIOFailure) : Result(InResult), bIOFailure(bInIOFailure) {}
+};
+
+/**
+ * A Steam API call waiting for its result, owned by FSteamCallbackDispatcher and keyed by its handle.
+ */
+class FSteamPendingCallResult
+{
+public:
+	virtual ~FSteamPendingCallResult() {}
+
+	/** Completes the call with a payload the dispatcher copied off the pipe. */
+	virtual void Complete(void* Param, bool bIOFailure) = 0;
+
+	/** Completes the call as failed, without a payload. */
+	virtual void Fail() = 0;
+};
+
+template <class T>
+class TSteamPendingCallResult final : public FSteamPendingCallResult
+{
+public:
+	explicit TSteamPendingCallResult(SteamAPICall_t APICall) : m_APICall(APICall)
+	{
+		// Steam invokes the CCallResult itself unless the dispatcher is in manual dispatch, in which case it routes the result by handle
+		if (!FSteamCallbackDispatcher::Get().IsManualDispatch())
+		{
+			m_CallResult.Set(APICall, this, &TSteamPendingCallResult::OnResult);
+		}
+	}
+
+	TFuture<TSteamCallResult<T>> GetFuture() { return m_Promise.GetFuture(); }
+
+	virtual void Complete(void* Param, bool bIOFailure) override { OnResult((T*)Param, bIOFailure); }
+
+	virtual void Fail() override
+	{
+		m_CallResult.Cancel();
+		m_Promise.SetValue(TSteamCallResult<T>());
+	}
+
+private:
+	void OnResult(T* pParam, bool bIOFailure)
+	{
+		if (!FSteamCallbackDispatcher::Get().IsManualDispatch())
+		{
+			FSteamBridgeTrace::APICallCompleted(m_APICall, T::k_iCallback, bIOFailure);
+		}
+
+		m_Promise.SetValue(bIOFailure ? TSteamCallResult<T>() : TSteamCallResult<T>(*pParam, false));
+		FSteamCallbackDispatcher::Get().FinishCallResult(m_APICall);
+	}
+
+	CCallResult<TSteamPendingCallResult<T>, T> m_CallResult;
+	TPromise<TSteamCallResult<T>> m_Promise;
+	SteamAPICall_t m_APICall;
+};
+
+/**
+ * Turns Steam API call handles into futures. The result is delivered straight to the caller on the game thread,
+ * the On* delegate of the callback type is still broadcast to its listeners as well.
+ */
+struct FSteamCallResults
+{
+	/**
+	 * Gets a future for the result of a Steam API call.
+	 *
+	 * @param SteamAPICall_t APICall The handle returned by the Steam function, k_uAPICallInvalid fails immediately
+	 * @return TFuture<TSteamCallResult<T>> Fulfilled on the game thread when the callbacks are dispatched
+	 */
+	template <class T>
+	static TFuture<TSteamCallResult<T>> Await(SteamAPICall_t APICall)
+	{
+		if (APICall == k_uAPICallInvalid)
+		{
+			return MakeFulfilledPromise<TSteamCallResult<T>>().GetFuture();
+		}
+
+		TUniquePtr<TSteamPendingCallResult<T>> Pending = MakeUnique<TSteamPendingCallResult<T>>(APICall);
+		TFuture<TSteamCallResult<T>> Future = Pending->GetFuture();
+		FSteamCallbackDispatcher::Get().AddCallResult(APICall, MoveTemp(Pending));
+		return Future;
+	}
+};
@@ -0,0 +1,273 @@
+// Copyright 2020 Russ 'trdwll' Treadwell <trdwll.com>. All Rights Reserved.
+
+#pragma once
+
+#include "Containers/Queue.h"
+#include "CoreMinimal.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "Steam.h"
+
+class FSteamCallbackPump;
+class FSteamPendingCallResult;
+
+/**
+ * Order in which queued callbacks are replayed. High priority callbacks are never deferred by the dispatch budget.
+ */
+enum class ESteamCallbackPriority : uint8
+{
+	High,    // auth, connection and game server callbacks
+	Normal,
+	Low,     // cosmetic bursts such as persona, avatar and HTML paint updates
+	Count
+};
+
+/**
+ * A callback (or call result) copied off a Steam pipe, waiting to be replayed on the game thread.
+ */
+struct FSteamQueuedCallback
+{
+	int32 CallbackID;
+	bool bGameServer;
+	bool bIOFailure;
+	SteamAPICall_t APICall;
+	TArray<uint8, TInlineAllocator<64>> Payload;
+
+	FSteamQueuedCallback() : CallbackID(0), bGameServer(false), bIOFailure(false), APICall(k_uAPICallInvalid) {}
+};
+
+/**
+ * When a Steam pipe is due to be pumped next.
+ */
+struct FSteamPipeSchedule
+{
+	bool bEnabled;
+	double IntervalSeconds;  // 0 pumps on every opportunity
+	double NextPumpTime;
+
+	FSteamPipeSchedule() : bEnabled(true), IntervalSeconds(0.0), NextPumpTime(0.0) {}
+};
+
+/**
+ * Owns the SteamBridge callback registrations.
+ * By default Steam invokes the registered handlers itself from SteamAPI_RunCallbacks. When manual dispatch is enabled the Steam pipes are drained -
+ * (optionally on a dedicated thread) into a lock-free queue and the payloads are replayed to the same handlers from the game thread.
+ */
+class STEAMBRIDGE_API FSteamCallbackDispatcher
+{
+public:
+	static FSteamCallbackDispatcher& Get();
+
+	template <class T, class P, bool bGameServer>
+	static void Register(CCallback<T, P, bGameServer>& Callback, T* Object, void (T::*Func)(P*))
+	{
+		Callback.Register(Object, Func);
+		Get().AddCallback(&Callback, P::k_iCallback, bGameServer);
+	}
+
+	template <class T, class P, bool bGameServer>
+	static void Unregister(CCallback<T, P, bGameServer>& Callback)
+	{
+		Get().RemoveLazyCallback(&Callback);
+		Get().RemoveCallback(&Callback, P::k_iCallback, bGameServer);
+		Callback.Unregister();
+	}
+
+	/**
+	 * Registers the callback with Steam only while the delegate has bindings (or it's retained), see UpdateLazyCallbacks.
+	 *
+	 * @param CCallback & Callback
+	 * @param T * Object
+	 * @param void (T::*Func)(P*)
+	 * @param const FMulticastScriptDelegate & Delegate The delegate the handler broadcasts
+	 * @return void
+	 */
+	template <class T, class P, bool bGameServer>
+	static void RegisterLazy(CCallback<T, P, bGameServer>& Callback, T* Object, void (T::*Func)(P*), const FMulticastScriptDelegate& Delegate)
+	{
+		CCallback<T, P, bGameServer>* const CallbackPtr = &Callback;
+		Get().AddLazyCallback(CallbackPtr, Delegate, [CallbackPtr, Object, Func](bool bRegister) {
+			if (bRegister)
+			{
+				Register(*CallbackPtr, Object, Func);
+			}
+			else
+			{
+				Get().RemoveCallback(CallbackPtr, P::k_iCallback, bGameServer);
+				CallbackPtr->Unregister();
+			}
+		});
+	}
+
+	/** Also keeps a lazily registered callback registered while this delegate has bindings, for handlers that broadcast more than one delegate. */
+	void AddLazyTrigger(CCallbackBase& Callback, const FMulticastScriptDelegate& Delegate);
+
+	/**
+	 * Keeps a lazily registered callback registered regardless of its delegates, for SteamBridge's own consumers. Registers it immediately.
+	 *
+	 * @param const CCallbackBase & Callback
+	 * @return void
+	 */
+	void Retain(const CCallbackBase& Callback);
+	void Release(const CCallbackBase& Callback);
+
+	/** Registers or unregisters the lazy callbacks whose delegates gained their first or lost their last binding. Called each tick before pumping. */
+	void UpdateLazyCallbacks();
+
+	/**
+	 * Switches Steam to manual dispatch. Must be called before SteamAPI_Init and affects every Steam consumer in the process.
+	 *
+	 * @param bool bUseThread Drain the pipes on a dedicated thread instead of the game thread
+	 * @param int32 PumpIntervalMs How long the pump thread sleeps between drains
+	 * @return void
+	 */
+	void StartManualDispatch(bool bUseThread, int32 PumpIntervalMs);
+	void StopManualDispatch();
+
+	/** Dispatches like manual dispatch without involving Steam at all, for a stand-in backend that posts its own callbacks. */
+	void StartStandInDispatch();
+
+	bool IsManualDispatch() const { return m_bManualDispatch; }
+	bool IsThreaded() const { return m_Pump.IsValid(); }
+
+	/**
+	 * Limits how long DispatchQueued may run each frame, whatever is left over is carried over to the next frame.
+	 *
+	 * @param int32 BudgetMicroseconds 0 disables the budget
+	 * @return void
+	 */
+	void SetDispatchBudget(int32 BudgetMicroseconds) { m_DispatchBudgetSeconds = FMath::Max(BudgetMicroseconds, 0) / 1000000.0; }
+
+	int32 GetQueueDepth() const;
+	int32 GetQueueDepth(ESteamCallbackPriority Priority) const { return m_QueueDepth[(int32)Priority].GetValue(); }
+	uint64 GetTotalDeferredCallbacks() const { return m_TotalDeferredCallbacks; }
+
+	static ESteamCallbackPriority GetCallbackPriority(int32 CallbackID);
+
+	/**
+	 * Chooses which Steam pipes get pumped and how often. Only the callback thread keeps to the rate independently of the frame rate,
+	 * otherwise a pipe is pumped at most once per frame, on the first frame after it's due.
+	 *
+	 * @param bool bPumpClient
+	 * @param float ClientRateHz 0 pumps every frame (or every callback thread iteration)
+	 * @param bool bPumpServer
+	 * @param float ServerRateHz 0 pumps every frame (or every callback thread iteration)
+	 * @return void
+	 */
+	void SetPumpPolicy(bool bPumpClient, float ClientRateHz, bool bPumpServer, float ServerRateHz);
+
+	/**
+	 * Gets the pipe to pump if it's enabled, initialized and due. Called from whichever thread pumps.
+	 *
+	 * @param bool bGameServer
+	 * @param double Now
+	 * @return HSteamPipe 0 if the pipe shouldn't be pumped now
+	 */
+	HSteamPipe GetDuePipe(bool bGameServer, double Now) const;
+
+	/**
+	 * Schedules the next pump of a pipe once it has actually been pumped, so a pipe that was due but held back keeps its slot.
+	 *
+	 * @param bool bGameServer
+	 * @param double Now
+	 * @return void
+	 */
+	void SchedulePump(bool bGameServer, double Now);
+
+	/** Time until the next rate limited pipe is due, ignores pipes that pump on every opportunity. */
+	double GetSecondsUntilNextPump(double Now) const;
+
+	/**
+	 * Copies every pending callback on the pipe into the queue and schedules its next pump. Safe to call from the pump thread.
+	 *
+	 * @param HSteamPipe SteamPipe
+	 * @param bool bGameServer
+	 * @param double Now
+	 * @return void
+	 */
+	void PumpPipe(HSteamPipe SteamPipe, bool bGameServer, double Now);
+
+	/**
+	 * Queues a callback (or call result, if APICall is set) that didn't come off a Steam pipe. Safe to call from any thread.
+	 *
+	 * @param FSteamQueuedCallback && Queued
+	 * @return void
+	 */
+	void Post(FSteamQueuedCallback&& Queued);
+
+	/** Replays the queued callbacks to the registered handlers in priority order, within the dispatch budget. Game thread only. */
+	void DispatchQueued();
+
+	/** Broadcast on the game thread once this frame's callbacks have been dispatched, whichever dispatch mode is active. */
+	FSimpleMulticastDelegate& OnPostDispatch() { return m_OnPostDispatch; }
+
+	/** Takes ownership of a pending API call, see FSteamCallResults::Await. */
+	void AddCallResult(SteamAPICall_t APICall, TUniquePtr<FSteamPendingCallResult>&& Pending);
+
+	/** Called by a pending API call once it has completed. It's kept alive until ReleaseFinishedCallResults as Steam may still be inside it. */
+	void FinishCallResult(SteamAPICall_t APICall);
+	void ReleaseFinishedCallResults();
+
+	/** Fails every pending API call, so nothing waits on a future that will never be fulfilled. */
+	void CancelCallResults();
+
+	int32 GetPendingCallResultCount() const { return m_CallResults.Num(); }
+
+private:
+	friend class FSteamCallbackDispatcherRegistrationTest;
+
+	FSteamCallbackDispatcher();
+	~FSteamCallbackDispatcher();
+
+	void AddCallback(CCallbackBase* Callback, int32 CallbackID, bool bGameServer);
+	void RemoveCallback(CCallbackBase* Callback, int32 CallbackID, bool bGameServer);
+
+	void AddLazyCallback(CCallbackBase* Callback, const FMulticastScriptDelegate& Delegate, TFunction<void(bool)>&& SetRegistered);
+	void RemoveLazyCallback(CCallbackBase* Callback);
+
+	void Enqueue(FSteamQueuedCallback&& Queued);
+	void Dispatch(FSteamQueuedCallback& Queued);
+
+	/** HTML surface payloads point into buffers Steam only keeps alive until the pipe is pumped again. */
+	static bool HasTransientPayload(int32 CallbackID) { return CallbackID >= k_iSteamHTMLSurfaceCallbacks && CallbackID < k_iSteamHTMLSurfaceCallbacks + 100; }
+
+	bool HasPendingTransientCallbacks() const { return m_PendingTransientCallbacks[0].GetValue() > 0 || m_PendingTransientCallbacks[1].GetValue() > 0; }
+
+	TMap<int32, TArray<CCallbackBase*, TInlineAllocator<2>>> m_ClientCallbacks;
+	TMap<int32, TArray<CCallbackBase*, TInlineAllocator<2>>> m_GameServerCallbacks;
+
+	struct FLazyCallback
+	{
+		CCallbackBase* Callback;
+		TArray<const FMulticastScriptDelegate*, TInlineAllocator<2>> Delegates;
+		TFunction<void(bool)> SetRegistered;
+		int32 RetainCount;
+		bool bRegistered;
+	};
+
+	TArray<FLazyCallback> m_LazyCallbacks;
+
+	TMap<SteamAPICall_t, TUniquePtr<FSteamPendingCallResult>> m_CallResults;
+	TArray<TUniquePtr<FSteamPendingCallResult>> m_FinishedCallResults;
+
+	FSteamPipeSchedule m_PipeSchedules[2];
+
+	TQueue<FSteamQueuedCallback, EQueueMode::Mpsc> m_Queues[(int32)ESteamCallbackPriority::Count];
+
+	FThreadSafeCounter m_QueueDepth[(int32)ESteamCallbackPriority::Count];
+
+	double m_DispatchBudgetSeconds;
+
+	uint64 m_TotalDeferredCallbacks;
+
+	// How many callbacks at the front of each queue were already counted as deferred
+	int32 m_CarriedOverCallbacks[(int32)ESteamCallbackPriority::Count];
+
+	// Per pipe, a pipe isn't pumped again while callbacks pointing into its buffers are queued
+	FThreadSafeCounter m_PendingTransientCallbacks[2];
+
+	TUniquePtr<FSteamCallbackPump> m_Pump;
+
+	FSimpleMulticastDelegate m_OnPostDispatch;
+
+	bool m_bManualDispatch;
+};
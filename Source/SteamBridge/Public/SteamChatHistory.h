@@ -0,0 +1,65 @@
+// Copyright 2020 Russ 'trdwll' Treadwell <trdwll.com>. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SteamStructs.h"
+
+/**
+ * The most recent messages of each friend and clan chat, in a ring per chat so a busy chat overwrites its oldest messages (and reuses their strings) instead of growing.
+ * USteamFriends fills it from GameConnectedClanChatMsg and GameConnectedFriendChatMsg, so reading a chat doesn't call into Steam. Game thread only.
+ */
+class STEAMBRIDGE_API FSteamChatHistory
+{
+public:
+	FSteamChatHistory() : m_Capacity(0) {}
+
+	/** How many messages each chat keeps, only applies to chats added after it's set. 0 adds no more chats. */
+	void SetCapacity(int32 Capacity) { m_Capacity = FMath::Max(Capacity, 0); }
+	int32 GetCapacity() const { return m_Capacity; }
+
+	/**
+	 * Adds a message to the chat, overwriting its oldest once it's full.
+	 *
+	 * @param uint64 ChatID The friend or clan chat the message was sent to
+	 * @param int32 MessageID
+	 * @param uint64 Sender
+	 * @param ESteamChatEntryType ChatEntryType
+	 * @param const ANSICHAR * Text UTF-8, null terminated
+	 * @return void
+	 */
+	void Add(uint64 ChatID, int32 MessageID, uint64 Sender, ESteamChatEntryType ChatEntryType, const ANSICHAR* Text);
+
+	int32 Num(uint64 ChatID) const
+	{
+		const FRing* const Ring = m_Chats.Find(ChatID);
+		return Ring != nullptr ? Ring->Messages.Num() : 0;
+	}
+
+	/**
+	 * Gets a message from the chat, oldest first.
+	 *
+	 * @param uint64 ChatID
+	 * @param int32 Index From 0 to Num(ChatID) - 1
+	 * @return const FSteamChatMessage* nullptr if the index is out of range
+	 */
+	const FSteamChatMessage* Get(uint64 ChatID, int32 Index) const;
+
+	/** Copies the chat's messages into Messages, oldest first. */
+	void CopyTo(uint64 ChatID, TArray<FSteamChatMessage>& Messages) const;
+
+	void Remove(uint64 ChatID) { m_Chats.Remove(ChatID); }
+
+private:
+	struct FRing
+	{
+		TArray<FSteamChatMessage> Messages;
+		// Fixed when the chat is added, so the ring never grows once it has wrapped
+		int32 Capacity = 0;
+		// Where the next message goes once Messages is full, which is also the oldest
+		int32 Next = 0;
+	};
+
+	TMap<uint64, FRing> m_Chats;
+	int32 m_Capacity;
+};
@@ -0,0 +1,61 @@
+// Copyright 2020 Russ 'trdwll' Treadwell <trdwll.com>. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SteamStructs.h"
+
+/**
+ * The Steam groups the current user is in, read in one pass so clan lists don't call into Steam per group and field.
+ * Activity counts are downloaded in batches, one DownloadClanActivityCounts call in flight at a time, and officer lists are
+ * read once their ClanOfficerListResponse arrives. Shared so in-flight downloads can tell it's gone. Game thread only.
+ */
+class STEAMBRIDGE_API FSteamClanCache : public TSharedFromThis<FSteamClanCache>
+{
+public:
+	FSteamClanCache() : m_Version(0), m_ActivityBatchSize(0), m_bDownloadingActivityCounts(false) {}
+
+	/** Reads every clan's metadata and locally known activity counts from Steam, replacing what's cached. Officer lists are kept. */
+	void Load();
+
+	const TArray<FSteamClanInfo>& GetClans() const { return m_Clans; }
+
+	const FSteamClanInfo* Find(uint64 SteamIDClan) const
+	{
+		const int32* const Index = m_Indices.Find(SteamIDClan);
+		return Index != nullptr ? &m_Clans[*Index] : nullptr;
+	}
+
+	/** Changes every time the clans or their activity counts do, so a widget can skip refreshing while it's the same. */
+	uint32 GetVersion() const { return m_Version; }
+
+	/**
+	 * Downloads every cached clan's activity counts, BatchSize clans per call. Does nothing while a refresh is still going.
+	 *
+	 * @param int32 BatchSize
+	 * @return void
+	 */
+	void RefreshActivityCounts(int32 BatchSize);
+
+	bool IsRefreshingActivityCounts() const { return m_bDownloadingActivityCounts; }
+
+	/** Reads the clan's officers from Steam, for once its officer list has been requested. */
+	void ReadOfficers(uint64 SteamIDClan);
+
+	/** Gets the clan's officers (owner first), or nullptr if they haven't been read. */
+	const TArray<FSteamID>* FindOfficers(uint64 SteamIDClan) const { return m_Officers.Find(SteamIDClan); }
+
+private:
+	void DownloadNextActivityBatch();
+	void ReadActivityCounts(FSteamClanInfo& Clan);
+
+	TArray<FSteamClanInfo> m_Clans;
+	TMap<uint64, int32> m_Indices;
+	TMap<uint64, TArray<FSteamID>> m_Officers;
+	uint32 m_Version;
+
+	// Clans whose activity counts are still to be downloaded, from the back
+	TArray<uint64> m_ActivityQueue;
+	int32 m_ActivityBatchSize;
+	bool m_bDownloadingActivityCounts;
+};
@@ -0,0 +1,74 @@
+// Copyright 2020 Russ 'trdwll' Treadwell <trdwll.com>. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SteamEnums.h"
+
+template <class TEnum>
+struct TSteamEnumString
+{
+	TEnum Value;
+	const char* String;
+};
+
+/**
+ * The strings Steam expects for the enums that are passed to it by name, e.g. the overlay dialogs.
+ * Looking them up is a bounds checked index, unlike reflecting over the UEnum which allocates on every call.
+ */
+struct STEAMBRIDGE_API FSteamEnumStrings
+{
+	static const char* ToString(ESteamGameOverlayTypes Value) { return Lookup(GameOverlayDialogs, Value); }
+	static const char* ToString(ESteamGameUserOverlayTypes Value) { return Lookup(GameUserOverlayDialogs, Value); }
+
+	static constexpr TSteamEnumString<ESteamGameOverlayTypes> GameOverlayDialogs[] = {
+		{ESteamGameOverlayTypes::Friends, "Friends"},
+		{ESteamGameOverlayTypes::Community, "Community"},
+		{ESteamGameOverlayTypes::Players, "Players"},
+		{ESteamGameOverlayTypes::Settings, "Settings"},
+		{ESteamGameOverlayTypes::OfficialGameGroup, "OfficialGameGroup"},
+		{ESteamGameOverlayTypes::Stats, "Stats"},
+		{ESteamGameOverlayTypes::Achievements, "Achievements"},
+	};
+
+	static constexpr TSteamEnumString<ESteamGameUserOverlayTypes> GameUserOverlayDialogs[] = {
+		{ESteamGameUserOverlayTypes::SteamID, "SteamID"},
+		{ESteamGameUserOverlayTypes::Chat, "Chat"},
+		{ESteamGameUserOverlayTypes::JoinTrade, "JoinTrade"},
+		{ESteamGameUserOverlayTypes::Stats, "Stats"},
+		{ESteamGameUserOverlayTypes::Achievements, "Achievements"},
+		{ESteamGameUserOverlayTypes::FriendAdd, "FriendAdd"},
+		{ESteamGameUserOverlayTypes::FriendRemove, "FriendRemove"},
+		{ESteamGameUserOverlayTypes::FriendRequestAccept, "FriendRequestAccept"},
+		{ESteamGameUserOverlayTypes::FriendRequestIgnore, "FriendRequestIgnore"},
+	};
+
+	/** Whether the table has an entry for every enumerator, in enum order, so it can be indexed by value. */
+	template <class TEnum, int32 Num>
+	static constexpr bool IsComplete(const TSteamEnumString<TEnum> (&Table)[Num])
+	{
+		if (Num != (int32)TEnum::Count)
+		{
+			return false;
+		}
+
+		for (int32 i = 0; i < Num; i++)
+		{
+			if ((int32)Table[i].Value != i || Table[i].String == nullptr)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+private:
+	template <class TEnum, int32 Num>
+	static const char* Lookup(const TSteamEnumString<TEnum> (&Table)[Num], TEnum Value)
+	{
+		return (int32)Value < Num ? Table[(int32)Value].String : "";
+	}
+};
+
+static_assert(FSteamEnumStrings::IsComplete(FSteamEnumStrings::GameOverlayDialogs), "FSteamEnumStrings::GameOverlayDialogs is out of sync with ESteamGameOverlayTypes");
+static_assert(FSteamEnumStrings::IsComplete(FSteamEnumStrings::GameUserOverlayDialogs), "FSteamEnumStrings::GameUserOverlayDialogs is out of sync with ESteamGameUserOverlayTypes");
@@ -15,7 +15,8 @@ enum class ESteamGameOverlayTypes : uint8
 	Settings,
 	OfficialGameGroup,
 	Stats,
-	Achievements
+	Achievements,
+	Count UMETA(Hidden)  // keeps FSteamEnumStrings in sync
 };
 
 UENUM(BlueprintType)
@@ -29,7 +30,8 @@ enum class ESteamGameUserOverlayTypes : uint8
 	FriendAdd,
 	FriendRemove,
 	FriendRequestAccept,
-	FriendRequestIgnore
+	FriendRequestIgnore,
+	Count UMETA(Hidden)  // keeps FSteamEnumStrings in sync
 };
 
 UENUM(BlueprintType)
@@ -290,7 +292,7 @@ enum class ESteamChatEntryType : uint8
 	LinkBlocked = 14 UMETA(DisplayName = "LinkBlocked")
 };
 
-UENUM(BlueprintType)
+UENUM(BlueprintType, meta = (Bitflags))
 enum class ESteamFriendFlags : uint8
 {
 	Blocked = 0 UMETA(DisplayName = "Blocked"),
@@ -309,6 +311,18 @@ enum class ESteamFriendFlags : uint8
 	All = 13 UMETA(DisplayName = "All")
 };
 
+// The columns USteamFriends::QueryFriends fills in besides the Steam ID
+UENUM(BlueprintType, meta = (Bitflags))
+enum class ESteamFriendQueryFields : uint8
+{
+	PersonaName = 0 UMETA(DisplayName = "PersonaName"),
+	PersonaState = 1 UMETA(DisplayName = "PersonaState"),
+	Relationship = 2 UMETA(DisplayName = "Relationship"),
+	GamePlayed = 3 UMETA(DisplayName = "GamePlayed"),
+	SteamLevel = 4 UMETA(DisplayName = "SteamLevel"),
+	RichPresence = 5 UMETA(DisplayName = "RichPresence")
+};
+
 UENUM(BlueprintType)
 enum class ESteamPersonaState : uint8
 {
@@ -343,7 +357,7 @@ enum class ESteamAvatarSize : uint8
 	Large UMETA(DisplayName = "Large (128*128)")
 };
 
-UENUM(BlueprintType)
+UENUM(BlueprintType, meta = (Bitflags))
 enum class ESteamUserRestrictions : uint8
 {
 	Unknown = 0 UMETA(DisplayName = "Unknown"),
@@ -786,7 +800,7 @@ enum class ESteamInputType_ : uint8
 };
 
 // Added the _ since Steam actually has this enum already and we need it accessible in BP
-UENUM(BlueprintType)
+UENUM(BlueprintType, meta = (Bitflags))
 enum class ESteamControllerLEDFlag_ : uint8
 {
 	SetColor = 0,
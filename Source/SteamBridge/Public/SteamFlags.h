@@ -0,0 +1,106 @@
+// Copyright 2020 Russ 'trdwll' Treadwell <trdwll.com>. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SteamEnums.h"
+
+/**
+ * How the values of a flag enum map onto the bits Steam expects. By default value N is bit (1 << N), which is also how
+ * Blueprint bitmask pins encode a Bitflags enum.
+ */
+template <class TEnum>
+struct TSteamFlagsTraits
+{
+	static constexpr uint32 ToBits(TEnum Flag) { return 1u << (uint32)Flag; }
+	static constexpr uint32 FromBitmask(uint32 Bitmask) { return Bitmask; }
+};
+
+/** k_EFriendFlagAll is every bit rather than bit 13. */
+template <>
+struct TSteamFlagsTraits<ESteamFriendFlags>
+{
+	static constexpr uint32 ToBits(ESteamFriendFlags Flag) { return Flag == ESteamFriendFlags::All ? 0xFFFF : 1u << (uint32)Flag; }
+	static constexpr uint32 FromBitmask(uint32 Bitmask) { return (Bitmask & (1u << (uint32)ESteamFriendFlags::All)) != 0 ? 0xFFFF : Bitmask; }
+};
+
+/**
+ * A set of flags from TEnum held as the bitmask Steam takes, so it's built once (at compile time when the flags are constant)
+ * rather than on every call.
+ *
+ * Blueprint can't use templates, so there the flags are an int32 with the Bitmask meta, see FromBitmask.
+ */
+template <class TEnum>
+class TSteamFlags
+{
+public:
+	constexpr TSteamFlags() : m_Bits(0) {}
+	constexpr TSteamFlags(TEnum Flag) : m_Bits(TSteamFlagsTraits<TEnum>::ToBits(Flag)) {}
+
+	/** Wraps a mask that's already in Steam's layout, e.g. a return value from Steam. */
+	static constexpr TSteamFlags FromBits(uint32 Bits) { return TSteamFlags(Bits, EBits::Tag); }
+
+	/** Converts a Blueprint bitmask pin (UPARAM(meta = (Bitmask, BitmaskEnum = ...))) of TEnum. */
+	static constexpr TSteamFlags FromBitmask(int32 Bitmask) { return TSteamFlags(TSteamFlagsTraits<TEnum>::FromBitmask((uint32)Bitmask), EBits::Tag); }
+
+	static TSteamFlags FromArray(const TArray<TEnum>& Flags)
+	{
+		TSteamFlags Result;
+		for (const TEnum Flag : Flags)
+		{
+			Result |= Flag;
+		}
+		return Result;
+	}
+
+	/** Gets each set bit as an enum value, only meaningful when every value maps to its own bit. */
+	TArray<TEnum> ToArray() const
+	{
+		TArray<TEnum> Result;
+		for (uint32 Bits = m_Bits; Bits != 0; Bits &= Bits - 1)
+		{
+			Result.Add((TEnum)FMath::CountTrailingZeros(Bits));
+		}
+		return Result;
+	}
+
+	constexpr uint32 GetBits() const { return m_Bits; }
+	constexpr bool IsEmpty() const { return m_Bits == 0; }
+	constexpr bool HasAny(TSteamFlags Other) const { return (m_Bits & Other.m_Bits) != 0; }
+	constexpr bool HasAll(TSteamFlags Other) const { return (m_Bits & Other.m_Bits) == Other.m_Bits; }
+
+	constexpr TSteamFlags operator|(TSteamFlags Other) const { return TSteamFlags(m_Bits | Other.m_Bits, EBits::Tag); }
+	constexpr TSteamFlags operator&(TSteamFlags Other) const { return TSteamFlags(m_Bits & Other.m_Bits, EBits::Tag); }
+	TSteamFlags& operator|=(TSteamFlags Other)
+	{
+		m_Bits |= Other.m_Bits;
+		return *this;
+	}
+
+	constexpr bool operator==(TSteamFlags Other) const { return m_Bits == Other.m_Bits; }
+	constexpr bool operator!=(TSteamFlags Other) const { return m_Bits != Other.m_Bits; }
+
+private:
+	enum class EBits
+	{
+		Tag
+	};
+
+	constexpr TSteamFlags(uint32 Bits, EBits) : m_Bits(Bits) {}
+
+	uint32 m_Bits;
+};
+
+/** Lets Flag | Flag on TEnum produce a TSteamFlags<TEnum>, similar to ENUM_CLASS_FLAGS. */
+#define STEAMBRIDGE_ENUM_FLAGS(TEnum) \
+	constexpr TSteamFlags<TEnum> operator|(TEnum A, TEnum B) { return TSteamFlags<TEnum>(A) | B; }
+
+STEAMBRIDGE_ENUM_FLAGS(ESteamFriendFlags)
+STEAMBRIDGE_ENUM_FLAGS(ESteamFriendQueryFields)
+STEAMBRIDGE_ENUM_FLAGS(ESteamUserRestrictions)
+STEAMBRIDGE_ENUM_FLAGS(ESteamControllerLEDFlag_)
+
+using FSteamFriendFlags = TSteamFlags<ESteamFriendFlags>;
+using FSteamFriendQueryFields = TSteamFlags<ESteamFriendQueryFields>;
+using FSteamUserRestrictions = TSteamFlags<ESteamUserRestrictions>;
+using FSteamControllerLEDFlags = TSteamFlags<ESteamControllerLEDFlag_>;
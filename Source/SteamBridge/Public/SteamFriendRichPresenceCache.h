@@ -0,0 +1,81 @@
+// Copyright 2020 Russ 'trdwll' Treadwell <trdwll.com>. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SteamStructs.h"
+
+/**
+ * Every rich presence key and value of the users it's asked about, so reading them doesn't call into Steam or transcode.
+ * Keys are set by other games, so they're kept as the UTF-8 strings Steam returned (never interned) and compared case sensitively, like FSteamKeys.
+ * A user's entry is read from Steam the first time it's needed after Invalidate, which USteamFriends calls from FriendRichPresenceUpdate for just that user.
+ * Game thread only.
+ */
+class STEAMBRIDGE_API FSteamFriendRichPresenceCache
+{
+public:
+	/** Marks the user's rich presence as changed, adding them if they aren't cached so FindUsers includes them. */
+	void Invalidate(uint64 SteamID) { m_Users.FindOrAdd(SteamID).bStale = true; }
+
+	void Remove(uint64 SteamID) { m_Users.Remove(SteamID); }
+	void Empty() { m_Users.Empty(); }
+
+	/**
+	 * Gets the value of one of the user's keys.
+	 *
+	 * @param uint64 SteamID
+	 * @param const ANSICHAR * Key UTF-8
+	 * @return const FString* nullptr if the user doesn't have the key
+	 */
+	const FString* Find(uint64 SteamID, const ANSICHAR* Key);
+
+	/** Gets how many keys the user has. */
+	int32 NumKeys(uint64 SteamID) { return Load(SteamID).KeyOffsets.Num(); }
+
+	/**
+	 * Gets one of the user's keys as Steam returned it, in the order Steam returns them.
+	 *
+	 * @param uint64 SteamID
+	 * @param int32 Index
+	 * @return const ANSICHAR* UTF-8, empty if the index is out of range
+	 */
+	const ANSICHAR* GetKey(uint64 SteamID, int32 Index);
+
+	/**
+	 * Finds every cached user whose key has the value, only calling into Steam for users invalidated since they were last read.
+	 *
+	 * @param const ANSICHAR * Key UTF-8
+	 * @param const FString & Value Compared case sensitively
+	 * @param TArray<FSteamID> & SteamIDs Emptied first, keeping its allocation
+	 * @return void
+	 */
+	void FindUsers(const ANSICHAR* Key, const FString& Value, TArray<FSteamID>& SteamIDs);
+
+private:
+	/** Key i starts at KeyOffsets[i] in KeyChars and has Values[i]. A user has at most k_cchMaxRichPresenceKeys, so they're searched linearly. */
+	struct FEntry
+	{
+		TArray<ANSICHAR> KeyChars;
+		TArray<int32> KeyOffsets;
+		TArray<FString> Values;
+		bool bStale = true;
+
+		const FString* Find(const ANSICHAR* Key) const
+		{
+			for (int32 i = 0; i < KeyOffsets.Num(); i++)
+			{
+				if (FCStringAnsi::Strcmp(&KeyChars[KeyOffsets[i]], Key) == 0)
+				{
+					return &Values[i];
+				}
+			}
+			return nullptr;
+		}
+	};
+
+	/** Gets the user's entry, reading it from Steam if it's new or stale. */
+	FEntry& Load(uint64 SteamID);
+	static void Reload(uint64 SteamID, FEntry& Entry);
+
+	TMap<uint64, FEntry> m_Users;
+};
@@ -0,0 +1,80 @@
+// Copyright 2020 Russ 'trdwll' Treadwell <trdwll.com>. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SteamEnums.h"
+#include "SteamFlags.h"
+
+/**
+ * The friends matching a set of flags as a structure of arrays, index i of every array being the same friend (in no particular order).
+ * A friend list can walk one column without touching the others, and without calling into Steam.
+ *
+ * USteamFriends builds it once and patches a working copy from PersonaStateChange and FriendRichPresenceUpdate. Readers get a TSharedRef<const ...>
+ * which never changes after it's handed out: the working copy is published once per frame, overwriting the published snapshot while USteamFriends
+ * holds the only reference to it and into a new one otherwise. Game thread only.
+ */
+class STEAMBRIDGE_API FSteamFriendsSnapshot
+{
+public:
+	explicit FSteamFriendsSnapshot(FSteamFriendFlags Flags) : m_Flags(Flags), m_Version(0) {}
+
+	/**
+	 * Queries Steam for every friend matching Flags.
+	 *
+	 * @param FSteamFriendFlags Flags
+	 * @return TSharedRef<FSteamFriendsSnapshot>
+	 */
+	static TSharedRef<FSteamFriendsSnapshot> Build(FSteamFriendFlags Flags);
+
+	int32 Num() const { return m_SteamIDs.Num(); }
+
+	/** Gets the index of the friend, or INDEX_NONE. */
+	int32 Find(uint64 SteamID) const
+	{
+		const int32* const Index = m_Indices.Find(SteamID);
+		return Index != nullptr ? *Index : INDEX_NONE;
+	}
+
+	/** Changes every time the snapshot is patched, so a widget can skip refreshing while it's the same. */
+	uint32 GetVersion() const { return m_Version; }
+
+	const TArray<uint64>& GetSteamIDs() const { return m_SteamIDs; }
+	const TArray<FString>& GetPersonaNames() const { return m_PersonaNames; }
+	const TArray<ESteamPersonaState>& GetPersonaStates() const { return m_PersonaStates; }
+	/** The game ID each friend is playing, 0 when they aren't in a game. */
+	const TArray<uint64>& GetGameIDs() const { return m_GameIDs; }
+	const TArray<int32>& GetSteamLevels() const { return m_SteamLevels; }
+
+	/** Whether Patch could change anything for this user. */
+	bool IsAffectedBy(uint64 SteamID, uint32 SteamChangeFlags) const;
+
+	/**
+	 * Re-reads the columns covered by the EPersonaChange flags for one user, adding or removing them when their relationship changed.
+	 *
+	 * @param uint64 SteamID
+	 * @param uint32 SteamChangeFlags
+	 * @return bool Whether anything changed
+	 */
+	bool Patch(uint64 SteamID, uint32 SteamChangeFlags);
+
+private:
+	void Add(uint64 SteamID);
+	void RemoveAt(int32 Index);
+
+	bool RefreshPersonaName(int32 Index);
+	bool RefreshPersonaState(int32 Index);
+	bool RefreshGameID(int32 Index);
+	bool RefreshSteamLevel(int32 Index);
+
+	FSteamFriendFlags m_Flags;
+	uint32 m_Version;
+
+	TArray<uint64> m_SteamIDs;
+	TArray<FString> m_PersonaNames;
+	TArray<ESteamPersonaState> m_PersonaStates;
+	TArray<uint64> m_GameIDs;
+	TArray<int32> m_SteamLevels;
+
+	TMap<uint64, int32> m_Indices;
+};
@@ -0,0 +1,25 @@
+// Copyright 2020 Russ 'trdwll' Treadwell <trdwll.com>. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Pixel conversions for the images Steam hands out (avatars, achievement icons, ...), which are always RGBA8.
+ */
+struct STEAMBRIDGE_API FSteamImageUtils
+{
+	/**
+	 * Swaps the red and blue channels, turning Steam's RGBA8 into BGRA8 (PF_B8G8R8A8). Uses SSE2, AVX2 or NEON when available.
+	 * Src and Dest may be the same buffer, e.g. a locked mip Steam has just written into.
+	 *
+	 * @param const uint8 * Src
+	 * @param uint8 * Dest
+	 * @param int32 NumPixels
+	 * @return void
+	 */
+	static void ConvertRGBAToBGRA(const uint8* Src, uint8* Dest, int32 NumPixels);
+
+	/** The scalar fallback of ConvertRGBAToBGRA, exposed for comparison. */
+	static void ConvertRGBAToBGRAScalar(const uint8* Src, uint8* Dest, int32 NumPixels);
+};
@@ -0,0 +1,34 @@
+// Copyright 2020 Russ 'trdwll' Treadwell <trdwll.com>. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SteamStructs.h"
+
+/**
+ * Interns the names Steam takes as keys (stats, rich presence, rules) as UTF-8 once, so passing one to Steam afterwards is an
+ * index into a table rather than a TCHAR_TO_UTF8 conversion per call. Keys are compared case sensitively like Steam compares
+ * stat names, so ones that differ only by case get their own entries. Entries are never removed. Game thread only.
+ */
+class STEAMBRIDGE_API FSteamKeys
+{
+public:
+	/**
+	 * Gets the handle of the key, converting and storing it the first time it's seen.
+	 *
+	 * @param const TCHAR * Key
+	 * @return FSteamKey
+	 */
+	static FSteamKey Intern(const TCHAR* Key);
+
+	/**
+	 * Gets the key's UTF-8 string, or an empty string for a handle that wasn't returned by Intern.
+	 *
+	 * @param FSteamKey Key
+	 * @return const char *
+	 */
+	static const char* ToUTF8(FSteamKey Key);
+
+	/** Same as ToUTF8(Intern(Key)). */
+	static const char* ToUTF8(const TCHAR* Key) { return ToUTF8(Intern(Key)); }
+};
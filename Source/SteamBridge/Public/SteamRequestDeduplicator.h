@@ -0,0 +1,159 @@
+// Copyright 2020 Russ 'trdwll' Treadwell <trdwll.com>. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SteamCallResult.h"
+
+/**
+ * Shares one Steam API call between identical requests (same call type and key, usually a SteamID) while it's in flight,
+ * and keeps the last successful result around for a short while so repeats don't reach Steam at all. Game thread only.
+ */
+template <class T>
+class TSteamRequestDeduplicator
+{
+public:
+	TSteamRequestDeduplicator() : m_State(MakeShared<FState>()) {}
+
+	/**
+	 * Issues the call unless an identical one is in flight, in which case its handle is returned instead.
+	 * Every caller gets the result through the usual callback broadcast.
+	 *
+	 * @param uint64 Key
+	 * @param TFunctionRef<SteamAPICall_t()> IssueCall
+	 * @param double MemoSeconds How long a successful result is served to Request, 0 doesn't keep it
+	 * @return SteamAPICall_t
+	 */
+	SteamAPICall_t Issue(uint64 Key, TFunctionRef<SteamAPICall_t()> IssueCall, double MemoSeconds)
+	{
+		m_State->MemoSeconds = MemoSeconds;
+
+		FEntry& Entry = m_State->Entries.FindOrAdd(Key);
+		if (Entry.APICall != k_uAPICallInvalid)
+		{
+			return Entry.APICall;
+		}
+
+		const SteamAPICall_t APICall = IssueCall();
+		if (APICall == k_uAPICallInvalid)
+		{
+			if (Entry.Memo.bIOFailure)
+			{
+				m_State->Entries.Remove(Key);
+			}
+			return APICall;
+		}
+
+		Entry.APICall = APICall;
+
+		TWeakPtr<FState> WeakState = m_State;
+		FSteamCallResults::Await<T>(APICall).Then([WeakState, Key, APICall](TFuture<TSteamCallResult<T>> Future) {
+			if (TSharedPtr<FState> State = WeakState.Pin())
+			{
+				State->Complete(Key, APICall, Future.Get());
+			}
+		});
+
+		return APICall;
+	}
+
+	/**
+	 * Gets the result of the call, from the memo if a fresh one is available or by joining (or issuing) the call otherwise.
+	 *
+	 * @param uint64 Key
+	 * @param TFunctionRef<SteamAPICall_t()> IssueCall
+	 * @param double MemoSeconds
+	 * @return TFuture<TSteamCallResult<T>>
+	 */
+	TFuture<TSteamCallResult<T>> Request(uint64 Key, TFunctionRef<SteamAPICall_t()> IssueCall, double MemoSeconds)
+	{
+		if (const FEntry* const Entry = m_State->Entries.Find(Key))
+		{
+			if (Entry->APICall == k_uAPICallInvalid && !Entry->Memo.bIOFailure && FPlatformTime::Seconds() - Entry->MemoTime < MemoSeconds)
+			{
+				return MakeFulfilledPromise<TSteamCallResult<T>>(Entry->Memo).GetFuture();
+			}
+		}
+
+		if (Issue(Key, IssueCall, MemoSeconds) == k_uAPICallInvalid)
+		{
+			return MakeFulfilledPromise<TSteamCallResult<T>>().GetFuture();
+		}
+
+		TPromise<TSteamCallResult<T>>& Waiter = m_State->Entries.FindChecked(Key).Waiters.AddDefaulted_GetRef();
+		return Waiter.GetFuture();
+	}
+
+	/**
+	 * Drops the memoized results older than MemoSeconds, calls in flight are kept.
+	 *
+	 * @param double MemoSeconds
+	 * @return void
+	 */
+	void PruneMemos(double MemoSeconds)
+	{
+		const double Now = FPlatformTime::Seconds();
+		for (auto It = m_State->Entries.CreateIterator(); It; ++It)
+		{
+			if (It.Value().APICall == k_uAPICallInvalid && Now - It.Value().MemoTime >= MemoSeconds)
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
+
+	/** Number of distinct calls currently in flight. */
+	int32 GetPendingCount() const
+	{
+		int32 Count = 0;
+		for (const TPair<uint64, FEntry>& Pair : m_State->Entries)
+		{
+			Count += Pair.Value.APICall != k_uAPICallInvalid ? 1 : 0;
+		}
+		return Count;
+	}
+
+private:
+	struct FEntry
+	{
+		SteamAPICall_t APICall = k_uAPICallInvalid;
+		TArray<TPromise<TSteamCallResult<T>>> Waiters;
+		TSteamCallResult<T> Memo;
+		double MemoTime = 0.0;
+	};
+
+	struct FState
+	{
+		TMap<uint64, FEntry> Entries;
+		double MemoSeconds = 0.0;
+
+		void Complete(uint64 Key, SteamAPICall_t APICall, const TSteamCallResult<T>& Result)
+		{
+			FEntry* const Entry = Entries.Find(Key);
+			if (Entry == nullptr || Entry->APICall != APICall)
+			{
+				return;
+			}
+
+			TArray<TPromise<TSteamCallResult<T>>> Waiters = MoveTemp(Entry->Waiters);
+			if (MemoSeconds > 0.0 && !Result.bIOFailure)
+			{
+				Entry->APICall = k_uAPICallInvalid;
+				Entry->Memo = Result;
+				Entry->MemoTime = FPlatformTime::Seconds();
+			}
+			else
+			{
+				Entries.Remove(Key);
+			}
+
+			// Fulfilled last, the continuations may issue the same request again
+			for (TPromise<TSteamCallResult<T>>& Waiter : Waiters)
+			{
+				Waiter.SetValue(Result);
+			}
+		}
+	};
+
+	TSharedRef<FState> m_State;
+};
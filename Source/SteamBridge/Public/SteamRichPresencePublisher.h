@@ -0,0 +1,78 @@
+// Copyright 2020 Russ 'trdwll' Treadwell <trdwll.com>. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Steam.h"
+#include "SteamKeys.h"
+#include "SteamStructs.h"
+
+/**
+ * Sits between SetRichPresence and Steam: remembers what Steam was last sent, drops updates that don't change anything and
+ * batches the rest until the next flush, so systems that set rich presence every tick cost a short scan instead of a Steam call.
+ * Changes breaking Steam's limits on key count and key and value length are refused up front rather than at flush. Game thread only.
+ *
+ * Keys are kept as UTF-8 strings, compared case sensitively like FSteamKeys, so keys passed as strings are never interned. There are never
+ * more entries than Steam allows keys, which keeps the scan short.
+ */
+class STEAMBRIDGE_API FSteamRichPresencePublisher
+{
+public:
+	FSteamRichPresencePublisher() : m_LastFlushSeconds(0.0) {}
+
+	/**
+	 * Queues a key to be set, or removed when Value is empty.
+	 *
+	 * @param FSteamKey Key
+	 * @param const FString & Value
+	 * @return bool false if the key or value is too long, or Steam's key limit would be exceeded
+	 */
+	bool Set(FSteamKey Key, const FString& Value) { return Set(FSteamKeys::ToUTF8(Key), Key, Value); }
+	bool Set(const FString& Key, const FString& Value) { return Set(FTCHARToUTF8(*Key).Get(), FSteamKey(), Value); }
+
+	/** Queues every key Steam was sent to be removed, so keys set again before the flush with the same value are left alone. */
+	void Clear();
+
+	/**
+	 * Gets the value the key will have once flushed.
+	 *
+	 * @param FSteamKey Key
+	 * @return const FString* nullptr if the key isn't (or won't be) set
+	 */
+	const FString* Find(FSteamKey Key) const { return Find(FSteamKeys::ToUTF8(Key), Key); }
+	const FString* Find(const FString& Key) const { return Find(FTCHARToUTF8(*Key).Get(), FSteamKey()); }
+
+	bool HasPendingChanges() const;
+
+	/**
+	 * Sends the queued changes to Steam, unless the last flush was less than IntervalSeconds ago.
+	 *
+	 * @param double IntervalSeconds
+	 * @return void
+	 */
+	void Flush(double IntervalSeconds);
+
+private:
+	struct FEntry
+	{
+		TArray<ANSICHAR> Key;
+		// 0 until the key has been passed as an interned key, which is then matched without comparing strings
+		FSteamKey Handle;
+		// What Steam was last sent, empty if the key isn't set
+		FString Committed;
+		// The change since, an empty value removing the key
+		FString Pending;
+		bool bPending = false;
+	};
+
+	bool Set(const ANSICHAR* Key, FSteamKey Handle, const FString& Value);
+	const FString* Find(const ANSICHAR* Key, FSteamKey Handle) const;
+	int32 FindEntry(const ANSICHAR* Key, FSteamKey Handle) const;
+
+	int32 CountKeysAfterFlush() const;
+
+	// Only keys that are set or have a change queued
+	TArray<FEntry> m_Entries;
+
+	double m_LastFlushSeconds;
+};
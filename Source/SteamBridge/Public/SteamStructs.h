@@ -7,6 +7,9 @@
 
 enum class ESteamPersonaChange : uint8;
 enum class ESteamControllerSourceMode : uint8;
+enum class ESteamFriendRelationship : uint8;
+enum class ESteamPersonaState : uint8;
+enum class ESteamChatEntryType : uint8;
 
 
 
@@ -102,6 +105,10 @@ struct STEAMBRIDGE_API FHTTPRequestHandle : public FUint32 { GENERATED_BODY() us
 USTRUCT(BlueprintType)
 struct STEAMBRIDGE_API FHHTMLBrowser : public FUint32 { GENERATED_BODY() using FUint32::FUint32; };
 
+/** A key interned by FSteamKeys, 0 is no key. */
+USTRUCT(BlueprintType)
+struct STEAMBRIDGE_API FSteamKey : public FInt32 { GENERATED_BODY() using FInt32::FInt32; };
+
 
 USTRUCT(BlueprintType)
 struct STEAMBRIDGE_API FSteamInputAnalogActionData
@@ -141,3 +148,97 @@ struct STEAMBRIDGE_API FSteamInputMotionData
 	FSteamInputMotionData() {}
 	FSteamInputMotionData(const FQuat& quat, const FVector& pos, const FVector& rotvel) : RotQuat(quat), PosAccel(pos), RotVel(rotvel) {}
 };
+
+/**
+ * The friends returned by USteamFriends::QueryFriends, one array per field with index i of each being the same friend.
+ * Arrays for fields that weren't asked for are left empty. Pass the same result to every query so its arrays and strings are reused.
+ */
+USTRUCT(BlueprintType)
+struct STEAMBRIDGE_API FSteamFriendsQueryResult
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "SteamBridgeCore|Friends")
+	TArray<FSteamID> SteamIDs;
+
+	UPROPERTY(BlueprintReadOnly, Category = "SteamBridgeCore|Friends")
+	TArray<FString> PersonaNames;
+
+	UPROPERTY(BlueprintReadOnly, Category = "SteamBridgeCore|Friends")
+	TArray<ESteamPersonaState> PersonaStates;
+
+	UPROPERTY(BlueprintReadOnly, Category = "SteamBridgeCore|Friends")
+	TArray<ESteamFriendRelationship> Relationships;
+
+	// The game ID each friend is playing, 0 when they aren't in a game
+	UPROPERTY(BlueprintReadOnly, Category = "SteamBridgeCore|Friends")
+	TArray<FSteamID> GameIDs;
+
+	UPROPERTY(BlueprintReadOnly, Category = "SteamBridgeCore|Friends")
+	TArray<int32> SteamLevels;
+
+	// Friend i's rich presence is RichPresenceKeys/Values [RichPresenceOffsets[i], RichPresenceOffsets[i + 1])
+	UPROPERTY(BlueprintReadOnly, Category = "SteamBridgeCore|Friends")
+	TArray<int32> RichPresenceOffsets;
+
+	UPROPERTY(BlueprintReadOnly, Category = "SteamBridgeCore|Friends")
+	TArray<FString> RichPresenceKeys;
+
+	UPROPERTY(BlueprintReadOnly, Category = "SteamBridgeCore|Friends")
+	TArray<FString> RichPresenceValues;
+};
+
+/** A chat message kept by USteamFriends' chat history. */
+USTRUCT(BlueprintType)
+struct STEAMBRIDGE_API FSteamChatMessage
+{
+	GENERATED_BODY()
+
+	// The ID GetClanChatMessage or GetFriendMessage would take
+	UPROPERTY(BlueprintReadOnly, Category = "SteamBridgeCore|Friends")
+	int32 MessageID = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "SteamBridgeCore|Friends")
+	FSteamID SteamIDSender;
+
+	UPROPERTY(BlueprintReadOnly, Category = "SteamBridgeCore|Friends")
+	ESteamChatEntryType ChatEntryType = (ESteamChatEntryType)0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "SteamBridgeCore|Friends")
+	FString Message;
+};
+
+/** A Steam group the current user is in, as kept by USteamFriends' clan cache. */
+USTRUCT(BlueprintType)
+struct STEAMBRIDGE_API FSteamClanInfo
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "SteamBridgeCore|Friends")
+	FSteamID SteamID;
+
+	UPROPERTY(BlueprintReadOnly, Category = "SteamBridgeCore|Friends")
+	FString Name;
+
+	UPROPERTY(BlueprintReadOnly, Category = "SteamBridgeCore|Friends")
+	FString Tag;
+
+	UPROPERTY(BlueprintReadOnly, Category = "SteamBridgeCore|Friends")
+	bool bPublic = false;
+
+	UPROPERTY(BlueprintReadOnly, Category = "SteamBridgeCore|Friends")
+	bool bOfficialGameGroup = false;
+
+	// Whether Online, InGame and Chatting are known, see USteamFriends::RefreshClanActivityCounts
+	UPROPERTY(BlueprintReadOnly, Category = "SteamBridgeCore|Friends")
+	bool bHasActivityCounts = false;
+
+	UPROPERTY(BlueprintReadOnly, Category = "SteamBridgeCore|Friends")
+	int32 Online = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "SteamBridgeCore|Friends")
+	int32 InGame = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "SteamBridgeCore|Friends")
+	int32 Chatting = 0;
+};
@@ -0,0 +1,78 @@
+// Copyright 2020 Russ 'trdwll' Treadwell <trdwll.com>. All Rights Reserved.
+
+#pragma once
+
+#include "Async/Future.h"
+#include "Containers/ArrayView.h"
+#include "CoreMinimal.h"
+
+/**
+ * Queues user information requests by priority and only lets a bounded number reach Steam at a time, so a server browser or
+ * leaderboard asking for hundreds of users doesn't flood it. Each request gets a future, completed from PersonaStateChange.
+ * Queued requests can be cancelled once the users are out of view; ones already sent to Steam can't. Game thread only.
+ */
+class STEAMBRIDGE_API FSteamUserInformationScheduler
+{
+public:
+	FSteamUserInformationScheduler() : m_NextSequence(0) {}
+	~FSteamUserInformationScheduler();
+
+	/**
+	 * Queues a request, or joins the one already queued for the user (raising its priority if this one's is higher).
+	 *
+	 * @param uint64 SteamID
+	 * @param int32 Priority Higher is sent first, requests with the same priority go in the order they were made
+	 * @param bool bRequireNameOnly
+	 * @return TFuture<bool> true once the information is available, false if the request was cancelled or timed out
+	 */
+	TFuture<bool> Request(uint64 SteamID, int32 Priority, bool bRequireNameOnly);
+
+	/** Cancels the user's request if it hasn't been sent to Steam yet. */
+	void Cancel(uint64 SteamID);
+
+	/** Completes the user's request, for when PersonaStateChange reports them. */
+	void Complete(uint64 SteamID);
+
+	/**
+	 * Sends queued requests until MaxInFlight are waiting on Steam, after timing out ones that have waited longer than TimeoutSeconds.
+	 *
+	 * @param int32 MaxInFlight
+	 * @param double TimeoutSeconds
+	 * @param TFunctionRef<bool(uint64, bool)> Issue Sends the request (SteamID, bRequireNameOnly), returning false when Steam already has the information
+	 * @return void
+	 */
+	void Pump(int32 MaxInFlight, double TimeoutSeconds, TFunctionRef<bool(uint64, bool)> Issue);
+
+	bool IsEmpty() const { return m_Requests.Num() == 0; }
+	int32 NumQueued() const { return m_Requests.Num() - m_InFlight.Num(); }
+	int32 NumInFlight() const { return m_InFlight.Num(); }
+
+private:
+	struct FRequest
+	{
+		TArray<TPromise<bool>> Waiters;
+		double IssueTime = 0.0;
+		int32 Priority = 0;
+		uint32 Sequence = 0;
+		bool bRequireNameOnly = true;
+		bool bInFlight = false;
+	};
+
+	/** Raising a priority pushes another entry instead of fixing up the heap, the outdated one is skipped when it's popped. */
+	struct FQueued
+	{
+		uint64 SteamID;
+		int32 Priority;
+		uint32 Sequence;
+
+		bool operator<(const FQueued& Other) const { return Priority != Other.Priority ? Priority > Other.Priority : Sequence < Other.Sequence; }
+	};
+
+	void Enqueue(uint64 SteamID, FRequest& Request, int32 Priority);
+	void Finish(uint64 SteamID, bool bResult);
+
+	TMap<uint64, FRequest> m_Requests;
+	TArray<FQueued> m_Queue;
+	TArray<uint64> m_InFlight;
+	uint32 m_NextSequence;
+};
@@ -14,6 +14,7 @@ public class SteamBridge : ModuleRules
             "CoreUObject",
             "Engine",
             "Projects",
+            "SlateCore",
             "Steamworks"
         });
 